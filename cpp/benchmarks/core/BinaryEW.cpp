@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+static Tensor Operand(const SizeVector& shape, const Device& device) {
+    return Tensor::Ones(shape, Dtype::Float32, device);
+}
+
+void AddContiguous(benchmark::State& state, const Device& device) {
+    Tensor lhs = Operand({1 << 10, 1 << 10, 4}, device);
+    Tensor rhs = Operand({1 << 10, 1 << 10, 4}, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void AddScalar(benchmark::State& state, const Device& device) {
+    Tensor lhs = Operand({1 << 10, 1 << 10, 4}, device);
+    Tensor rhs = Operand({}, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void Add2DStrided(benchmark::State& state, const Device& device) {
+    Tensor lhs = Operand({1 << 11, 1 << 11}, device).T();
+    Tensor rhs = Operand({1 << 11, 1 << 11}, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void AddGeneric(benchmark::State& state, const Device& device) {
+    Tensor lhs = Operand({1 << 7, 1 << 7, 1 << 8}, device).Permute({2, 1, 0});
+    Tensor rhs = Operand({1 << 8, 1 << 7, 1 << 7}, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+BENCHMARK_CAPTURE(AddContiguous, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AddScalar, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Add2DStrided, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AddGeneric, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr int64_t kBatchSize = 1 << 20;
+
+/// A batch of symmetric positive definite n x n matrices.
+static Tensor SPDBatch(int64_t n, const Device& device) {
+    Tensor M = Tensor::Ones({kBatchSize, n, n}, Dtype::Float32, device);
+    Tensor A = M.Matmul(M.Permute({0, 2, 1}));
+    for (int64_t i = 0; i < n; ++i) {
+        A.Slice(1, i, i + 1).Slice(2, i, i + 1) += 1.f;
+    }
+    return A;
+}
+
+void BatchedMatmul3x3(benchmark::State& state, const Device& device) {
+    Tensor A = Tensor::Ones({kBatchSize, 3, 3}, Dtype::Float32, device);
+    Tensor B = Tensor::Ones({kBatchSize, 3, 3}, Dtype::Float32, device);
+    Tensor warm_up = A.Matmul(B);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor C = A.Matmul(B);
+    }
+}
+
+void BatchedSymmetricEigen3x3(benchmark::State& state, const Device& device) {
+    Tensor A = SPDBatch(3, device);
+    Tensor eigenvalues, eigenvectors;
+    core::BatchedSymmetricEigen3x3(A, eigenvalues, eigenvectors);
+    for (auto _ : state) {
+        core::BatchedSymmetricEigen3x3(A, eigenvalues, eigenvectors);
+    }
+}
+
+void BatchedCholeskySolve6x6(benchmark::State& state, const Device& device) {
+    Tensor A = SPDBatch(6, device);
+    Tensor B = Tensor::Ones({kBatchSize, 6}, Dtype::Float32, device);
+    Tensor X;
+    core::BatchedCholeskySolve(A, B, X);
+    for (auto _ : state) {
+        core::BatchedCholeskySolve(A, B, X);
+    }
+}
+
+void BatchedSolve6x6(benchmark::State& state, const Device& device) {
+    Tensor A = SPDBatch(6, device);
+    Tensor B = Tensor::Ones({kBatchSize, 6}, Dtype::Float32, device);
+    Tensor X = A.Solve(B);
+    for (auto _ : state) {
+        X = A.Solve(B);
+    }
+}
+
+BENCHMARK_CAPTURE(BatchedMatmul3x3, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedSymmetricEigen3x3, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedCholeskySolve6x6, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedSolve6x6, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BatchedMatmul3x3, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedSymmetricEigen3x3, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedCholeskySolve6x6, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
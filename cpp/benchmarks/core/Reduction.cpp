@@ -55,5 +55,50 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+void ReductionNonContiguous(benchmark::State& state,
+                            const Device& device,
+                            SumMode mode) {
+    Tensor src = Tensor::Ones({64, 512, 512}, Dtype::Float32, device)
+                         .Permute({2, 0, 1});
+    Tensor warm_up = src.Sum({0, 2}, false, mode);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0, 2}, false, mode);
+    }
+}
+
+BENCHMARK_CAPTURE(ReductionNonContiguous,
+                  CPUNative,
+                  Device("CPU:0"),
+                  SumMode::Native)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionNonContiguous,
+                  CPUFloat64,
+                  Device("CPU:0"),
+                  SumMode::Float64)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionNonContiguous,
+                  CPUKahan,
+                  Device("CPU:0"),
+                  SumMode::Kahan)
+        ->Unit(benchmark::kMillisecond);
+
+void ReductionMinMaxSum(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({1 << 22, 3}, Dtype::Float32, device);
+    Tensor min, max, sum;
+    std::tie(min, max, sum) = src.MinMaxSum({0});
+    for (auto _ : state) {
+        std::tie(min, max, sum) = src.MinMaxSum({0});
+    }
+}
+
+BENCHMARK_CAPTURE(ReductionMinMaxSum, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ReductionMinMaxSum, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace core
 }  // namespace open3d
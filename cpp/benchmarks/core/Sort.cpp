@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+static Tensor RandomKeys(int64_t n,
+                         int64_t num_distinct,
+                         const Device& device) {
+    std::vector<int64_t> keys(n);
+    for (int64_t i = 0; i < n; ++i) {
+        keys[i] = (i * 2654435761LL) % num_distinct;
+    }
+    return Tensor(keys, {n}, Dtype::Int64, device);
+}
+
+void ArgSort(benchmark::State& state, const Device& device) {
+    Tensor src = RandomKeys(1 << 24, 1 << 30, device);
+    Tensor warm_up = src.ArgSort();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.ArgSort();
+    }
+}
+
+void Unique(benchmark::State& state, const Device& device) {
+    Tensor src = RandomKeys(1 << 24, 1 << 20, device);
+    Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = src.Unique();
+    for (auto _ : state) {
+        std::tie(values, inverse, counts) = src.Unique();
+    }
+}
+
+void SegmentSum(benchmark::State& state, const Device& device) {
+    const int64_t n = 1 << 22;
+    Tensor src = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor segment_ids = RandomKeys(n, 1 << 16, device).Sort();
+    Tensor warm_up = src.SegmentSum(segment_ids);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.SegmentSum(segment_ids);
+    }
+}
+
+BENCHMARK_CAPTURE(ArgSort, CPU, Device("CPU:0"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Unique, CPU, Device("CPU:0"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentSum, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ArgSort, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Unique, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentSum, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
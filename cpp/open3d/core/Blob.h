@@ -26,12 +26,18 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryUsage.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -39,7 +45,9 @@ namespace core {
 /// Blob class refers to a blob of memory in device or host.
 ///
 /// Usually a Blob is constructed by specifying the blob size and device, memory
-/// allocation happens during the Blob's construction.
+/// allocation happens during the Blob's construction. Such a Blob knows its
+/// byte size, is recorded by MemoryUsage, and can share its memory with other
+/// Blobs copy-on-write, see LazyCopy().
 ///
 /// A Blob's buffer can also be managed by an external memory manager. In this
 /// case, a deleter function is needed to notify the external memory manager
@@ -50,7 +58,8 @@ namespace core {
 /// memory address and it's up to the user to access any addresses around it.
 ///
 /// In summary:
-/// - A Blob does not know about its memory size after construction.
+/// - A Blob with externally managed memory does not know about its memory size
+/// after construction, and cannot be copied lazily.
 /// - A Blob cannot be deep-copied. However, the Tensor which owns the blob can
 /// be copied.
 class Blob {
@@ -60,9 +69,10 @@ public:
     /// \param byte_size Size of the blob in bytes.
     /// \param device Device where the blob resides.
     Blob(int64_t byte_size, const Device& device)
-        : deleter_(nullptr),
-          data_ptr_(MemoryManager::Malloc(byte_size, device)),
-          device_(device) {}
+        : byte_size_(byte_size), device_(device) {
+        memory_ = Allocate(byte_size, device);
+        data_ptr_ = memory_.get();
+    }
 
     /// Construct Blob with externally managed memory.
     ///
@@ -83,21 +93,91 @@ public:
             // The void(void*) signature is kept to be consistent with DLPack's
             // deleter.
             deleter_(nullptr);
-        } else {
-            MemoryManager::Free(data_ptr_, device_);
         }
+        // Owned memory is freed by memory_ once no Blob shares it anymore.
     };
 
     Device GetDevice() const { return device_; }
 
-    void* GetDataPtr() { return data_ptr_; }
+    /// Returns the data pointer for writing. If the memory is shared with
+    /// other Blobs, it is detached first, see Detach().
+    void* GetDataPtr() {
+        Detach();
+        return data_ptr_;
+    }
 
+    /// Returns the data pointer for reading. Never detaches.
     const void* GetDataPtr() const { return data_ptr_; }
 
+    /// Size of the owned memory in bytes, or -1 if the memory is externally
+    /// managed.
+    int64_t GetByteSize() const { return memory_ ? byte_size_ : -1; }
+
+    /// Returns true if the Blob can be copied lazily, i.e. it owns its memory.
+    bool IsLazyCopyable() const { return memory_ != nullptr; }
+
+    /// Returns true if the memory is currently shared with other Blobs.
+    bool IsShared() const { return memory_ && memory_.use_count() > 1; }
+
+    /// Returns a new Blob sharing this Blob's memory copy-on-write. Neither
+    /// Blob copies until it is accessed for writing via the non-const
+    /// GetDataPtr() or Detach(). Raw pointers obtained before the lazy copy
+    /// bypass this, so writing through them is visible to both Blobs.
+    std::shared_ptr<Blob> LazyCopy() const {
+        if (!memory_) {
+            utility::LogError(
+                    "Blob with externally managed memory cannot be copied "
+                    "lazily.");
+        }
+        return std::shared_ptr<Blob>(new Blob(*this));
+    }
+
+    /// Gives this Blob its own copy of the memory if it is shared with other
+    /// Blobs. Detaching the same Blob from several threads is not thread-safe,
+    /// so fetch pointers for writing before entering a parallel region.
+    void Detach() {
+        if (IsShared()) {
+            assert(!utility::InParallel() &&
+                   "Copy-on-write Blob detached inside a parallel region.");
+            std::shared_ptr<void> memory = Allocate(byte_size_, device_);
+            MemoryManager::Memcpy(memory.get(), device_, data_ptr_, device_,
+                                  byte_size_);
+            memory_ = memory;
+            data_ptr_ = memory_.get();
+        }
+    }
+
 protected:
+    /// Shares the memory of \p other, used by LazyCopy().
+    Blob(const Blob& other)
+        : memory_(other.memory_),
+          byte_size_(other.byte_size_),
+          data_ptr_(other.data_ptr_),
+          device_(other.device_) {}
+
+    /// Allocates memory that is freed when the last Blob sharing it is
+    /// destroyed.
+    static std::shared_ptr<void> Allocate(int64_t byte_size,
+                                          const Device& device) {
+        std::string tag = ScopedMemoryTag::GetCurrentTag();
+        void* ptr = MemoryManager::Malloc(byte_size, device);
+        MemoryUsage::RecordMalloc(byte_size, device, tag);
+        return std::shared_ptr<void>(ptr, [byte_size, device, tag](void* ptr) {
+            MemoryManager::Free(ptr, device);
+            MemoryUsage::RecordFree(byte_size, device, tag);
+        });
+    }
+
     /// For externally managed memory, deleter != nullptr.
     std::function<void(void*)> deleter_ = nullptr;
 
+    /// Owned memory, shared by lazily copied Blobs. nullptr for externally
+    /// managed memory.
+    std::shared_ptr<void> memory_ = nullptr;
+
+    /// Size of the owned memory in bytes.
+    int64_t byte_size_ = 0;
+
     /// Device data pointer.
     void* data_ptr_ = nullptr;
 
@@ -54,6 +54,12 @@
         } else if (DTYPE == open3d::core::Dtype::Float64) { \
             using scalar_t = double;                        \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int8) {    \
+            using scalar_t = int8_t;                        \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int16) {   \
+            using scalar_t = int16_t;                       \
+            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Int32) {   \
             using scalar_t = int32_t;                       \
             return __VA_ARGS__();                           \
@@ -80,3 +86,26 @@
             DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
         }                                                   \
     }()
+
+/// Same as DISPATCH_DTYPE_TO_TEMPLATE, and also dispatches Dtype::Float16 to
+/// scalar_t = open3d::core::Half. Only used by the kernels that support
+/// Float16, since Half converts to float for arithmetic.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)           \
+    [&] {                                                          \
+        if (DTYPE == open3d::core::Dtype::Float16) {               \
+            using scalar_t = open3d::core::Half;                   \
+            return __VA_ARGS__();                                  \
+        } else {                                                   \
+            return DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        }                                                          \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(DTYPE, ...)                \
+    [&] {                                                                    \
+        if (DTYPE == open3d::core::Dtype::Float16) {                         \
+            using scalar_t = open3d::core::Half;                             \
+            return __VA_ARGS__();                                            \
+        } else {                                                             \
+            return DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(DTYPE, __VA_ARGS__); \
+        }                                                                    \
+    }()
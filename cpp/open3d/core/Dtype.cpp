@@ -34,6 +34,8 @@ namespace core {
 static_assert(sizeof(float   ) == 4, "Unsupported platform: float must be 4 bytes."   );
 static_assert(sizeof(double  ) == 8, "Unsupported platform: double must be 8 bytes."  );
 static_assert(sizeof(int     ) == 4, "Unsupported platform: int must be 4 bytes."     );
+static_assert(sizeof(int8_t  ) == 1, "Unsupported platform: int8_t must be 1 byte."   );
+static_assert(sizeof(int16_t ) == 2, "Unsupported platform: int16_t must be 2 bytes." );
 static_assert(sizeof(int32_t ) == 4, "Unsupported platform: int32_t must be 4 bytes." );
 static_assert(sizeof(int64_t ) == 8, "Unsupported platform: int64_t must be 8 bytes." );
 static_assert(sizeof(uint8_t ) == 1, "Unsupported platform: uint8_t must be 1 byte."  );
@@ -41,8 +43,11 @@ static_assert(sizeof(uint16_t) == 2, "Unsupported platform: uint16_t must be 2 b
 static_assert(sizeof(bool    ) == 1, "Unsupported platform: bool must be 1 byte."     );
 
 const Dtype Dtype::Undefined(Dtype::DtypeCode::Undefined, 1, "Undefined");
+const Dtype Dtype::Float16  (Dtype::DtypeCode::Float,     2, "Float16"  );
 const Dtype Dtype::Float32  (Dtype::DtypeCode::Float,     4, "Float32"  );
 const Dtype Dtype::Float64  (Dtype::DtypeCode::Float,     8, "Float64"  );
+const Dtype Dtype::Int8     (Dtype::DtypeCode::Int,       1, "Int8"     );
+const Dtype Dtype::Int16    (Dtype::DtypeCode::Int,       2, "Int16"    );
 const Dtype Dtype::Int32    (Dtype::DtypeCode::Int,       4, "Int32"    );
 const Dtype Dtype::Int64    (Dtype::DtypeCode::Int,       8, "Int64"    );
 const Dtype Dtype::UInt8    (Dtype::DtypeCode::UInt,      1, "UInt8"    );
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Half.h"
+
+#include <algorithm>
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_HALF_RUNTIME_F16C
+#include <immintrin.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+#ifdef OPEN3D_HALF_RUNTIME_F16C
+__attribute__((target("avx,f16c"))) static void ConvertFloatToHalfF16C(
+        const float* src, Half* dst, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                    _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+    for (; i < n; ++i) {
+        dst[i] = Half(src[i]);
+    }
+}
+
+__attribute__((target("avx,f16c"))) static void ConvertHalfToFloatF16C(
+        const Half* src, float* dst, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i < n; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+static bool HasF16C() {
+    static const bool has_f16c = __builtin_cpu_supports("avx") &&
+                                 __builtin_cpu_supports("f16c");
+    return has_f16c;
+}
+#endif
+
+/// Number of elements converted by one task.
+static constexpr int64_t kConvertGrainSize = 1 << 16;
+
+void ConvertFloatToHalf(const float* src, Half* dst, int64_t n) {
+    const int64_t num_tasks = (n + kConvertGrainSize - 1) / kConvertGrainSize;
+#pragma omp parallel for schedule(static) if (num_tasks > 1)
+    for (int64_t task = 0; task < num_tasks; ++task) {
+        const int64_t begin = task * kConvertGrainSize;
+        const int64_t count = std::min(kConvertGrainSize, n - begin);
+#ifdef OPEN3D_HALF_RUNTIME_F16C
+        if (HasF16C()) {
+            ConvertFloatToHalfF16C(src + begin, dst + begin, count);
+            continue;
+        }
+#endif
+        for (int64_t i = begin; i < begin + count; ++i) {
+            dst[i] = Half(src[i]);
+        }
+    }
+}
+
+void ConvertHalfToFloat(const Half* src, float* dst, int64_t n) {
+    const int64_t num_tasks = (n + kConvertGrainSize - 1) / kConvertGrainSize;
+#pragma omp parallel for schedule(static) if (num_tasks > 1)
+    for (int64_t task = 0; task < num_tasks; ++task) {
+        const int64_t begin = task * kConvertGrainSize;
+        const int64_t count = std::min(kConvertGrainSize, n - begin);
+#ifdef OPEN3D_HALF_RUNTIME_F16C
+        if (HasF16C()) {
+            ConvertHalfToFloatF16C(src + begin, dst + begin, count);
+            continue;
+        }
+#endif
+        for (int64_t i = begin; i < begin + count; ++i) {
+            dst[i] = static_cast<float>(src[i]);
+        }
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+#if defined(__F16C__) && !defined(__CUDA_ARCH__)
+#include <immintrin.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+/// IEEE 754 half precision (binary16) floating point number, the scalar type
+/// of Dtype::Float16.
+///
+/// Half only stores the bits. Arithmetic converts to float, so the result of
+/// e.g. `a + b` is a float that is rounded when assigned back to a Half.
+/// The conversion uses the F16C instructions if the code is compiled with
+/// them, and a portable bit manipulation otherwise.
+class Half {
+public:
+    Half() = default;
+
+    OPEN3D_HOST_DEVICE Half(float value) : bits_(FloatToBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    /// Returns the Half with the given binary16 bits.
+    OPEN3D_HOST_DEVICE static constexpr Half FromBits(uint16_t bits) {
+        return Half(bits, FromBitsTag());
+    }
+
+    OPEN3D_HOST_DEVICE constexpr uint16_t GetBits() const { return bits_; }
+
+    /// Rounds to the nearest binary16 value, ties to even.
+    OPEN3D_HOST_DEVICE static uint16_t FloatToBits(float value) {
+#if defined(__F16C__) && !defined(__CUDA_ARCH__)
+        return static_cast<uint16_t>(
+                _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+        uint32_t x = FloatAsBits(value);
+        const uint32_t sign = x & 0x80000000u;
+        x ^= sign;
+        uint16_t bits;
+        if (x >= 0x47800000u) {
+            // Inf, NaN or too large for binary16.
+            bits = x > 0x7f800000u ? 0x7e00 : 0x7c00;
+        } else if (x < 0x38800000u) {
+            // Subnormal or zero. Adding 0.5f aligns the 10 mantissa bits at the
+            // bottom of the float and rounds to nearest even.
+            const uint32_t y = FloatAsBits(BitsAsFloat(x) + 0.5f);
+            bits = static_cast<uint16_t>(y - 0x3f000000u);
+        } else {
+            const uint32_t mantissa_odd = (x >> 13) & 1;
+            x += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff;
+            x += mantissa_odd;
+            bits = static_cast<uint16_t>(x >> 13);
+        }
+        return static_cast<uint16_t>(bits | (sign >> 16));
+#endif
+    }
+
+    OPEN3D_HOST_DEVICE static float BitsToFloat(uint16_t bits) {
+#if defined(__F16C__) && !defined(__CUDA_ARCH__)
+        return _cvtsh_ss(bits);
+#else
+        const uint32_t shifted_exponent = 0x7c00u << 13;
+        uint32_t x = (static_cast<uint32_t>(bits) & 0x7fffu) << 13;
+        const uint32_t exponent = x & shifted_exponent;
+        x += static_cast<uint32_t>(127 - 15) << 23;
+        float f;
+        if (exponent == shifted_exponent) {
+            // Inf or NaN.
+            x += static_cast<uint32_t>(128 - 16) << 23;
+            f = BitsAsFloat(x);
+        } else if (exponent == 0) {
+            // Zero or subnormal, renormalized by a float subtraction.
+            x += 1u << 23;
+            f = BitsAsFloat(x) - 6.103515625e-05f;  // 2^-14.
+        } else {
+            f = BitsAsFloat(x);
+        }
+        return (bits & 0x8000u) ? -f : f;
+#endif
+    }
+
+private:
+    OPEN3D_HOST_DEVICE static uint32_t FloatAsBits(float value) {
+#ifdef __CUDA_ARCH__
+        return __float_as_uint(value);
+#else
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+#endif
+    }
+
+    OPEN3D_HOST_DEVICE static float BitsAsFloat(uint32_t bits) {
+#ifdef __CUDA_ARCH__
+        return __uint_as_float(bits);
+#else
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+#endif
+    }
+
+    struct FromBitsTag {};
+    OPEN3D_HOST_DEVICE constexpr Half(uint16_t bits, FromBitsTag)
+        : bits_(bits) {}
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes.");
+
+/// Converts \p n contiguous floats to Half. Uses the F16C instructions when
+/// the CPU supports them, even if the code is not compiled with them.
+void ConvertFloatToHalf(const float* src, Half* dst, int64_t n);
+
+/// Converts \p n contiguous Half values to float, see ConvertFloatToHalf().
+void ConvertHalfToFloat(const Half* src, float* dst, int64_t n);
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::Half> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+    static constexpr open3d::core::Half min() {
+        return open3d::core::Half::FromBits(0x0400);
+    }
+    static constexpr open3d::core::Half max() {
+        return open3d::core::Half::FromBits(0x7bff);
+    }
+    static constexpr open3d::core::Half lowest() {
+        return open3d::core::Half::FromBits(0xfbff);
+    }
+    static constexpr open3d::core::Half epsilon() {
+        return open3d::core::Half::FromBits(0x1400);
+    }
+    static constexpr open3d::core::Half infinity() {
+        return open3d::core::Half::FromBits(0x7c00);
+    }
+    static constexpr open3d::core::Half quiet_NaN() {
+        return open3d::core::Half::FromBits(0x7e00);
+    }
+};
+
+}  // namespace std
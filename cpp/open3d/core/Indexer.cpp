@@ -110,6 +110,15 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
         utility::LogError("Unimplemented dtype policy");
     }
 
+    // Outputs are written through their TensorRef, so they must not share
+    // memory copy-on-write. Detach before converting the inputs, such that
+    // in-place operations see the same pointer for input and output.
+    for (int64_t i = 0; i < num_outputs_; ++i) {
+        if (output_tensors[i].GetBlob() != nullptr) {
+            output_tensors[i].GetBlob()->Detach();
+        }
+    }
+
     // Convert to TensorRef.
     for (int64_t i = 0; i < num_inputs_; ++i) {
         inputs_[i] = TensorRef(input_tensors[i]);
@@ -213,15 +213,23 @@ enum class DtypePolicy {
 /// // Create a float Tensor and set all elements to 100.
 /// std::vector<float> vals{0, 1, 2, 3, 4};
 /// Tensor a(vals, SizeVector{5}, Dtype::Float32);
-/// TensorIterator iter(a);
+/// TensorIterator iter(a, /*is_output=*/true);
 /// for (int64_t i = 0; i < iter.NumWorkloads(); ++i) {
 ///     *static_cast<float*>(iter.GetPtr(i)) = 100.f;
 /// }
 /// ```
 class TensorIterator {
 public:
-    TensorIterator(const Tensor& tensor)
-        : input_(TensorRef(tensor)), ndims_(tensor.NumDims()) {}
+    /// \param is_output Whether the iterator is used to write into \p tensor.
+    /// Outputs are detached from any copy-on-write share first, inputs are
+    /// read in place.
+    TensorIterator(const Tensor& tensor, bool is_output = false)
+        : ndims_(tensor.NumDims()) {
+        if (is_output && tensor.GetBlob() != nullptr) {
+            tensor.GetBlob()->Detach();
+        }
+        input_ = TensorRef(tensor);
+    }
 
     OPEN3D_HOST_DEVICE int64_t NumWorkloads() const {
         int64_t num_workloads = 1;
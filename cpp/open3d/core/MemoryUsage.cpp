@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/MemoryUsage.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+struct MemoryUsageRegistry {
+    std::mutex mutex_;
+    std::unordered_map<std::string, MemoryUsageStats> device_usage_;
+    std::unordered_map<std::string, MemoryUsageStats> tag_usage_;
+};
+
+// Never destroyed, Blobs held by static objects may be released after the
+// registry would have been.
+MemoryUsageRegistry& GetRegistry() {
+    static MemoryUsageRegistry* registry = new MemoryUsageRegistry();
+    return *registry;
+}
+
+std::string& CurrentTag() {
+    static thread_local std::string tag = "default";
+    return tag;
+}
+
+void Update(MemoryUsageStats& stats, int64_t byte_size, int64_t count) {
+    stats.current_bytes_ += byte_size;
+    stats.num_allocations_ += count;
+    stats.peak_bytes_ = std::max(stats.peak_bytes_, stats.current_bytes_);
+}
+
+}  // namespace
+
+MemoryUsageStats MemoryUsage::GetDeviceUsage(const Device& device) {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    auto it = registry.device_usage_.find(device.ToString());
+    return it == registry.device_usage_.end() ? MemoryUsageStats()
+                                              : it->second;
+}
+
+MemoryUsageStats MemoryUsage::GetTagUsage(const std::string& tag) {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    auto it = registry.tag_usage_.find(tag);
+    return it == registry.tag_usage_.end() ? MemoryUsageStats() : it->second;
+}
+
+std::unordered_map<std::string, MemoryUsageStats>
+MemoryUsage::GetAllDeviceUsage() {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return registry.device_usage_;
+}
+
+std::unordered_map<std::string, MemoryUsageStats>
+MemoryUsage::GetAllTagUsage() {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return registry.tag_usage_;
+}
+
+void MemoryUsage::ResetPeak() {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    for (auto& kv : registry.device_usage_) {
+        kv.second.peak_bytes_ = kv.second.current_bytes_;
+    }
+    for (auto& kv : registry.tag_usage_) {
+        kv.second.peak_bytes_ = kv.second.current_bytes_;
+    }
+}
+
+void MemoryUsage::RecordMalloc(int64_t byte_size,
+                               const Device& device,
+                               const std::string& tag) {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    Update(registry.device_usage_[device.ToString()], byte_size, 1);
+    Update(registry.tag_usage_[tag], byte_size, 1);
+}
+
+void MemoryUsage::RecordFree(int64_t byte_size,
+                             const Device& device,
+                             const std::string& tag) {
+    MemoryUsageRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    Update(registry.device_usage_[device.ToString()], -byte_size, -1);
+    Update(registry.tag_usage_[tag], -byte_size, -1);
+}
+
+ScopedMemoryTag::ScopedMemoryTag(const std::string& tag)
+    : prev_tag_(CurrentTag()) {
+    CurrentTag() = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() { CurrentTag() = prev_tag_; }
+
+std::string ScopedMemoryTag::GetCurrentTag() { return CurrentTag(); }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// Memory held by Blob allocations, aggregated either per device or per
+/// allocation tag. Memory shared by copy-on-write Blobs is counted once.
+struct MemoryUsageStats {
+    /// Bytes currently allocated.
+    int64_t current_bytes_ = 0;
+    /// High-water mark of current_bytes_ since the last ResetPeak().
+    int64_t peak_bytes_ = 0;
+    /// Number of live allocations.
+    int64_t num_allocations_ = 0;
+};
+
+/// Global accounting of the memory held by Tensors.
+///
+/// Every Blob that allocates its own memory (i.e. not the ones wrapping
+/// externally managed memory) is recorded at allocation and release, under
+/// its device and under the allocation tag that was active on the allocating
+/// thread, see ScopedMemoryTag. Querying is thread-safe.
+class MemoryUsage {
+public:
+    /// Usage of a single device, e.g. Device("CUDA:0").
+    static MemoryUsageStats GetDeviceUsage(const Device& device);
+
+    /// Usage of a single allocation tag, summed over all devices.
+    static MemoryUsageStats GetTagUsage(const std::string& tag);
+
+    /// Usage of all devices that have been allocated on, keyed by
+    /// Device::ToString().
+    static std::unordered_map<std::string, MemoryUsageStats>
+    GetAllDeviceUsage();
+
+    /// Usage of all allocation tags that have been allocated under.
+    static std::unordered_map<std::string, MemoryUsageStats> GetAllTagUsage();
+
+    /// Reset the peak of every device and tag to its current usage.
+    static void ResetPeak();
+
+    /// Record an allocation of \p byte_size bytes. Called by Blob.
+    static void RecordMalloc(int64_t byte_size,
+                             const Device& device,
+                             const std::string& tag);
+
+    /// Record the release of an allocation recorded by RecordMalloc().
+    static void RecordFree(int64_t byte_size,
+                           const Device& device,
+                           const std::string& tag);
+};
+
+/// Sets the allocation tag of the current thread for the lifetime of the
+/// object. Scopes nest, the innermost tag wins. Allocations outside of any
+/// scope are recorded under the tag "default".
+///
+/// ```cpp
+/// {
+///     core::ScopedMemoryTag tag("integration");
+///     // Tensors allocated here are reported under "integration".
+/// }
+/// ```
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(const std::string& tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+    /// The tag of the innermost scope on the current thread.
+    static std::string GetCurrentTag();
+
+private:
+    std::string prev_tag_;
+};
+
+}  // namespace core
+}  // namespace open3d
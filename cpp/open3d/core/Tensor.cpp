@@ -77,10 +77,16 @@ private:
         DLDataType dl_data_type;
         Dtype dtype = o3d_tensor_.GetDtype();
 
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16) {
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::Float32) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
         } else if (dtype == Dtype::Float64) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::Int8) {
+            dl_data_type.code = DLDataTypeCode::kDLInt;
+        } else if (dtype == Dtype::Int16) {
+            dl_data_type.code = DLDataTypeCode::kDLInt;
         } else if (dtype == Dtype::Int32) {
             dl_data_type.code = DLDataTypeCode::kDLInt;
         } else if (dtype == Dtype::Int64) {
@@ -99,8 +105,9 @@ private:
         // Prepare dl_tensor, this uses dl_device_type, dl_context and
         // dl_data_type prepared above.
         DLTensor dl_tensor;
-        // Not Blob's data pointer.
-        dl_tensor.data = const_cast<void*>(o3d_tensor_.GetDataPtr());
+        // Not Blob's data pointer. Consumers may write through it, so the
+        // non-const accessor detaches from any copy-on-write share.
+        dl_tensor.data = o3d_tensor_.GetDataPtr();
         dl_tensor.ctx = dl_context;
         dl_tensor.ndim = static_cast<int>(o3d_tensor_.GetShape().size());
         dl_tensor.dtype = dl_data_type;
@@ -145,7 +152,7 @@ Tensor& Tensor::operator=(const Tensor& other) & {
     strides_ = other.strides_;
     dtype_ = other.dtype_;
     blob_ = other.blob_;
-    data_ptr_ = other.data_ptr_;
+    byte_offset_ = other.byte_offset_;
     return *this;
 }
 
@@ -157,7 +164,7 @@ Tensor& Tensor::operator=(Tensor&& other) & {
     strides_ = other.strides_;
     dtype_ = other.dtype_;
     blob_ = other.blob_;
-    data_ptr_ = other.data_ptr_;
+    byte_offset_ = other.byte_offset_;
     return *this;
 }
 
@@ -209,6 +216,77 @@ Tensor Tensor::Diag(const Tensor& input) {
     return diag;
 }
 
+Tensor Tensor::Cat(const std::vector<Tensor>& tensors, int64_t dim) {
+    if (tensors.empty()) {
+        utility::LogError("Expected a non-empty list of tensors.");
+    }
+    const Tensor& first = tensors[0];
+    if (first.NumDims() == 0) {
+        utility::LogError("0-dim tensors cannot be concatenated.");
+    }
+    dim = shape_util::WrapDim(dim, first.NumDims());
+
+    SizeVector shape = first.GetShape();
+    shape[dim] = 0;
+    for (const Tensor& tensor : tensors) {
+        if (tensor.GetDtype() != first.GetDtype() ||
+            tensor.GetDevice() != first.GetDevice()) {
+            utility::LogError(
+                    "Tensors must have the same dtype and device, but got {} "
+                    "on {} and {} on {}.",
+                    first.GetDtype().ToString(), first.GetDevice().ToString(),
+                    tensor.GetDtype().ToString(),
+                    tensor.GetDevice().ToString());
+        }
+        bool compatible = tensor.NumDims() == first.NumDims();
+        for (int64_t d = 0; compatible && d < first.NumDims(); ++d) {
+            compatible = d == dim ||
+                         tensor.GetShape()[d] == first.GetShape()[d];
+        }
+        if (!compatible) {
+            utility::LogError(
+                    "Tensors must have the same shape except in dimension {}, "
+                    "but got {} and {}.",
+                    dim, first.GetShape().ToString(),
+                    tensor.GetShape().ToString());
+        }
+        shape[dim] += tensor.GetShape()[dim];
+    }
+
+    Tensor dst(shape, first.GetDtype(), first.GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& tensor : tensors) {
+        const int64_t length = tensor.GetShape()[dim];
+        if (length > 0) {
+            dst.Slice(dim, offset, offset + length) = tensor;
+        }
+        offset += length;
+    }
+    return dst;
+}
+
+Tensor Tensor::Stack(const std::vector<Tensor>& tensors, int64_t dim) {
+    if (tensors.empty()) {
+        utility::LogError("Expected a non-empty list of tensors.");
+    }
+    const SizeVector& shape = tensors[0].GetShape();
+    dim = shape_util::WrapDim(dim, tensors[0].NumDims(), /*inclusive=*/true);
+    SizeVector expanded_shape = shape;
+    expanded_shape.insert(expanded_shape.begin() + dim, 1);
+
+    std::vector<Tensor> expanded_tensors;
+    expanded_tensors.reserve(tensors.size());
+    for (const Tensor& tensor : tensors) {
+        if (tensor.GetShape() != shape) {
+            utility::LogError(
+                    "Tensors must have the same shape, but got {} and {}.",
+                    shape.ToString(), tensor.GetShape().ToString());
+        }
+        expanded_tensors.push_back(tensor.Reshape(expanded_shape));
+    }
+    return Cat(expanded_tensors, dim);
+}
+
 Tensor Tensor::GetItem(const TensorKey& tk) const {
     if (tk.GetMode() == TensorKey::TensorKeyMode::Index) {
         return IndexExtract(0, tk.GetIndex());
@@ -364,7 +442,7 @@ void Tensor::Assign(const Tensor& other) {
     dtype_ = other.dtype_;
     blob_ = std::make_shared<Blob>(shape_.NumElements() * dtype_.ByteSize(),
                                    other.GetDevice());
-    data_ptr_ = blob_->GetDataPtr();
+    byte_offset_ = 0;
     kernel::Copy(other, *this);
 }
 
@@ -450,6 +528,17 @@ Tensor Tensor::Copy(const Device& device) const {
     return dst_tensor;
 }
 
+Tensor Tensor::LazyCopy() const {
+    if (blob_ == nullptr || !blob_->IsLazyCopyable() || byte_offset_ != 0 ||
+        !IsContiguous() ||
+        NumElements() * dtype_.ByteSize() != blob_->GetByteSize()) {
+        return Copy();
+    }
+    Tensor dst_tensor(*this);
+    dst_tensor.blob_ = blob_->LazyCopy();
+    return dst_tensor;
+}
+
 Tensor Tensor::To(Dtype dtype, bool copy) const {
     if (!copy && dtype_ == dtype) {
         return *this;
@@ -465,6 +554,54 @@ Tensor Tensor::To(Dtype dtype, bool copy) const {
     return dst_tensor;
 }
 
+static bool IsQuantizedDtype(Dtype dtype) {
+    return dtype == Dtype::Int8 || dtype == Dtype::Int16 ||
+           dtype == Dtype::UInt8 || dtype == Dtype::UInt16;
+}
+
+static bool IsFloatDtype(Dtype dtype) {
+    return dtype == Dtype::Float16 || dtype == Dtype::Float32 ||
+           dtype == Dtype::Float64;
+}
+
+Tensor Tensor::Quantize(Dtype dtype, double scale, int64_t zero_point) const {
+    if (!IsFloatDtype(dtype_)) {
+        utility::LogError("Quantize expects a floating point tensor, got {}.",
+                          dtype_.ToString());
+    }
+    if (!IsQuantizedDtype(dtype)) {
+        utility::LogError(
+                "Quantize only supports Int8, Int16, UInt8 and UInt16, got "
+                "{}.",
+                dtype.ToString());
+    }
+    if (!(scale > 0)) {
+        utility::LogError("Quantization scale must be positive, got {}.",
+                          scale);
+    }
+    Tensor dst_tensor(shape_, dtype, GetDevice());
+    kernel::Quantize(*this, dst_tensor, scale, zero_point);
+    return dst_tensor;
+}
+
+Tensor Tensor::Dequantize(Dtype dtype, double scale, int64_t zero_point) const {
+    if (!IsQuantizedDtype(dtype_)) {
+        utility::LogError(
+                "Dequantize expects an Int8, Int16, UInt8 or UInt16 tensor, "
+                "got {}.",
+                dtype_.ToString());
+    }
+    if (!IsFloatDtype(dtype)) {
+        utility::LogError(
+                "Dequantize only supports Float16, Float32 and Float64, got "
+                "{}.",
+                dtype.ToString());
+    }
+    Tensor dst_tensor(shape_, dtype, GetDevice());
+    kernel::Dequantize(*this, dst_tensor, scale, zero_point);
+    return dst_tensor;
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
 void Tensor::ShallowCopyFrom(const Tensor& other) {
@@ -472,13 +609,13 @@ void Tensor::ShallowCopyFrom(const Tensor& other) {
     strides_ = other.strides_;
     dtype_ = other.dtype_;
     blob_ = other.blob_;
-    data_ptr_ = other.data_ptr_;
+    byte_offset_ = other.byte_offset_;
 }
 
 Tensor Tensor::Contiguous() const {
     if (IsContiguous()) {
         // Returns a shallow copy of the current Tensor
-        return Tensor(shape_, strides_, data_ptr_, dtype_, blob_);
+        return *this;
     } else {
         // Compact the tensor to contiguous on the same device
         return Copy(GetDevice());
@@ -573,9 +710,9 @@ std::string Tensor::ToString(bool with_suffix,
             rc << "0-element Tensor";
         } else if (shape_.size() == 0) {
             rc << indent;
-            rc << ScalarPtrToString(data_ptr_);
+            rc << ScalarPtrToString(GetDataPtr());
         } else if (shape_.size() == 1) {
-            const char* ptr = static_cast<const char*>(data_ptr_);
+            const char* ptr = static_cast<const char*>(GetDataPtr());
             rc << "[";
             std::string delim = "";
             int64_t element_byte_size = dtype_.ByteSize();
@@ -601,7 +738,8 @@ std::string Tensor::ToString(bool with_suffix,
     if (with_suffix) {
         rc << fmt::format("\nTensor[shape={}, stride={}, {}, {}, {}]",
                           shape_.ToString(), strides_.ToString(),
-                          dtype_.ToString(), GetDevice().ToString(), data_ptr_);
+                          dtype_.ToString(), GetDevice().ToString(),
+                          GetDataPtr());
     }
     return rc.str();
 }
@@ -612,6 +750,8 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == Dtype::Float16) {
+        str = fmt::format("{}", float(*static_cast<const Half*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -633,7 +773,8 @@ Tensor Tensor::IndexExtract(int64_t dim, int64_t idx) const {
     new_shape.erase(new_shape.begin() + dim);
     SizeVector new_strides(strides_);
     new_strides.erase(new_strides.begin() + dim);
-    void* new_data_ptr = static_cast<char*>(data_ptr_) +
+    void* new_data_ptr =
+            static_cast<char*>(const_cast<void*>(GetDataPtr())) +
                          strides_[dim] * dtype_.ByteSize() * idx;
     return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
 }
@@ -677,7 +818,8 @@ Tensor Tensor::Slice(int64_t dim,
         stop = shape_[dim];
     }
 
-    void* new_data_ptr = static_cast<char*>(data_ptr_) +
+    void* new_data_ptr =
+            static_cast<char*>(const_cast<void*>(GetDataPtr())) +
                          start * strides_[dim] * dtype_.ByteSize();
     SizeVector new_shape = shape_;
     SizeVector new_strides = strides_;
@@ -738,8 +880,8 @@ Tensor Tensor::Permute(const SizeVector& dims) const {
 
 Tensor Tensor::AsStrided(const SizeVector& new_shape,
                          const SizeVector& new_strides) const {
-    Tensor result(new_shape, new_strides, const_cast<void*>(data_ptr_), dtype_,
-                  blob_);
+    Tensor result(new_shape, new_strides, const_cast<void*>(GetDataPtr()),
+                  dtype_, blob_);
     return result;
 }
 
@@ -826,17 +968,19 @@ Tensor Tensor::Div_(const Tensor& value) {
     return *this;
 }
 
-Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
+Tensor Tensor::Sum(const SizeVector& dims, bool keepdim, SumMode mode) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
-    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Sum);
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Sum,
+                      mode);
     return dst;
 }
 
-Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
-    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+Tensor Tensor::Mean(const SizeVector& dims, bool keepdim, SumMode mode) const {
+    if (!IsFloatDtype(dtype_)) {
         utility::LogError(
-                "Can only compute mean for Float32 or Float64, got {} instead.",
+                "Can only compute mean for Float16, Float32 or Float64, got {} "
+                "instead.",
                 dtype_.ToString());
     }
 
@@ -846,7 +990,7 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     if (NumElements() == 0) {
         utility::LogWarning("Computing mean of 0-sized Tensor.");
     }
-    Tensor sum = Sum(dims, keepdim);
+    Tensor sum = Sum(dims, keepdim, mode);
     double factor = static_cast<double>(sum.NumElements()) / NumElements();
     return sum * factor;
 }
@@ -872,6 +1016,21 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+std::tuple<Tensor, Tensor, Tensor> Tensor::MinMaxSum(const SizeVector& dims,
+                                                     bool keepdim,
+                                                     SumMode mode) const {
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    std::vector<Tensor> dsts = {Tensor(dst_shape, dtype_, GetDevice()),
+                                Tensor(dst_shape, dtype_, GetDevice()),
+                                Tensor(dst_shape, dtype_, GetDevice())};
+    kernel::Reduction(*this, dsts, dims, keepdim,
+                      {kernel::ReductionOpCode::Min,
+                       kernel::ReductionOpCode::Max,
+                       kernel::ReductionOpCode::Sum},
+                      mode);
+    return std::make_tuple(dsts[0], dsts[1], dsts[2]);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -1092,6 +1251,84 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::ArgSort(bool descending) const {
+    return kernel::ArgSort(*this, descending);
+}
+
+Tensor Tensor::Sort(bool descending) const {
+    return IndexGet({ArgSort(descending)});
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    Tensor values, inverse, counts;
+    kernel::Unique(*this, values, inverse, counts);
+    return std::make_tuple(values, inverse, counts);
+}
+
+static Tensor SegmentReduction(const Tensor& src,
+                               const Tensor& segment_ids,
+                               int64_t num_segments,
+                               kernel::SegmentReductionOpCode op_code) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reductions need at least 1-dim tensors.");
+    }
+    const int64_t num_rows = src.GetShape()[0];
+    if (segment_ids.GetDtype() != Dtype::Int64 ||
+        segment_ids.GetShape() != SizeVector{num_rows}) {
+        utility::LogError(
+                "Segment ids must be an Int64 tensor of shape {}, but got {} "
+                "of shape {}.",
+                SizeVector{num_rows}.ToString(),
+                segment_ids.GetDtype().ToString(),
+                segment_ids.GetShape().ToString());
+    }
+    if (segment_ids.GetDevice() != src.GetDevice()) {
+        utility::LogError("Segment ids must be on device {}, but are on {}.",
+                          src.GetDevice().ToString(),
+                          segment_ids.GetDevice().ToString());
+    }
+    if (num_segments < 0) {
+        num_segments =
+                num_rows > 0 ? segment_ids[num_rows - 1].Item<int64_t>() + 1
+                             : 0;
+    }
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    kernel::SegmentReduction(src, segment_ids, dst, op_code);
+    return dst;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return SegmentReduction(*this, segment_ids, num_segments,
+                            kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& segment_ids,
+                           int64_t num_segments) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean for Float32 or Float64, got {} instead.",
+                dtype_.ToString());
+    }
+    return SegmentReduction(*this, segment_ids, num_segments,
+                            kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return SegmentReduction(*this, segment_ids, num_segments,
+                            kernel::SegmentReductionOpCode::Min);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return SegmentReduction(*this, segment_ids, num_segments,
+                            kernel::SegmentReductionOpCode::Max);
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1099,7 +1336,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1158,6 +1395,12 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLInt:
             switch (src->dl_tensor.dtype.bits) {
+                case 8:
+                    dtype = Dtype::Int8;
+                    break;
+                case 16:
+                    dtype = Dtype::Int16;
+                    break;
                 case 32:
                     dtype = Dtype::Int32;
                     break;
@@ -1171,6 +1414,9 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
@@ -1242,7 +1488,7 @@ Tensor Tensor::IsClose(const Tensor& other, double rtol, double atol) const {
 
 bool Tensor::IsSame(const Tensor& other) const {
     return blob_ == other.blob_ && shape_ == other.shape_ &&
-           strides_ == other.strides_ && data_ptr_ == other.data_ptr_ &&
+           strides_ == other.strides_ && byte_offset_ == other.byte_offset_ &&
            dtype_ == other.dtype_;
 }
 
@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 #include "open3d/core/Blob.h"
@@ -43,6 +44,18 @@
 namespace open3d {
 namespace core {
 
+/// Accumulation used by the Sum() and Mean() reductions of floating point
+/// tensors.
+enum class SumMode {
+    /// Accumulate in the dtype of the tensor.
+    Native,
+    /// Accumulate Float32 tensors in Float64. Same as Native for other dtypes.
+    Float64,
+    /// Compensated (Kahan) summation in the dtype of the tensor. Same as Native
+    /// for integer dtypes.
+    Kahan,
+};
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -57,9 +70,7 @@ public:
           strides_(DefaultStrides(shape)),
           dtype_(dtype),
           blob_(std::make_shared<Blob>(shape.NumElements() * dtype.ByteSize(),
-                                       device)) {
-        data_ptr_ = blob_->GetDataPtr();
-    }
+                                       device)) {}
 
     /// Constructor for creating a contiguous Tensor with initial values
     template <typename T>
@@ -115,7 +126,11 @@ public:
            const std::shared_ptr<Blob>& blob)
         : shape_(shape),
           strides_(strides),
-          data_ptr_(data_ptr),
+          byte_offset_(blob ? static_cast<const char*>(data_ptr) -
+                                      static_cast<const char*>(
+                                              static_cast<const Blob&>(*blob)
+                                                      .GetDataPtr())
+                            : 0),
           dtype_(dtype),
           blob_(blob) {}
 
@@ -155,7 +170,7 @@ public:
                     "Assignment with scalar only works for scalar Tensor of "
                     "shape ()");
         }
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(GetDtype(), [&]() {
             scalar_t casted_v = static_cast<scalar_t>(v);
             MemoryManager::MemcpyFromHost(GetDataPtr(), GetDevice(), &casted_v,
                                           sizeof(scalar_t));
@@ -225,6 +240,17 @@ public:
     /// Create a square matrix with specified diagonal elements in input.
     static Tensor Diag(const Tensor& input);
 
+    /// \brief Concatenate tensors along an existing dimension.
+    ///
+    /// All tensors must have the same dtype, device and number of dimensions,
+    /// and the same shape except in dimension \p dim.
+    static Tensor Cat(const std::vector<Tensor>& tensors, int64_t dim = 0);
+
+    /// \brief Stack tensors along a new dimension, which is inserted at \p dim.
+    ///
+    /// All tensors must have the same dtype, device and shape.
+    static Tensor Stack(const std::vector<Tensor>& tensors, int64_t dim = 0);
+
     /// Pythonic __getitem__ for tensor.
     ///
     /// Returns a view of the original tensor, if TensorKey is
@@ -355,6 +381,15 @@ public:
     /// Copy Tensor to the same device.
     Tensor Copy() const { return Copy(GetDevice()); };
 
+    /// Copy Tensor to the same device, copy-on-write. If the Tensor is
+    /// contiguous and spans its whole Blob, the copy shares the memory and
+    /// neither Tensor allocates until one of them is written, i.e. its data
+    /// pointer is accessed non-const. Otherwise this is the same as Copy().
+    ///
+    /// Raw pointers obtained from either Tensor before the copy bypass the
+    /// copy-on-write, writing through them is visible to both Tensors.
+    Tensor LazyCopy() const;
+
     /// Copy Tensor values to current tensor for source tensor
     void CopyFrom(const Tensor& other);
 
@@ -367,6 +402,22 @@ public:
     /// is avoided when the original tensor already have the targeted dtype.
     Tensor To(Dtype dtype, bool copy = false) const;
 
+    /// \brief Returns the affine quantization of a Float16, Float32 or
+    /// Float64 tensor, round(x / scale) + zero_point.
+    ///
+    /// Values are rounded to nearest even and saturate to the range of
+    /// \p dtype. Together with Float16, this stores attributes in 1 or 2 bytes
+    /// per value instead of 4.
+    ///
+    /// \param dtype Int8, Int16, UInt8 or UInt16.
+    /// \param scale Size of one quantization step, must be positive.
+    /// \param zero_point Quantized value of 0.
+    Tensor Quantize(Dtype dtype, double scale, int64_t zero_point = 0) const;
+
+    /// Returns (q - zero_point) * scale as the Float16, Float32 or Float64
+    /// \p dtype. This is the inverse of Quantize() up to rounding.
+    Tensor Dequantize(Dtype dtype, double scale, int64_t zero_point = 0) const;
+
     std::string ToString(bool with_suffix = true,
                          const std::string& indent = "") const;
 
@@ -451,7 +502,8 @@ public:
         }
         AssertTemplateDtype<T>();
         T value;
-        MemoryManager::MemcpyToHost(&value, data_ptr_, GetDevice(), sizeof(T));
+        MemoryManager::MemcpyToHost(&value, GetDataPtr(), GetDevice(),
+                                    sizeof(T));
         return value;
     }
 
@@ -558,12 +610,18 @@ public:
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
-    Tensor Sum(const SizeVector& dims, bool keepdim = false) const;
+    /// \param mode Accumulation of floating point sums, see SumMode.
+    Tensor Sum(const SizeVector& dims,
+               bool keepdim = false,
+               SumMode mode = SumMode::Native) const;
 
     /// Returns the mean of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
-    Tensor Mean(const SizeVector& dims, bool keepdim = false) const;
+    /// \param mode Accumulation of the sums, see SumMode.
+    Tensor Mean(const SizeVector& dims,
+                bool keepdim = false,
+                SumMode mode = SumMode::Native) const;
 
     /// Returns the product of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
@@ -580,6 +638,16 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Returns (min, max, sum) of the tensor along the given \p dims, computed
+    /// in a single pass over the tensor, e.g. for bounding boxes and centers.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    /// \param mode Accumulation of floating point sums, see SumMode.
+    std::tuple<Tensor, Tensor, Tensor> MinMaxSum(
+            const SizeVector& dims,
+            bool keepdim = false,
+            SumMode mode = SumMode::Native) const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -827,6 +895,51 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Returns the int64 indices that sort a 1-D tensor. The sort is stable,
+    /// equal elements keep their order. NaNs are treated as larger than all
+    /// other values.
+    Tensor ArgSort(bool descending = false) const;
+
+    /// Returns a sorted copy of a 1-D tensor.
+    Tensor Sort(bool descending = false) const;
+
+    /// \brief Find the unique elements of a 1-D tensor.
+    ///
+    /// \return Tuple of the unique elements in ascending order, the int64
+    /// index into the unique elements for every element of the tensor and the
+    /// int64 number of occurrences of every unique element. Indexing the
+    /// unique elements with the inverse indices gives the original tensor.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// \brief Returns the sums of the rows (slices along the first dimension)
+    /// of the tensor with the same segment id.
+    ///
+    /// This is a group-by reduction over sorted keys, e.g. the inverse indices
+    /// of Unique() after sorting the rows with ArgSort().
+    ///
+    /// \param segment_ids Int64 tensor with one id per row, sorted in
+    /// ascending order.
+    /// \param num_segments Number of rows of the result, which must be larger
+    /// than all ids. If negative, the last id plus one is used. Rows of empty
+    /// segments are zero.
+    Tensor SegmentSum(const Tensor& segment_ids,
+                      int64_t num_segments = -1) const;
+
+    /// Returns the means of the rows of the Float32 or Float64 tensor with the
+    /// same segment id. See SegmentSum().
+    Tensor SegmentMean(const Tensor& segment_ids,
+                       int64_t num_segments = -1) const;
+
+    /// Returns the minima of the rows of the tensor with the same segment id.
+    /// See SegmentSum().
+    Tensor SegmentMin(const Tensor& segment_ids,
+                      int64_t num_segments = -1) const;
+
+    /// Returns the maxima of the rows of the tensor with the same segment id.
+    /// See SegmentSum().
+    Tensor SegmentMax(const Tensor& segment_ids,
+                      int64_t num_segments = -1) const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -901,14 +1014,15 @@ public:
     std::vector<T> ToFlatVector() const {
         AssertTemplateDtype<T>();
         std::vector<T> values(NumElements());
-        MemoryManager::MemcpyToHost(values.data(), Contiguous().GetDataPtr(),
+        const Tensor contiguous = Contiguous();
+        MemoryManager::MemcpyToHost(values.data(), contiguous.GetDataPtr(),
                                     GetDevice(),
                                     GetDtype().ByteSize() * NumElements());
         return values;
     }
 
     /// Returns True if the underlying memory buffer is contiguous. A contiguous
-    /// Tensor's data_ptr_ does not need to point to the beginning of blob_.
+    /// Tensor's data pointer does not need to point to the beginning of blob_.
     inline bool IsContiguous() const {
         return DefaultStrides(shape_) == strides_;
     };
@@ -919,23 +1033,25 @@ public:
     Tensor Contiguous() const;
 
     /// Computes matrix multiplication with *this and rhs and returns the
-    /// result.
+    /// result. A 3D *this is a batch of matrices, see BatchedMatmul.
     Tensor Matmul(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with QR decomposition and returns X.
-    /// A must be a square matrix.
+    /// A must be a square matrix, or a 3D batch of square matrices.
     Tensor Solve(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with QR decomposition and returns X.
-    /// A is a (m, n) matrix with m >= n.
+    /// A is a (m, n) matrix with m >= n, or a 3D batch of such matrices.
     Tensor LeastSquares(const Tensor& rhs) const;
 
     /// Computes the matrix inversion of the square matrix *this with LU
-    /// factorization and returns the result.
+    /// factorization and returns the result. A 3D *this is inverted matrix
+    /// by matrix.
     Tensor Inverse() const;
 
     /// Computes the matrix SVD decomposition A = U S VT and returns the result.
-    /// Note VT (V transpose) is returned instead of V.
+    /// Note VT (V transpose) is returned instead of V. A 3D *this is
+    /// decomposed matrix by matrix.
     std::tuple<Tensor, Tensor, Tensor> SVD() const;
 
     /// Returns the size of the first dimension. If NumDims() == 0, an exception
@@ -958,9 +1074,20 @@ public:
         return strides_[shape_util::WrapDim(dim, NumDims())];
     }
 
-    inline void* GetDataPtr() { return data_ptr_; }
+    /// Returns the data pointer for writing. If the underlying Blob shares its
+    /// memory copy-on-write (see LazyCopy()), the memory is detached first.
+    inline void* GetDataPtr() {
+        return blob_ ? static_cast<char*>(blob_->GetDataPtr()) + byte_offset_
+                     : nullptr;
+    }
 
-    inline const void* GetDataPtr() const { return data_ptr_; }
+    /// Returns the data pointer for reading. Never detaches.
+    inline const void* GetDataPtr() const {
+        return blob_ ? static_cast<const char*>(
+                               static_cast<const Blob&>(*blob_).GetDataPtr()) +
+                               byte_offset_
+                     : nullptr;
+    }
 
     inline Dtype GetDtype() const { return dtype_; }
 
@@ -1037,12 +1164,14 @@ protected:
     /// change the shape and stride.
     SizeVector strides_ = {1};
 
-    /// Data pointer pointing to the beginning element of the Tensor.
+    /// Byte offset of the beginning element of the Tensor from the beginning
+    /// of blob_. The data pointer is always derived from blob_, so that views
+    /// keep pointing to the right memory when blob_ detaches from a
+    /// copy-on-write share.
     ///
-    /// Note that this is not necessarily the same as blob_.GetDataPtr().
-    /// When this happens, it means that the beginning element of the Tensor
-    /// is not located a the beginning of the underlying blob. This could
-    /// happen, for instance, at slicing:
+    /// The offset is not necessarily 0. When this happens, it means that the
+    /// beginning element of the Tensor is not located a the beginning of the
+    /// underlying blob. This could happen, for instance, at slicing:
     ///
     /// ```cpp
     /// // a.GetDataPtr() == a.GetBlob().GetDataPtr()
@@ -1050,7 +1179,7 @@ protected:
     /// // b.GetDataPtr() != b.GetBlob().GetDataPtr()
     /// b = a[1];
     /// ```
-    void* data_ptr_ = nullptr;
+    int64_t byte_offset_ = 0;
 
     /// Data type
     Dtype dtype_ = Dtype::Undefined;
@@ -1092,7 +1221,8 @@ inline std::vector<bool> Tensor::ToFlatVector() const {
     AssertTemplateDtype<bool>();
     std::vector<bool> values(NumElements());
     std::vector<uint8_t> values_uchar(NumElements());
-    MemoryManager::MemcpyToHost(values_uchar.data(), Contiguous().GetDataPtr(),
+    const Tensor contiguous = Contiguous();
+    MemoryManager::MemcpyToHost(values_uchar.data(), contiguous.GetDataPtr(),
                                 GetDevice(),
                                 GetDtype().ByteSize() * NumElements());
 
@@ -1111,14 +1241,14 @@ inline bool Tensor::Item() const {
     }
     AssertTemplateDtype<bool>();
     uint8_t value;
-    MemoryManager::MemcpyToHost(&value, data_ptr_, GetDevice(),
+    MemoryManager::MemcpyToHost(&value, GetDataPtr(), GetDevice(),
                                 sizeof(uint8_t));
     return static_cast<bool>(value);
 }
 
 template <typename Scalar>
 inline void Tensor::Fill(Scalar v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
@@ -26,13 +26,112 @@
 
 #include "open3d/core/TensorList.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "open3d/core/SizeVector.h"
 
 namespace open3d {
 namespace core {
 
+namespace {
+
+constexpr char kSharedMagic[8] = {'O', '3', 'D', 'T', 'L', 'S', 'T', '1'};
+constexpr int64_t kSharedMaxElementDims = 16;
+/// The elements start at a page boundary after the header.
+constexpr int64_t kSharedDataOffset = 4096;
+
+/// Header at the beginning of a shared memory segment. The size is written by
+/// the single writer after the values of the new elements.
+struct SharedTensorListHeader {
+    char magic_[8];
+    int64_t capacity_;
+    int64_t dtype_code_;
+    int64_t dtype_byte_size_;
+    char dtype_name_[16];
+    int64_t num_element_dims_;
+    int64_t element_shape_[kSharedMaxElementDims];
+    std::atomic<int64_t> size_;
+};
+static_assert(sizeof(SharedTensorListHeader) <= kSharedDataOffset,
+              "Shared tensorlist header does not fit before the data.");
+
+/// Returns the dtype with the given code and byte size, or Dtype::Undefined
+/// if it is not one of the dtypes stored in shared tensorlists.
+Dtype GetSharedDtype(int64_t dtype_code, int64_t byte_size) {
+    static const std::vector<Dtype> dtypes = {
+            Dtype::Float16, Dtype::Float32, Dtype::Float64, Dtype::Int8,
+            Dtype::Int16,   Dtype::Int32,   Dtype::Int64,   Dtype::UInt8,
+            Dtype::UInt16,  Dtype::Bool};
+    for (const Dtype& dtype : dtypes) {
+        if (static_cast<int64_t>(dtype.GetDtypeCode()) == dtype_code &&
+            dtype.ByteSize() == byte_size) {
+            return dtype;
+        }
+    }
+    return Dtype::Undefined;
+}
+
+/// Computes the size of a segment holding \p capacity elements. Returns false
+/// if a dimension is negative or the size does not fit into int64_t.
+bool GetSharedByteSize(int64_t capacity,
+                       const SizeVector& element_shape,
+                       Dtype dtype,
+                       int64_t& byte_size) {
+    const int64_t max_size = std::numeric_limits<int64_t>::max();
+    if (capacity < 0) {
+        return false;
+    }
+    int64_t data_size = dtype.ByteSize();
+    for (int64_t dim : element_shape) {
+        if (dim < 0 || (dim > 0 && data_size > max_size / dim)) {
+            return false;
+        }
+        data_size *= dim;
+    }
+    if (capacity > 0 && data_size > (max_size - kSharedDataOffset) / capacity) {
+        return false;
+    }
+    byte_size = kSharedDataOffset + capacity * data_size;
+    return true;
+}
+
+}  // unnamed namespace
+
+struct TensorList::SharedSegment {
+    SharedSegment(void* data, int64_t byte_size)
+        : data_(data), byte_size_(byte_size) {}
+    ~SharedSegment() {
+#ifndef _WIN32
+        munmap(data_, static_cast<size_t>(byte_size_));
+#endif
+    }
+    SharedSegment(const SharedSegment&) = delete;
+    SharedSegment& operator=(const SharedSegment&) = delete;
+
+    SharedTensorListHeader* GetHeader() const {
+        return static_cast<SharedTensorListHeader*>(data_);
+    }
+    void* GetElements() const {
+        return static_cast<uint8_t*>(data_) + kSharedDataOffset;
+    }
+
+    void* data_;
+    int64_t byte_size_;
+};
+
 /// Asserts that the tensor list is resizable.
 static void AssertIsResizable(const TensorList& tensorlist,
                               const std::string& func_name) {
@@ -72,6 +171,197 @@ TensorList TensorList::FromTensor(const Tensor& tensor, bool inplace) {
     }
 }
 
+TensorList TensorList::Chunked(const SizeVector& element_shape,
+                               Dtype dtype,
+                               const Device& device,
+                               int64_t chunk_size) {
+    if (chunk_size <= 0) {
+        utility::LogError("Chunk size must be positive, but got {}.",
+                          chunk_size);
+    }
+    Tensor chunk(shape_util::Concat({chunk_size}, element_shape), dtype,
+                 device);
+    TensorList tensorlist(element_shape, 0, chunk_size, chunk,
+                          /*is_resizable=*/true);
+    tensorlist.chunk_size_ = chunk_size;
+    tensorlist.chunks_ = {chunk};
+    return tensorlist;
+}
+
+#ifdef _WIN32
+TensorList TensorList::CreateShared(const std::string& name,
+                                    int64_t capacity,
+                                    const SizeVector& element_shape,
+                                    Dtype dtype) {
+    utility::LogError(
+            "Shared memory tensorlists are not supported on Windows.");
+}
+
+TensorList TensorList::OpenShared(const std::string& name) {
+    utility::LogError(
+            "Shared memory tensorlists are not supported on Windows.");
+}
+
+bool TensorList::UnlinkShared(const std::string& name) { return false; }
+#else
+TensorList TensorList::CreateShared(const std::string& name,
+                                    int64_t capacity,
+                                    const SizeVector& element_shape,
+                                    Dtype dtype) {
+    if (capacity < 0) {
+        utility::LogError("Negative tensorlist capacity {} is not supported.",
+                          capacity);
+    }
+    if (static_cast<int64_t>(element_shape.size()) > kSharedMaxElementDims) {
+        utility::LogError(
+                "Shared tensorlist element shape {} has more than {} "
+                "dimensions.",
+                element_shape, kSharedMaxElementDims);
+    }
+    if (GetSharedDtype(static_cast<int64_t>(dtype.GetDtypeCode()),
+                       dtype.ByteSize()) == Dtype::Undefined) {
+        utility::LogError("Shared tensorlist does not support dtype {}.",
+                          dtype.ToString());
+    }
+    int64_t byte_size;
+    if (!GetSharedByteSize(capacity, element_shape, dtype, byte_size) ||
+        static_cast<uint64_t>(byte_size) >
+                static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+        utility::LogError(
+                "Shared tensorlist of capacity {} and element shape {} is too "
+                "large.",
+                capacity, element_shape);
+    }
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        utility::LogError("Failed to create shared memory segment {}: {}.",
+                          name, std::strerror(errno));
+    }
+    if (ftruncate(fd, static_cast<off_t>(byte_size)) != 0) {
+        int error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        utility::LogError("Failed to resize shared memory segment {}: {}.",
+                          name, std::strerror(error));
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(byte_size),
+                      PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (data == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        utility::LogError("Failed to map shared memory segment {}: {}.", name,
+                          std::strerror(errno));
+    }
+    auto segment = std::make_shared<SharedSegment>(data, byte_size);
+
+    // ftruncate() zero-fills the segment. The magic is written last, so that
+    // OpenShared() does not accept a partially written header.
+    SharedTensorListHeader* header = segment->GetHeader();
+    header->capacity_ = capacity;
+    header->dtype_code_ = static_cast<int64_t>(dtype.GetDtypeCode());
+    header->dtype_byte_size_ = dtype.ByteSize();
+    std::strncpy(header->dtype_name_, dtype.ToString().c_str(),
+                 sizeof(header->dtype_name_) - 1);
+    header->num_element_dims_ = static_cast<int64_t>(element_shape.size());
+    std::copy(element_shape.begin(), element_shape.end(),
+              header->element_shape_);
+    header->size_.store(0, std::memory_order_release);
+    std::memcpy(header->magic_, kSharedMagic, sizeof(kSharedMagic));
+
+    SizeVector shape = shape_util::Concat({capacity}, element_shape);
+    // The blob keeps the mapping alive as long as a tensor refers to it.
+    auto blob = std::make_shared<Blob>(Device("CPU:0"),
+                                       segment->GetElements(),
+                                       [segment](void*) {});
+    Tensor internal_tensor(shape, Tensor::DefaultStrides(shape),
+                           segment->GetElements(), dtype, blob);
+    TensorList tensorlist(element_shape, 0, capacity, internal_tensor,
+                          /*is_resizable=*/true);
+    tensorlist.shared_segment_ = segment;
+    return tensorlist;
+}
+
+TensorList TensorList::OpenShared(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        utility::LogError("Failed to open shared memory segment {}: {}.", name,
+                          std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<int64_t>(st.st_size) < kSharedDataOffset) {
+        close(fd);
+        utility::LogError("Shared memory segment {} is not a tensorlist.",
+                          name);
+    }
+    const int64_t byte_size = static_cast<int64_t>(st.st_size);
+    void* data = mmap(nullptr, static_cast<size_t>(byte_size),
+                      PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        utility::LogError("Failed to map shared memory segment {}: {}.", name,
+                          std::strerror(errno));
+    }
+    auto segment = std::make_shared<SharedSegment>(data, byte_size);
+
+    const SharedTensorListHeader* header = segment->GetHeader();
+    if (std::memcmp(header->magic_, kSharedMagic, sizeof(kSharedMagic)) != 0 ||
+        header->num_element_dims_ < 0 ||
+        header->num_element_dims_ > kSharedMaxElementDims) {
+        utility::LogError("Shared memory segment {} is not a tensorlist.",
+                          name);
+    }
+    // The header is written by another process, so every field is checked
+    // before it is used.
+    SizeVector element_shape(header->element_shape_,
+                             header->element_shape_ +
+                                     header->num_element_dims_);
+    const Dtype dtype =
+            GetSharedDtype(header->dtype_code_, header->dtype_byte_size_);
+    if (dtype == Dtype::Undefined) {
+        utility::LogError(
+                "Shared memory segment {} has an unsupported dtype code {} "
+                "with byte size {}.",
+                name, header->dtype_code_, header->dtype_byte_size_);
+    }
+    const int64_t capacity = header->capacity_;
+    int64_t required_byte_size;
+    if (!GetSharedByteSize(capacity, element_shape, dtype,
+                           required_byte_size)) {
+        utility::LogError(
+                "Shared memory segment {} has an invalid capacity {} or "
+                "element shape {}.",
+                name, capacity, element_shape);
+    }
+    if (required_byte_size > byte_size) {
+        utility::LogError("Shared memory segment {} is truncated.", name);
+    }
+    const int64_t size = header->size_.load(std::memory_order_acquire);
+    if (size < 0 || size > capacity) {
+        utility::LogError(
+                "Shared memory segment {} has size {} out of range [0, {}].",
+                name, size, capacity);
+    }
+
+    SizeVector shape = shape_util::Concat({capacity}, element_shape);
+    auto blob = std::make_shared<Blob>(Device("CPU:0"),
+                                       segment->GetElements(),
+                                       [segment](void*) {});
+    Tensor internal_tensor(shape, Tensor::DefaultStrides(shape),
+                           segment->GetElements(), dtype, blob);
+    TensorList tensorlist(element_shape, size, capacity, internal_tensor,
+                          /*is_resizable=*/true);
+    tensorlist.shared_segment_ = segment;
+    return tensorlist;
+}
+
+bool TensorList::UnlinkShared(const std::string& name) {
+    return shm_unlink(name.c_str()) == 0;
+}
+#endif
+
 TensorList TensorList::Copy() const {
     TensorList copied(*this);
     copied.CopyFrom(*this);
@@ -82,6 +372,14 @@ void TensorList::CopyFrom(const TensorList& other) {
     *this = other;
     // Copy the full other.internal_tensor_, not just other.AsTensor().
     internal_tensor_ = other.internal_tensor_.Copy();
+    if (IsChunked()) {
+        chunks_[0] = internal_tensor_;
+        for (size_t i = 1; i < chunks_.size(); ++i) {
+            chunks_[i] = other.chunks_[i].Copy();
+        }
+    }
+    // The copy is private to this process.
+    shared_segment_ = nullptr;
     // After copy, the resulting tensorlist is always resizable.
     is_resizable_ = true;
 }
@@ -93,6 +391,7 @@ void TensorList::ShallowCopyFrom(const TensorList& other) {
 }
 
 Tensor TensorList::AsTensor() const {
+    AssertSingleChunk(__FUNCTION__);
     return internal_tensor_.Slice(0, 0, size_);
 }
 
@@ -102,7 +401,9 @@ void TensorList::Resize(int64_t new_size) {
     // Increase internal tensor size.
     int64_t old_size = size_;
     ResizeWithExpand(new_size);
-    internal_tensor_.Slice(0, old_size, new_size).Fill(0);
+    ForEachRange(old_size, new_size,
+                 [](const Tensor& view, int64_t) { view.AsRvalue().Fill(0); });
+    PublishSharedSize();
 }
 
 void TensorList::PushBack(const Tensor& tensor) {
@@ -123,7 +424,8 @@ void TensorList::PushBack(const Tensor& tensor) {
                           tensor.GetDevice().ToString());
     }
     ResizeWithExpand(size_ + 1);
-    internal_tensor_[size_ - 1] = tensor;  // same as operator[](-1) = tensor;
+    (*this)[size_ - 1] = tensor;
+    PublishSharedSize();
 }
 
 void TensorList::Extend(const TensorList& other) {
@@ -147,10 +449,21 @@ void TensorList::Extend(const TensorList& other) {
     int64_t other_size = other.GetSize();
     ResizeWithExpand(size_ + other_size);
 
-    // Needs to slice other since *this and other can be the same tensorlist.
-    // Assigning to a Tensor rvalue is an actual copy.
-    internal_tensor_.Slice(0, size_ - other_size, size_) =
-            other.AsTensor().Slice(0, 0, other_size);
+    // Only the first other_size elements of other are copied since *this and
+    // other can be the same tensorlist. Assigning to a Tensor rvalue is an
+    // actual copy.
+    const int64_t dst_begin = size_ - other_size;
+    other.ForEachRange(
+            0, other_size, [&](const Tensor& src, int64_t src_offset) {
+                ForEachRange(dst_begin + src_offset,
+                             dst_begin + src_offset + src.GetLength(),
+                             [&](const Tensor& dst, int64_t dst_offset) {
+                                 dst.AsRvalue() = src.Slice(
+                                         0, dst_offset,
+                                         dst_offset + dst.GetLength());
+                             });
+            });
+    PublishSharedSize();
 }
 
 TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
@@ -163,16 +476,94 @@ TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
 Tensor TensorList::operator[](int64_t index) const {
     // WrapDim asserts index is within range.
     index = shape_util::WrapDim(index, size_);
+    if (IsChunked()) {
+        std::pair<int64_t, int64_t> chunk_index = ChunkedIndex(index);
+        return chunks_[chunk_index.first][chunk_index.second];
+    }
     return internal_tensor_[index];
 }
 
 void TensorList::Clear() {
     AssertIsResizable(*this, __FUNCTION__);
-    *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    if (IsShared()) {
+        // The segment keeps its capacity.
+        size_ = 0;
+        PublishSharedSize();
+    } else if (IsChunked()) {
+        *this = Chunked(element_shape_, GetDtype(), GetDevice(), chunk_size_);
+    } else {
+        *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    }
+}
+
+void TensorList::Compact() {
+    if (!IsChunked() || chunks_.size() == 1) {
+        return;
+    }
+    int64_t reserved_size =
+            std::max(chunk_size_,
+                     (size_ + chunk_size_ - 1) / chunk_size_ * chunk_size_);
+    Tensor chunk(shape_util::Concat({reserved_size}, element_shape_),
+                 GetDtype(), GetDevice());
+    ForEachRange(0, size_, [&](const Tensor& view, int64_t offset) {
+        chunk.Slice(0, offset, offset + view.GetLength()) = view;
+    });
+    internal_tensor_ = chunk;
+    chunks_ = {chunk};
+    reserved_size_ = reserved_size;
+}
+
+void TensorList::SyncSharedSize() {
+    if (IsShared()) {
+        const int64_t size = shared_segment_->GetHeader()->size_.load(
+                std::memory_order_acquire);
+        if (size < 0 || size > reserved_size_) {
+            utility::LogError("Shared tensorlist size {} out of range [0, {}].",
+                              size, reserved_size_);
+        }
+        size_ = size;
+    }
+}
+
+Tensor TensorList::GetChunk(int64_t index) const {
+    if (!IsChunked()) {
+        if (index != 0) {
+            utility::LogError("Chunk index {} out of range [0, 1).", index);
+        }
+        return AsTensor();
+    }
+    if (index < 0 || index >= static_cast<int64_t>(chunks_.size())) {
+        utility::LogError("Chunk index {} out of range [0, {}).", index,
+                          chunks_.size());
+    }
+    const int64_t first_size = chunks_[0].GetLength();
+    const int64_t chunk_begin =
+            index == 0 ? 0 : first_size + (index - 1) * chunk_size_;
+    const int64_t num_valid =
+            std::min(chunks_[index].GetLength(),
+                     std::max<int64_t>(size_ - chunk_begin, 0));
+    return chunks_[index].Slice(0, 0, num_valid);
+}
+
+int64_t TensorList::GetNumChunks() const {
+    return IsChunked() ? static_cast<int64_t>(chunks_.size()) : 1;
 }
 
 // Protected
 void TensorList::ResizeWithExpand(int64_t new_size) {
+    if (IsChunked()) {
+        ResizeChunked(new_size);
+        return;
+    }
+    if (IsShared()) {
+        if (new_size > reserved_size_) {
+            utility::LogError(
+                    "Shared tensorlist size {} exceeds its capacity {}.",
+                    new_size, reserved_size_);
+        }
+        size_ = new_size;
+        return;
+    }
     int64_t new_reserved_size = ComputeReserveSize(new_size);
     if (new_reserved_size <= reserved_size_) {
         size_ = new_size;
@@ -188,6 +579,71 @@ void TensorList::ResizeWithExpand(int64_t new_size) {
     }
 }
 
+void TensorList::ResizeChunked(int64_t new_size) {
+    if (new_size < 0) {
+        utility::LogError("Negative tensorlist size {} is not supported.",
+                          new_size);
+    }
+    while (reserved_size_ < new_size) {
+        chunks_.emplace_back(shape_util::Concat({chunk_size_}, element_shape_),
+                             GetDtype(), GetDevice());
+        reserved_size_ += chunk_size_;
+    }
+    size_ = new_size;
+}
+
+void TensorList::ForEachRange(
+        int64_t begin,
+        int64_t end,
+        const std::function<void(const Tensor&, int64_t)>& func) const {
+    if (begin >= end) {
+        return;
+    }
+    if (!IsChunked()) {
+        func(internal_tensor_.Slice(0, begin, end), 0);
+        return;
+    }
+    int64_t chunk_begin = 0;
+    for (const Tensor& chunk : chunks_) {
+        const int64_t chunk_end = chunk_begin + chunk.GetLength();
+        const int64_t lo = std::max(begin, chunk_begin);
+        const int64_t hi = std::min(end, chunk_end);
+        if (lo < hi) {
+            func(chunk.Slice(0, lo - chunk_begin, hi - chunk_begin),
+                 lo - begin);
+        }
+        if (chunk_end >= end) {
+            break;
+        }
+        chunk_begin = chunk_end;
+    }
+}
+
+std::pair<int64_t, int64_t> TensorList::ChunkedIndex(int64_t index) const {
+    const int64_t first_size = chunks_[0].GetLength();
+    if (index < first_size) {
+        return {0, index};
+    }
+    index -= first_size;
+    return {1 + index / chunk_size_, index % chunk_size_};
+}
+
+void TensorList::AssertSingleChunk(const std::string& func_name) const {
+    if (IsChunked() && size_ > chunks_[0].GetLength()) {
+        utility::LogError(
+                "TensorList::{}: the elements of the chunked tensorlist are "
+                "stored in {} chunks. Call Compact() first.",
+                func_name, chunks_.size());
+    }
+}
+
+void TensorList::PublishSharedSize() const {
+    if (IsShared()) {
+        shared_segment_->GetHeader()->size_.store(size_,
+                                                  std::memory_order_release);
+    }
+}
+
 int64_t TensorList::ComputeReserveSize(int64_t n) {
     if (n < 0) {
         utility::LogError("Negative tensorlist size {} is not supported.", n);
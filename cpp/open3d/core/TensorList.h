@@ -27,8 +27,11 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
@@ -55,6 +58,12 @@ namespace core {
 ///   - element_shape        : (8, 8, 8)
 ///   - reserved_size        : M, where M >= N
 ///   - internal_tensor.shape: (M, 8, 8, 8)
+///
+/// A tensorlist created with Chunked() instead stores the Tensors in chunks of
+/// a fixed number of elements. Growing it allocates new chunks, so existing
+/// elements are never moved. A tensorlist created with CreateShared() or
+/// OpenShared() stores the Tensors in a POSIX shared memory segment of fixed
+/// capacity, so that several processes can exchange them without copies.
 class TensorList {
 public:
     /// Useful to support operator[] in a map.
@@ -182,6 +191,52 @@ public:
     /// tensor values will be copied when creating the tensorlist.
     static TensorList FromTensor(const Tensor& tensor, bool inplace = false);
 
+    /// Factory function to create an empty chunked tensorlist.
+    ///
+    /// The elements are stored in chunks of \p chunk_size elements. Growing
+    /// the tensorlist allocates new chunks and never moves the existing
+    /// elements, so tensors returned by operator[] keep referring to the
+    /// tensorlist's memory. AsTensor() and GetInternalTensor() require the
+    /// elements to be in a single chunk, see Compact().
+    ///
+    /// \param element_shape Shape of the contained tensors, e.g. {3,}.
+    /// \param dtype Data type of the contained tensors. e.g. Dtype::Float32.
+    /// \param device Device of the contained tensors. e.g. Device("CPU:0").
+    /// \param chunk_size Number of elements per chunk, must be positive.
+    static TensorList Chunked(const SizeVector& element_shape,
+                              Dtype dtype,
+                              const Device& device = Device("CPU:0"),
+                              int64_t chunk_size = 1024);
+
+    /// Factory function to create an empty tensorlist in a new POSIX shared
+    /// memory segment. Other processes can map the same elements with
+    /// OpenShared(). The tensorlist can grow up to \p capacity elements.
+    ///
+    /// The segment has a single writer: elements are appended by one
+    /// tensorlist, which publishes its size after the values are written.
+    /// Readers call SyncSharedSize() to see the appended elements. The segment
+    /// name exists until UnlinkShared() is called, the memory is released
+    /// after the name is unlinked and all tensorlists and tensors referring to
+    /// it are destroyed. Only supported on CPU and on POSIX systems.
+    ///
+    /// \param name Name of the segment, e.g. "/open3d_frames".
+    /// \param capacity Maximum number of elements.
+    /// \param element_shape Shape of the contained tensors, e.g. {3,}.
+    /// \param dtype Data type of the contained tensors. e.g. Dtype::Float32.
+    static TensorList CreateShared(const std::string& name,
+                                   int64_t capacity,
+                                   const SizeVector& element_shape,
+                                   Dtype dtype);
+
+    /// Factory function to map the shared memory segment \p name created by
+    /// CreateShared(). The element shape, dtype and current size are read from
+    /// the segment.
+    static TensorList OpenShared(const std::string& name);
+
+    /// Removes the name of the shared memory segment \p name. Returns false if
+    /// the segment does not exist.
+    static bool UnlinkShared(const std::string& name);
+
     /// Copy constructor for tensorlist. The internal tensor will share the same
     /// memory as the input. Also see: the copy constructor for Tensor.
     TensorList(const TensorList& other) = default;
@@ -259,6 +314,33 @@ public:
     /// size to 0. This operation is only valid for resizable tensorlist.
     void Clear();
 
+    /// Moves the elements of a chunked tensorlist into a single chunk, so that
+    /// AsTensor() can return them as one tensor. The chunk has room for at
+    /// least the current size rounded up to a multiple of the chunk size.
+    /// Tensors previously returned by operator[] no longer refer to the
+    /// tensorlist's memory. No operation for other tensorlists.
+    void Compact();
+
+    /// Reads the size published by the writer of a shared memory tensorlist.
+    /// No operation for other tensorlists.
+    void SyncSharedSize();
+
+    /// Returns the valid elements of the \p index-th chunk as a tensor sharing
+    /// memory with the tensorlist. A tensorlist that is not chunked has a
+    /// single chunk.
+    Tensor GetChunk(int64_t index) const;
+
+    /// Returns the number of allocated chunks.
+    int64_t GetNumChunks() const;
+
+    /// Returns the number of elements per chunk, or 0 if the tensorlist is not
+    /// chunked.
+    int64_t GetChunkSize() const { return chunk_size_; }
+
+    bool IsChunked() const { return chunk_size_ > 0; }
+
+    bool IsShared() const { return shared_segment_ != nullptr; }
+
     std::string ToString() const;
 
     SizeVector GetElementShape() const { return element_shape_; }
@@ -288,7 +370,10 @@ public:
 
     int64_t GetReservedSize() const { return reserved_size_; }
 
-    const Tensor& GetInternalTensor() const { return internal_tensor_; }
+    const Tensor& GetInternalTensor() const {
+        AssertSingleChunk(__FUNCTION__);
+        return internal_tensor_;
+    }
 
     bool IsResizable() const { return is_resizable_; }
 
@@ -319,6 +404,30 @@ protected:
     /// with reserved_size_ = (1 << (ceil(log2(size_)) + 1)).
     static int64_t ComputeReserveSize(int64_t size);
 
+    /// Allocates chunks until reserved_size_ >= new_size and sets the size.
+    void ResizeChunked(int64_t new_size);
+
+    /// Calls func(view, offset) for each view into the storage that holds a
+    /// part of the elements [begin, end). offset is the index of the first
+    /// element of the view relative to \p begin.
+    void ForEachRange(
+            int64_t begin,
+            int64_t end,
+            const std::function<void(const Tensor&, int64_t)>& func) const;
+
+    /// Returns (chunk index, index within the chunk) of the \p index-th
+    /// element of a chunked tensorlist.
+    std::pair<int64_t, int64_t> ChunkedIndex(int64_t index) const;
+
+    /// Asserts that the elements are stored in a single tensor.
+    void AssertSingleChunk(const std::string& func_name) const;
+
+    /// Publishes size_ to the readers of a shared memory tensorlist.
+    void PublishSharedSize() const;
+
+    /// Memory mapping of a shared memory segment, defined in TensorList.cpp.
+    struct SharedSegment;
+
 protected:
     /// The shape for each element tensor in the tensorlist.
     SizeVector element_shape_;
@@ -346,6 +455,18 @@ protected:
     /// created with pre-allocated shared buffer, the tensorlist is not
     /// resizable.
     bool is_resizable_ = true;
+
+    /// Number of elements per chunk of a chunked tensorlist, 0 otherwise.
+    int64_t chunk_size_ = 0;
+
+    /// Chunks of a chunked tensorlist, each of shape (n, *element_shape_).
+    /// The first chunk is the internal_tensor_ and can be larger than
+    /// chunk_size_ after Compact(), all other chunks have chunk_size_
+    /// elements.
+    std::vector<Tensor> chunks_;
+
+    /// Shared memory segment of a shared memory tensorlist, nullptr otherwise.
+    std::shared_ptr<SharedSegment> shared_segment_;
 };
 }  // namespace core
 }  // namespace open3d
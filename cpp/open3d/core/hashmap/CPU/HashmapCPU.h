@@ -32,6 +32,7 @@
 
 #include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
 #include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/core/kernel/ScanCPU.h"
 
 namespace open3d {
 namespace core {
@@ -187,10 +188,25 @@ void CPUHashmap<Hash, KeyEq>::Erase(const void* input_keys,
 
 template <typename Hash, typename KeyEq>
 int64_t CPUHashmap<Hash, KeyEq>::GetActiveIndices(addr_t* output_indices) {
-    int64_t count = impl_->size();
-    int64_t i = 0;
-    for (auto iter = impl_->begin(); iter != impl_->end(); ++iter, ++i) {
-        output_indices[i] = static_cast<int64_t>(iter->second);
+    // The buffer heap keeps the free addresses in [heap_counter, capacity), so
+    // the active ones are collected by compacting the complement instead of
+    // walking the hash table serially. They come out in increasing order.
+    const int64_t capacity = this->capacity_;
+    const int64_t heap_counter = buffer_ctx_->HeapCounter();
+    std::vector<uint8_t> active(capacity, 1);
+#pragma omp parallel for
+    for (int64_t i = heap_counter; i < capacity; ++i) {
+        active[buffer_ctx_->heap_[i]] = 0;
+    }
+
+    Tensor active_indices = kernel::CompactIndicesCPU(
+            capacity, [&active](int64_t i) { return active[i] != 0; });
+    const int64_t count = active_indices.GetShape()[0];
+    const int64_t* active_indices_ptr =
+            static_cast<const int64_t*>(active_indices.GetDataPtr());
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        output_indices[i] = static_cast<addr_t>(active_indices_ptr[i]);
     }
 
     return count;
@@ -181,7 +181,7 @@ void BinaryEWCPU(const Tensor& lhs,
 
     if (s_boolean_binary_ew_op_codes.find(op_code) !=
         s_boolean_binary_ew_op_codes.end()) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 // Inplace boolean op's output type is the same as the
                 // input. e.g. np.logical_and(a, b, out=a), where a, b are
@@ -203,7 +203,7 @@ void BinaryEWCPU(const Tensor& lhs,
         });
     } else {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
                     CPULauncher::LaunchBinaryEWKernel(
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -51,6 +52,14 @@ public:
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
                                       func_t element_kernel) {
+        const TensorRef* operands[1] = {&indexer.GetInput(0)};
+        if (TryLaunchStridedKernel(
+                    indexer, operands,
+                    [&](int64_t workload_idx, char* const* ptrs) {
+                        element_kernel(ptrs[0], workload_idx);
+                    })) {
+            return;
+        }
 #pragma omp parallel for schedule(static)
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
@@ -61,6 +70,14 @@ public:
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
+        const TensorRef* operands[2] = {&indexer.GetInput(0),
+                                        &indexer.GetOutput(0)};
+        if (TryLaunchStridedKernel(indexer, operands,
+                                   [&](int64_t, char* const* ptrs) {
+                                       element_kernel(ptrs[0], ptrs[1]);
+                                   })) {
+            return;
+        }
 #pragma omp parallel for schedule(static)
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
@@ -72,6 +89,16 @@ public:
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
+        const TensorRef* operands[3] = {&indexer.GetInput(0),
+                                        &indexer.GetInput(1),
+                                        &indexer.GetOutput(0)};
+        if (TryLaunchStridedKernel(indexer, operands,
+                                   [&](int64_t, char* const* ptrs) {
+                                       element_kernel(ptrs[0], ptrs[1],
+                                                      ptrs[2]);
+                                   })) {
+            return;
+        }
 #pragma omp parallel for schedule(static)
         for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
              ++workload_idx) {
@@ -179,6 +206,108 @@ public:
             element_kernel(workload_idx);
         }
     }
+
+private:
+    /// Fast path for indexers whose operands can be walked as a 2-D grid of
+    /// workloads, which covers contiguous operands, broadcast scalars (all
+    /// strides 0) and 2-D strided views such as slices and transposes. Adjacent
+    /// dimensions are merged from the innermost one out while their strides
+    /// are consistent for all operands. If at most two dimensions remain, each
+    /// thread walks a contiguous range of workloads row by row: the row and
+    /// column are computed once per range and the operand pointers are then
+    /// advanced by their byte strides, instead of being recomputed with one
+    /// division per dimension for every workload as in
+    /// Indexer::GetInputPtr().
+    ///
+    /// \param operands Input and output TensorRefs of the indexer, in the
+    /// order in which element_kernel expects their pointers.
+    /// \param element_kernel A function that takes workload_idx and the data
+    /// pointers of the NARGS operands at that workload.
+    /// \return False if the indexer does not reduce to two dimensions, in which
+    /// case nothing is launched.
+    template <int64_t NARGS, typename func_t>
+    static bool TryLaunchStridedKernel(
+            const Indexer& indexer,
+            const TensorRef* const (&operands)[NARGS],
+            func_t element_kernel) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        if (num_workloads <= 0) {
+            return true;
+        }
+
+        // dim_shapes[0] and dim_strides[0][k] is the merged innermost
+        // dimension (columns), dim_shapes[1] and dim_strides[1][k] the rows.
+        const int64_t* master_shape = indexer.GetMasterShape();
+        int64_t num_dims = 0;
+        int64_t dim_shapes[2] = {1, 1};
+        int64_t dim_strides[2][NARGS] = {};
+        for (int64_t dim = indexer.NumDims() - 1; dim >= 0; --dim) {
+            if (master_shape[dim] == 1) {
+                continue;
+            }
+            bool can_merge = num_dims > 0;
+            for (int64_t k = 0; k < NARGS && can_merge; ++k) {
+                can_merge = operands[k]->byte_strides_[dim] ==
+                            dim_shapes[num_dims - 1] *
+                                    dim_strides[num_dims - 1][k];
+            }
+            if (can_merge) {
+                dim_shapes[num_dims - 1] *= master_shape[dim];
+                continue;
+            }
+            if (num_dims == 2) {
+                return false;
+            }
+            dim_shapes[num_dims] = master_shape[dim];
+            for (int64_t k = 0; k < NARGS; ++k) {
+                dim_strides[num_dims][k] = operands[k]->byte_strides_[dim];
+            }
+            ++num_dims;
+        }
+
+        const int64_t num_cols = dim_shapes[0];
+        const int64_t* col_strides = dim_strides[0];
+        const int64_t* row_strides = dim_strides[1];
+        char* base_ptrs[NARGS];
+        for (int64_t k = 0; k < NARGS; ++k) {
+            base_ptrs[k] = static_cast<char*>(operands[k]->data_ptr_);
+        }
+
+        const int64_t num_ranges = std::min<int64_t>(
+                std::max<int64_t>(GetMaxThreads(), 1), num_workloads);
+#pragma omp parallel for schedule(static)
+        for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+            const int64_t start = num_workloads * range_idx / num_ranges;
+            const int64_t end = num_workloads * (range_idx + 1) / num_ranges;
+            const int64_t row = start / num_cols;
+            int64_t col = start % num_cols;
+
+            char* row_ptrs[NARGS];
+            char* ptrs[NARGS];
+            for (int64_t k = 0; k < NARGS; ++k) {
+                row_ptrs[k] = base_ptrs[k] + row * row_strides[k];
+            }
+            int64_t workload_idx = start;
+            while (workload_idx < end) {
+                const int64_t row_end =
+                        std::min(end, workload_idx + num_cols - col);
+                for (int64_t k = 0; k < NARGS; ++k) {
+                    ptrs[k] = row_ptrs[k] + col * col_strides[k];
+                }
+                for (; workload_idx < row_end; ++workload_idx) {
+                    element_kernel(workload_idx, ptrs);
+                    for (int64_t k = 0; k < NARGS; ++k) {
+                        ptrs[k] += col_strides[k];
+                    }
+                }
+                col = 0;
+                for (int64_t k = 0; k < NARGS; ++k) {
+                    row_ptrs[k] += row_strides[k];
+                }
+            }
+        }
+        return true;
+    }
 };
 
 }  // namespace kernel
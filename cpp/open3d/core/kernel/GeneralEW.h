@@ -40,7 +40,11 @@ enum class GeneralEWOpCode {
     TSDFTouch,
     TSDFPointExtraction,
     TSDFMeshExtraction,
-    RayCasting
+    RayCasting,
+    VertexMap,
+    NormalMap,
+    OdometryPointToPlane,
+    OdometryHybrid
 };
 
 void GeneralEW(const std::unordered_map<std::string, Tensor>& srcs,
@@ -153,6 +153,18 @@ void GeneralEWCPU(const std::unordered_map<std::string, Tensor>& srcs,
         case GeneralEWOpCode::RayCasting:
             utility::LogError("[RayCasting] Unimplemented.");
             break;
+        case GeneralEWOpCode::VertexMap:
+            CPUVertexMapKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::NormalMap:
+            CPUNormalMapKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::OdometryPointToPlane:
+            CPUOdometryPointToPlaneKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::OdometryHybrid:
+            CPUOdometryHybridKernel(srcs, dsts);
+            break;
         default:
             break;
     }
@@ -149,6 +149,18 @@ void GeneralEWCUDA(const std::unordered_map<std::string, Tensor>& srcs,
         case GeneralEWOpCode::RayCasting:
             utility::LogError("[RayCasting] Unimplemented.");
             break;
+        case GeneralEWOpCode::VertexMap:
+            CUDAVertexMapKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::NormalMap:
+            CUDANormalMapKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::OdometryPointToPlane:
+            CUDAOdometryPointToPlaneKernel(srcs, dsts);
+            break;
+        case GeneralEWOpCode::OdometryHybrid:
+            CUDAOdometryHybridKernel(srcs, dsts);
+            break;
         default:
             break;
     }
@@ -35,6 +35,7 @@
 #include "open3d/core/kernel/GeneralEWMacros.h"
 #include "open3d/core/kernel/GeneralIndexer.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
 #define OPEN3D_ATOMIC_ADD(X, Y) atomicAdd(X, Y)
@@ -42,6 +43,14 @@
 #define OPEN3D_ATOMIC_ADD(X, Y) (*X).fetch_add(Y)
 #endif
 
+// Reductions are accumulated into one global buffer with atomics on CUDA, and
+// into per-thread buffers that are summed up afterwards on CPU.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+#define OPEN3D_REDUCTION_ADD(X, Y) atomicAdd(X, Y)
+#else
+#define OPEN3D_REDUCTION_ADD(X, Y) (*(X) += (Y))
+#endif
+
 #define DISPATCH_BYTESIZE_TO_VOXEL(BYTESIZE, ...)            \
     [&] {                                                    \
         if (BYTESIZE == sizeof(ColoredVoxel32f)) {           \
@@ -50,9 +59,15 @@
         } else if (BYTESIZE == sizeof(ColoredVoxel16i)) {    \
             using voxel_t = ColoredVoxel16i;                 \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel16f)) {    \
+            using voxel_t = ColoredVoxel16f;                 \
+            return __VA_ARGS__();                            \
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16f)) {           \
+            using voxel_t = Voxel16f;                        \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -88,6 +103,90 @@ struct Voxel32f {
     }
 };
 
+/// 4-byte voxel structure.
+/// Float16 tsdf and uint16_t weight. The tsdf is in [-1, 1], where Float16
+/// keeps about 3 decimal digits.
+struct Voxel16f {
+    static const uint16_t kMaxUint16 = 65535;
+
+    Half tsdf;
+    uint16_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        tsdf = (static_cast<float>(weight) * tsdf + dsdf) / inc_wsum;
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16f] should never reach here.\n");
+    }
+};
+
+/// 10-byte voxel structure.
+/// Float16 tsdf with the uint16_t weight and colors of ColoredVoxel16i, for
+/// large scenes where the voxel blocks dominate the memory.
+struct ColoredVoxel16f {
+    static const uint16_t kMaxUint16 = 65535;
+    static constexpr float kColorFactor = 255.0f;
+
+    Half tsdf;
+    uint16_t weight;
+
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() {
+        return static_cast<float>(r / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE float GetG() {
+        return static_cast<float>(g / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE float GetB() {
+        return static_cast<float>(b / kColorFactor);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = (static_cast<float>(weight) * tsdf + dsdf) * inv_wsum;
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = (weight * tsdf + dsdf) * inv_wsum;
+        r = static_cast<uint16_t>(
+                round((weight * r + dr * kColorFactor) * inv_wsum));
+        g = static_cast<uint16_t>(
+                round((weight * g + dg * kColorFactor) * inv_wsum));
+        b = static_cast<uint16_t>(
+                round((weight * b + db * kColorFactor) * inv_wsum));
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+};
+
 /// 12-byte voxel structure.
 /// uint16_t for colors and weights, sacrifices minor accuracy but saves memory.
 /// Basically, kColorFactor=255.0 extends the range of the uint8_t input color
@@ -278,7 +377,7 @@ void CPUUnprojectKernel
 
     Tensor points({rows_strided * cols_strided, 3}, core::Dtype::Float32,
                   depth.GetDevice());
-    NDArrayIndexer point_indexer(points, 1);
+    NDArrayIndexer point_indexer(points, 1, /*is_output=*/true);
 
     // Counter
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
@@ -371,7 +470,8 @@ void CPUTSDFIntegrateKernel
     // Real data indexer
     NDArrayIndexer depth_indexer(depth, 2);
     NDArrayIndexer block_keys_indexer(block_keys, 1);
-    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4,
+                                              /*is_output=*/true);
 
     // Optional color integration
     Tensor color;
@@ -593,8 +693,8 @@ void CPUPointExtractionKernel
                         block_values.GetDevice());
     core::Tensor normals({total_count, 3}, core::Dtype::Float32,
                          block_values.GetDevice());
-    NDArrayIndexer point_indexer(points, 1);
-    NDArrayIndexer normal_indexer(normals, 1);
+    NDArrayIndexer point_indexer(points, 1, /*is_output=*/true);
+    NDArrayIndexer normal_indexer(normals, 1, /*is_output=*/true);
 
     // Reset count
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
@@ -615,7 +715,8 @@ void CPUPointExtractionKernel
                     extract_color = true;
                     colors = Tensor({total_count, 3}, core::Dtype::Float32,
                                     block_values.GetDevice());
-                    color_indexer = NDArrayIndexer(colors, 1);
+                    color_indexer =
+                            NDArrayIndexer(colors, 1, /*is_output=*/true);
                 }
 
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
@@ -816,7 +917,8 @@ void CPUMeshExtractionKernel
 
     // Real data indexer
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
-    NDArrayIndexer mesh_structure_indexer(mesh_structure, 4);
+    NDArrayIndexer mesh_structure_indexer(mesh_structure, 4,
+                                          /*is_output=*/true);
     NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
     NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
 
@@ -978,8 +1080,8 @@ void CPUMeshExtractionKernel
                          block_values.GetDevice());
 
     NDArrayIndexer block_keys_indexer(block_keys, 1);
-    NDArrayIndexer vertex_indexer(vertices, 1);
-    NDArrayIndexer normal_indexer(normals, 1);
+    NDArrayIndexer vertex_indexer(vertices, 1, /*is_output=*/true);
+    NDArrayIndexer normal_indexer(normals, 1, /*is_output=*/true);
 
     // Pass 2: extract vertices.
     DISPATCH_BYTESIZE_TO_VOXEL(
@@ -991,7 +1093,8 @@ void CPUMeshExtractionKernel
                     extract_color = true;
                     colors = Tensor({total_vtx_count, 3}, core::Dtype::Float32,
                                     block_values.GetDevice());
-                    color_indexer = NDArrayIndexer(colors, 1);
+                    color_indexer =
+                            NDArrayIndexer(colors, 1, /*is_output=*/true);
                 }
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
                                                         int64_t workload_idx) {
@@ -1139,7 +1242,7 @@ void CPUMeshExtractionKernel
 
     core::Tensor triangles({total_vtx_count * 3, 3}, core::Dtype::Int64,
                            block_values.GetDevice());
-    NDArrayIndexer triangle_indexer(triangles, 1);
+    NDArrayIndexer triangle_indexer(triangles, 1, /*is_output=*/true);
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     CUDALauncher::LaunchGeneralKernel(
@@ -1209,6 +1312,463 @@ void CPUMeshExtractionKernel
     dsts.emplace("triangles", triangles);
 }
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CUDAVertexMapKernel
+#else
+void CPUVertexMapKernel
+#endif
+        (const std::unordered_map<std::string, Tensor>& srcs,
+         std::unordered_map<std::string, Tensor>& dsts) {
+    static std::vector<std::string> src_attrs = {"depth", "intrinsics",
+                                                 "depth_max"};
+    for (auto& k : src_attrs) {
+        if (srcs.count(k) == 0) {
+            utility::LogError(
+                    "[VertexMapKernel] expected Tensor {} in srcs, but "
+                    "did not receive",
+                    k);
+        }
+    }
+
+    // Input, depth in meters.
+    Tensor depth = srcs.at("depth");
+    depth.AssertDtype(core::Dtype::Float32);
+    Tensor intrinsics = srcs.at("intrinsics");
+    float depth_max = srcs.at("depth_max").Item<float>();
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    TransformIndexer ti(intrinsics);
+
+    // Output
+    int64_t rows = depth_indexer.GetShape(0);
+    int64_t cols = depth_indexer.GetShape(1);
+    Tensor vertex_map({rows, cols, 3}, core::Dtype::Float32,
+                      depth.GetDevice());
+    NDArrayIndexer vertex_indexer(vertex_map, 2, /*is_output=*/true);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    int64_t n = rows * cols;
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t y = workload_idx / cols;
+        int64_t x = workload_idx % cols;
+
+        float d = *static_cast<float*>(depth_indexer.GetDataPtrFromCoord(x, y));
+        float* vertex =
+                static_cast<float*>(vertex_indexer.GetDataPtrFromCoord(x, y));
+        if (d > 0 && d < depth_max) {
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), d,
+                         vertex + 0, vertex + 1, vertex + 2);
+        } else {
+            vertex[0] = 0;
+            vertex[1] = 0;
+            vertex[2] = 0;
+        }
+    });
+
+    dsts.emplace("vertex_map", vertex_map);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CUDANormalMapKernel
+#else
+void CPUNormalMapKernel
+#endif
+        (const std::unordered_map<std::string, Tensor>& srcs,
+         std::unordered_map<std::string, Tensor>& dsts) {
+    if (srcs.count("vertex_map") == 0) {
+        utility::LogError(
+                "[NormalMapKernel] expected Tensor vertex_map in srcs, but "
+                "did not receive");
+    }
+
+    Tensor vertex_map = srcs.at("vertex_map");
+    vertex_map.AssertDtype(core::Dtype::Float32);
+    NDArrayIndexer vertex_indexer(vertex_map, 2);
+
+    int64_t rows = vertex_indexer.GetShape(0);
+    int64_t cols = vertex_indexer.GetShape(1);
+    Tensor normal_map({rows, cols, 3}, core::Dtype::Float32,
+                      vertex_map.GetDevice());
+    NDArrayIndexer normal_indexer(normal_map, 2, /*is_output=*/true);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    int64_t n = rows * cols;
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t y = workload_idx / cols;
+        int64_t x = workload_idx % cols;
+
+        float* normal =
+                static_cast<float*>(normal_indexer.GetDataPtrFromCoord(x, y));
+        normal[0] = 0;
+        normal[1] = 0;
+        normal[2] = 0;
+        if (y >= rows - 1 || x >= cols - 1) {
+            return;
+        }
+
+        float* v00 =
+                static_cast<float*>(vertex_indexer.GetDataPtrFromCoord(x, y));
+        float* v10 = static_cast<float*>(
+                vertex_indexer.GetDataPtrFromCoord(x + 1, y));
+        float* v01 = static_cast<float*>(
+                vertex_indexer.GetDataPtrFromCoord(x, y + 1));
+        if (v00[2] <= 0 || v10[2] <= 0 || v01[2] <= 0) {
+            return;
+        }
+
+        // Cross product of the vertical and horizontal differences, pointing
+        // towards the camera.
+        float dx[3] = {v10[0] - v00[0], v10[1] - v00[1], v10[2] - v00[2]};
+        float dy[3] = {v01[0] - v00[0], v01[1] - v00[1], v01[2] - v00[2]};
+        float nx = dy[1] * dx[2] - dy[2] * dx[1];
+        float ny = dy[2] * dx[0] - dy[0] * dx[2];
+        float nz = dy[0] * dx[1] - dy[1] * dx[0];
+        float norm = sqrt(nx * nx + ny * ny + nz * nz);
+        if (norm > 0) {
+            normal[0] = nx / norm;
+            normal[1] = ny / norm;
+            normal[2] = nz / norm;
+        }
+    });
+
+    dsts.emplace("normal_map", normal_map);
+}
+
+/// Number of values reduced by the odometry kernels: the lower triangle of
+/// J^T J (21), J^T r (6), the sum of squared residuals and the number of
+/// correspondences.
+static constexpr int64_t kOdometryReductionSize = 29;
+
+template <typename scalar_t>
+inline OPEN3D_DEVICE void DeviceAccumulateJtJ(scalar_t* reduction,
+                                              const float* J,
+                                              float r) {
+    int offset = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            OPEN3D_REDUCTION_ADD(reduction + offset, J[i] * J[j]);
+            ++offset;
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        OPEN3D_REDUCTION_ADD(reduction + 21 + i, J[i] * r);
+    }
+    OPEN3D_REDUCTION_ADD(reduction + 27, r * r);
+}
+
+// Finds the correspondence of a source vertex by projective association:
+// transforms it into the target camera, projects it and looks up the target
+// vertex. Returns false if there is none, or if the depth difference exceeds
+// depth_diff.
+inline OPEN3D_DEVICE bool DeviceGetProjectiveCorrespondence(
+        int64_t x,
+        int64_t y,
+        float depth_diff,
+        int64_t border,
+        const NDArrayIndexer& source_vertex_indexer,
+        const NDArrayIndexer& target_vertex_indexer,
+        const TransformIndexer& ti,
+        float* p,
+        int64_t* u_t,
+        int64_t* v_t) {
+    float* vs = static_cast<float*>(
+            source_vertex_indexer.GetDataPtrFromCoord(x, y));
+    if (vs[2] <= 0) {
+        return false;
+    }
+    ti.RigidTransform(vs[0], vs[1], vs[2], p + 0, p + 1, p + 2);
+    if (p[2] <= 0) {
+        return false;
+    }
+
+    float u, v;
+    ti.Project(p[0], p[1], p[2], &u, &v);
+    int64_t ui = static_cast<int64_t>(round(u));
+    int64_t vi = static_cast<int64_t>(round(v));
+    if (ui < border || vi < border ||
+        ui >= target_vertex_indexer.GetShape(1) - border ||
+        vi >= target_vertex_indexer.GetShape(0) - border) {
+        return false;
+    }
+
+    float* vt = static_cast<float*>(
+            target_vertex_indexer.GetDataPtrFromCoord(ui, vi));
+    if (vt[2] <= 0 || fabs(vt[2] - p[2]) > depth_diff) {
+        return false;
+    }
+    *u_t = ui;
+    *v_t = vi;
+    return true;
+}
+
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+// Sums up the per-thread reductions of the CPU odometry kernels.
+inline Tensor SumOdometryReduction(const std::vector<double>& reductions,
+                                   const core::Device& device) {
+    std::vector<float> reduction(kOdometryReductionSize, 0);
+    for (int64_t k = 0; k < kOdometryReductionSize; ++k) {
+        double sum = 0;
+        for (size_t offset = k; offset < reductions.size();
+             offset += kOdometryReductionSize) {
+            sum += reductions[offset];
+        }
+        reduction[k] = static_cast<float>(sum);
+    }
+    return Tensor(reduction, {kOdometryReductionSize}, core::Dtype::Float32,
+                  device);
+}
+#endif
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CUDAOdometryPointToPlaneKernel
+#else
+void CPUOdometryPointToPlaneKernel
+#endif
+        (const std::unordered_map<std::string, Tensor>& srcs,
+         std::unordered_map<std::string, Tensor>& dsts) {
+    static std::vector<std::string> src_attrs = {
+            "source_vertex_map", "target_vertex_map", "target_normal_map",
+            "intrinsics",        "extrinsics",        "depth_diff"};
+    for (auto& k : src_attrs) {
+        if (srcs.count(k) == 0) {
+            utility::LogError(
+                    "[OdometryPointToPlaneKernel] expected Tensor {} in srcs, "
+                    "but did not receive",
+                    k);
+        }
+    }
+
+    Tensor source_vertex_map = srcs.at("source_vertex_map");
+    Tensor target_vertex_map = srcs.at("target_vertex_map");
+    Tensor target_normal_map = srcs.at("target_normal_map");
+    Tensor intrinsics = srcs.at("intrinsics");
+    Tensor extrinsics = srcs.at("extrinsics");
+    float depth_diff = srcs.at("depth_diff").Item<float>();
+
+    NDArrayIndexer source_vertex_indexer(source_vertex_map, 2);
+    NDArrayIndexer target_vertex_indexer(target_vertex_map, 2);
+    NDArrayIndexer target_normal_indexer(target_normal_map, 2);
+
+    // extrinsics transforms source vertices into the target camera.
+    TransformIndexer ti(intrinsics, extrinsics);
+
+    int64_t cols = source_vertex_indexer.GetShape(1);
+    int64_t n = source_vertex_indexer.GetShape(0) * cols;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    Tensor reduction = Tensor::Zeros({kOdometryReductionSize},
+                                     core::Dtype::Float32,
+                                     source_vertex_map.GetDevice());
+    float* reduction_ptr = static_cast<float*>(reduction.GetDataPtr());
+    CUDALauncher launcher;
+#else
+    std::vector<double> reductions(
+            utility::GetMaxThreads() * kOdometryReductionSize, 0);
+    double* reductions_ptr = reductions.data();
+    CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        float* local_reduction = reduction_ptr;
+#else
+        double* local_reduction =
+                reductions_ptr +
+                utility::GetThreadNum() * kOdometryReductionSize;
+#endif
+        int64_t y = workload_idx / cols;
+        int64_t x = workload_idx % cols;
+
+        float p[3];
+        int64_t u_t, v_t;
+        if (!DeviceGetProjectiveCorrespondence(
+                    x, y, depth_diff, 0, source_vertex_indexer,
+                    target_vertex_indexer, ti, p, &u_t, &v_t)) {
+            return;
+        }
+
+        float* vt = static_cast<float*>(
+                target_vertex_indexer.GetDataPtrFromCoord(u_t, v_t));
+        float* nt = static_cast<float*>(
+                target_normal_indexer.GetDataPtrFromCoord(u_t, v_t));
+        if (nt[0] == 0 && nt[1] == 0 && nt[2] == 0) {
+            return;
+        }
+
+        // r = n^T (p - q), J = [p x n, n].
+        float r = (p[0] - vt[0]) * nt[0] + (p[1] - vt[1]) * nt[1] +
+                  (p[2] - vt[2]) * nt[2];
+        float J[6];
+        J[0] = p[1] * nt[2] - p[2] * nt[1];
+        J[1] = p[2] * nt[0] - p[0] * nt[2];
+        J[2] = p[0] * nt[1] - p[1] * nt[0];
+        J[3] = nt[0];
+        J[4] = nt[1];
+        J[5] = nt[2];
+
+        DeviceAccumulateJtJ(local_reduction, J, r);
+        OPEN3D_REDUCTION_ADD(local_reduction + 28, 1.0f);
+    });
+
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+    Tensor reduction =
+            SumOdometryReduction(reductions, source_vertex_map.GetDevice());
+#endif
+    dsts.emplace("reduction", reduction);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CUDAOdometryHybridKernel
+#else
+void CPUOdometryHybridKernel
+#endif
+        (const std::unordered_map<std::string, Tensor>& srcs,
+         std::unordered_map<std::string, Tensor>& dsts) {
+    static std::vector<std::string> src_attrs = {
+            "source_vertex_map", "source_intensity", "target_vertex_map",
+            "target_intensity",  "intrinsics",       "extrinsics",
+            "depth_diff"};
+    for (auto& k : src_attrs) {
+        if (srcs.count(k) == 0) {
+            utility::LogError(
+                    "[OdometryHybridKernel] expected Tensor {} in srcs, but "
+                    "did not receive",
+                    k);
+        }
+    }
+
+    Tensor source_vertex_map = srcs.at("source_vertex_map");
+    Tensor source_intensity = srcs.at("source_intensity");
+    Tensor target_vertex_map = srcs.at("target_vertex_map");
+    Tensor target_intensity = srcs.at("target_intensity");
+    Tensor intrinsics = srcs.at("intrinsics");
+    Tensor extrinsics = srcs.at("extrinsics");
+    float depth_diff = srcs.at("depth_diff").Item<float>();
+    source_intensity.AssertDtype(core::Dtype::Float32);
+    target_intensity.AssertDtype(core::Dtype::Float32);
+
+    NDArrayIndexer source_vertex_indexer(source_vertex_map, 2);
+    NDArrayIndexer source_intensity_indexer(source_intensity, 2);
+    NDArrayIndexer target_vertex_indexer(target_vertex_map, 2);
+    NDArrayIndexer target_intensity_indexer(target_intensity, 2);
+
+    TransformIndexer ti(intrinsics, extrinsics);
+    float fx, fy;
+    ti.GetFocalLength(&fx, &fy);
+
+    // Weights of the photometric and the geometric term, as in the legacy
+    // RGBDOdometryJacobianFromHybridTerm.
+    const float sqrt_lambda_depth = sqrt(0.968f);
+    const float sqrt_lambda_intensity = sqrt(1.0f - 0.968f);
+
+    int64_t cols = source_vertex_indexer.GetShape(1);
+    int64_t n = source_vertex_indexer.GetShape(0) * cols;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    Tensor reduction = Tensor::Zeros({kOdometryReductionSize},
+                                     core::Dtype::Float32,
+                                     source_vertex_map.GetDevice());
+    float* reduction_ptr = static_cast<float*>(reduction.GetDataPtr());
+    CUDALauncher launcher;
+#else
+    std::vector<double> reductions(
+            utility::GetMaxThreads() * kOdometryReductionSize, 0);
+    double* reductions_ptr = reductions.data();
+    CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        float* local_reduction = reduction_ptr;
+#else
+        double* local_reduction =
+                reductions_ptr +
+                utility::GetThreadNum() * kOdometryReductionSize;
+#endif
+        int64_t y = workload_idx / cols;
+        int64_t x = workload_idx % cols;
+
+        // Leave a one pixel border for the central differences.
+        float p[3];
+        int64_t u_t, v_t;
+        if (!DeviceGetProjectiveCorrespondence(
+                    x, y, depth_diff, 1, source_vertex_indexer,
+                    target_vertex_indexer, ti, p, &u_t, &v_t)) {
+            return;
+        }
+
+        auto GetIntensity = [&] OPEN3D_DEVICE(int64_t u, int64_t v) -> float {
+            return *static_cast<float*>(
+                    target_intensity_indexer.GetDataPtrFromCoord(u, v));
+        };
+        auto GetDepth = [&] OPEN3D_DEVICE(int64_t u, int64_t v) -> float {
+            return static_cast<float*>(
+                    target_vertex_indexer.GetDataPtrFromCoord(u, v))[2];
+        };
+
+        float diff_intensity =
+                GetIntensity(u_t, v_t) -
+                *static_cast<float*>(
+                        source_intensity_indexer.GetDataPtrFromCoord(x, y));
+        float diff_depth = GetDepth(u_t, v_t) - p[2];
+
+        float dIdx = 0.5f * (GetIntensity(u_t + 1, v_t) -
+                             GetIntensity(u_t - 1, v_t));
+        float dIdy = 0.5f * (GetIntensity(u_t, v_t + 1) -
+                             GetIntensity(u_t, v_t - 1));
+        float dDdx = 0, dDdy = 0;
+        float d_xp = GetDepth(u_t + 1, v_t), d_xn = GetDepth(u_t - 1, v_t);
+        float d_yp = GetDepth(u_t, v_t + 1), d_yn = GetDepth(u_t, v_t - 1);
+        if (d_xp > 0 && d_xn > 0) dDdx = 0.5f * (d_xp - d_xn);
+        if (d_yp > 0 && d_yn > 0) dDdy = 0.5f * (d_yp - d_yn);
+
+        float invz = 1.0f / p[2];
+        float c0 = dIdx * fx * invz;
+        float c1 = dIdy * fy * invz;
+        float c2 = -(c0 * p[0] + c1 * p[1]) * invz;
+        float d0 = dDdx * fx * invz;
+        float d1 = dDdy * fy * invz;
+        float d2 = -(d0 * p[0] + d1 * p[1]) * invz;
+
+        float J_I[6], J_D[6];
+        J_I[0] = sqrt_lambda_intensity * (-p[2] * c1 + p[1] * c2);
+        J_I[1] = sqrt_lambda_intensity * (p[2] * c0 - p[0] * c2);
+        J_I[2] = sqrt_lambda_intensity * (-p[1] * c0 + p[0] * c1);
+        J_I[3] = sqrt_lambda_intensity * c0;
+        J_I[4] = sqrt_lambda_intensity * c1;
+        J_I[5] = sqrt_lambda_intensity * c2;
+        float r_I = sqrt_lambda_intensity * diff_intensity;
+
+        J_D[0] = sqrt_lambda_depth * ((-p[2] * d1 + p[1] * d2) - p[1]);
+        J_D[1] = sqrt_lambda_depth * ((p[2] * d0 - p[0] * d2) + p[0]);
+        J_D[2] = sqrt_lambda_depth * (-p[1] * d0 + p[0] * d1);
+        J_D[3] = sqrt_lambda_depth * d0;
+        J_D[4] = sqrt_lambda_depth * d1;
+        J_D[5] = sqrt_lambda_depth * (d2 - 1.0f);
+        float r_D = sqrt_lambda_depth * diff_depth;
+
+        DeviceAccumulateJtJ(local_reduction, J_I, r_I);
+        DeviceAccumulateJtJ(local_reduction, J_D, r_D);
+        OPEN3D_REDUCTION_ADD(local_reduction + 28, 1.0f);
+    });
+
+#if !defined(BUILD_CUDA_MODULE) || !defined(__CUDACC__)
+    Tensor reduction =
+            SumOdometryReduction(reductions, source_vertex_map.GetDevice());
+#endif
+    dsts.emplace("reduction", reduction);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -106,6 +106,12 @@ public:
         *z_out = d_in;
     }
 
+    /// Get the focal lengths of the pinhole camera
+    OPEN3D_HOST_DEVICE void GetFocalLength(float* fx, float* fy) const {
+        *fx = fx_;
+        *fy = fy_;
+    }
+
 private:
     float extrinsic_[3][4];
 
@@ -138,7 +144,12 @@ public:
         }
     }
 
-    NDArrayIndexer(const Tensor& ndarray, int64_t active_dims) {
+    /// \param is_output Whether the indexer is used to write into \p ndarray.
+    /// Outputs are detached from any copy-on-write share first, inputs are
+    /// read in place.
+    NDArrayIndexer(const Tensor& ndarray,
+                   int64_t active_dims,
+                   bool is_output = false) {
         if (!ndarray.IsContiguous()) {
             utility::LogError(
                     "[NDArrayIndexer] Only support contiguous tensors for "
@@ -164,6 +175,9 @@ public:
         for (int64_t i = active_dims_; i < n; ++i) {
             element_byte_size_ *= shape[i];
         }
+        if (is_output && ndarray.GetBlob() != nullptr) {
+            ndarray.GetBlob()->Detach();
+        }
         ptr_ = const_cast<void*>(ndarray.GetDataPtr());
     }
 
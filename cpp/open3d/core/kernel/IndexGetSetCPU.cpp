@@ -63,7 +63,7 @@ void IndexGetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
@@ -85,7 +85,7 @@ void IndexSetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
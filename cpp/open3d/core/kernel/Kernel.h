@@ -30,7 +30,10 @@
 #include "open3d/core/kernel/GeneralEW.h"
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/core/kernel/NonZero.h"
+#include "open3d/core/kernel/Quantize.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/core/kernel/Sort.h"
 #include "open3d/core/kernel/UnaryEW.h"
 
 namespace open3d {
@@ -24,48 +24,45 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "open3d/core/Indexer.h"
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/kernel/NonZero.h"
+#include "open3d/core/kernel/ScanCPU.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+template <typename scalar_t>
+static Tensor NonZeroFlatIndices(const Tensor& src) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    return CompactIndicesCPU(src.NumElements(), [src_ptr](int64_t i) {
+        return static_cast<float>(src_ptr[i]) != 0;
+    });
+}
+
 Tensor NonZeroCPU(const Tensor& src) {
     // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
-    const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
-                });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
+    Tensor src_contiguous = src.Contiguous();
+    Tensor non_zero_indices;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src.GetDtype(), [&]() {
+        non_zero_indices = NonZeroFlatIndices<scalar_t>(src_contiguous);
     });
 
     // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
+    const SizeVector shape = src.GetShape();
     const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
-
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    const int64_t num_non_zeros = non_zero_indices.GetShape()[0];
+    const int64_t* non_zero_indices_ptr =
+            static_cast<const int64_t*>(non_zero_indices.GetDataPtr());
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
+    Tensor result({num_dims, num_non_zeros}, Dtype::Int64, src.GetDevice());
+    int64_t* result_ptr = static_cast<int64_t*>(result.GetDataPtr());
 #pragma omp parallel for schedule(static)
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
+    for (int64_t i = 0; i < num_non_zeros; i++) {
+        int64_t non_zero_index = non_zero_indices_ptr[i];
         for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
+            result_ptr[dim * num_non_zeros + i] = non_zero_index % shape[dim];
             non_zero_index = non_zero_index / shape[dim];
         }
     }
@@ -75,7 +75,7 @@ protected:
 };
 
 Tensor NonZeroCUDA(const Tensor& src) {
-    Tensor src_contiguous = src.Contiguous();
+    const Tensor src_contiguous = src.Contiguous();
     const int64_t num_elements = src_contiguous.NumElements();
     const int64_t num_bytes =
             num_elements * src_contiguous.GetDtype().ByteSize();
@@ -87,7 +87,7 @@ Tensor NonZeroCUDA(const Tensor& src) {
     thrust::device_vector<int64_t> non_zero_indices(num_elements);
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
         thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
-                src_contiguous.GetBlob()->GetDataPtr()));
+                src_contiguous.GetDataPtr()));
 
         auto it = thrust::copy_if(index_first, index_last, src_ptr,
                                   non_zero_indices.begin(),
@@ -102,7 +102,7 @@ Tensor NonZeroCUDA(const Tensor& src) {
 
     SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
     Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    TensorIterator result_iter(result, /*is_output=*/true);
 
     index_last = index_first + num_non_zeros;
     thrust::for_each(thrust::device,
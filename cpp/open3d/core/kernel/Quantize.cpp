@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Quantize.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void Quantize(const Tensor& src,
+              Tensor& dst,
+              double scale,
+              int64_t zero_point) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        QuantizeCPU(src, dst, scale, zero_point);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // Quantized on the host, there is no CUDA kernel yet.
+        const Device host("CPU:0");
+        Tensor dst_host(dst.GetShape(), dst.GetDtype(), host);
+        QuantizeCPU(src.Copy(host), dst_host, scale, zero_point);
+        dst.CopyFrom(dst_host);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Quantize: Unimplemented device");
+    }
+}
+
+void Dequantize(const Tensor& src,
+                Tensor& dst,
+                double scale,
+                int64_t zero_point) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        DequantizeCPU(src, dst, scale, zero_point);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        const Device host("CPU:0");
+        Tensor dst_host(dst.GetShape(), dst.GetDtype(), host);
+        DequantizeCPU(src.Copy(host), dst_host, scale, zero_point);
+        dst.CopyFrom(dst_host);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Dequantize: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
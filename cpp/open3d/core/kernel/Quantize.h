@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Affine quantization, dst = clamp(round(src / scale) + zero_point). Values
+/// are rounded to nearest even and saturate to the range of the dst dtype.
+///
+/// \param src Float16, Float32 or Float64 tensor.
+/// \param dst Preallocated integer tensor of the same shape and device.
+void Quantize(const Tensor& src,
+              Tensor& dst,
+              double scale,
+              int64_t zero_point);
+
+/// Inverse of Quantize(), dst = (src - zero_point) * scale.
+///
+/// \param src Integer tensor.
+/// \param dst Preallocated Float16, Float32 or Float64 tensor of the same
+/// shape and device.
+void Dequantize(const Tensor& src,
+                Tensor& dst,
+                double scale,
+                int64_t zero_point);
+
+void QuantizeCPU(const Tensor& src,
+                 Tensor& dst,
+                 double scale,
+                 int64_t zero_point);
+
+void DequantizeCPU(const Tensor& src,
+                   Tensor& dst,
+                   double scale,
+                   int64_t zero_point);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
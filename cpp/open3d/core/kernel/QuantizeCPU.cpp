@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/Quantize.h"
+#include "open3d/utility/Console.h"
+
+/// Dispatches the floating point dtypes Float16, Float32 and Float64.
+#define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)                  \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Dtype::Float16) {                  \
+            using scalar_t = open3d::core::Half;                      \
+            return __VA_ARGS__();                                     \
+        } else if (DTYPE == open3d::core::Dtype::Float32) {           \
+            using scalar_t = float;                                   \
+            return __VA_ARGS__();                                     \
+        } else if (DTYPE == open3d::core::Dtype::Float64) {           \
+            using scalar_t = double;                                  \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            utility::LogError("Unsupported data type {}, expected a " \
+                              "floating point type.",                 \
+                              DTYPE.ToString());                      \
+        }                                                             \
+    }()
+
+/// Dispatches the quantized dtypes Int8, Int16, UInt8 and UInt16.
+#define DISPATCH_QUANTIZED_DTYPE_TO_TEMPLATE(DTYPE, ...)              \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Dtype::Int8) {                     \
+            using scalar_t = int8_t;                                  \
+            return __VA_ARGS__();                                     \
+        } else if (DTYPE == open3d::core::Dtype::Int16) {             \
+            using scalar_t = int16_t;                                 \
+            return __VA_ARGS__();                                     \
+        } else if (DTYPE == open3d::core::Dtype::UInt8) {             \
+            using scalar_t = uint8_t;                                 \
+            return __VA_ARGS__();                                     \
+        } else if (DTYPE == open3d::core::Dtype::UInt16) {            \
+            using scalar_t = uint16_t;                                \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            utility::LogError("Unsupported data type {}, expected a " \
+                              "quantized type.",                      \
+                              DTYPE.ToString());                      \
+        }                                                             \
+    }()
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void QuantizeCPU(const Tensor& src,
+                 Tensor& dst,
+                 double scale,
+                 int64_t zero_point) {
+    Indexer indexer({src}, dst, DtypePolicy::NONE);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        DISPATCH_QUANTIZED_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+            using dst_t = scalar_t;
+            const double lowest =
+                    static_cast<double>(std::numeric_limits<dst_t>::lowest());
+            const double max =
+                    static_cast<double>(std::numeric_limits<dst_t>::max());
+            const double offset = static_cast<double>(zero_point);
+            CPULauncher::LaunchUnaryEWKernel(
+                    indexer, [&](const void* src, void* dst) {
+                        const double value = static_cast<double>(
+                                *static_cast<const src_t*>(src));
+                        double q = std::nearbyint(value / scale) + offset;
+                        // NaN quantizes to the zero point.
+                        q = std::isnan(q) ? offset
+                                          : std::min(std::max(q, lowest), max);
+                        *static_cast<dst_t*>(dst) = static_cast<dst_t>(q);
+                    });
+        });
+    });
+}
+
+void DequantizeCPU(const Tensor& src,
+                   Tensor& dst,
+                   double scale,
+                   int64_t zero_point) {
+    Indexer indexer({src}, dst, DtypePolicy::NONE);
+    DISPATCH_QUANTIZED_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+            using dst_t = scalar_t;
+            CPULauncher::LaunchUnaryEWKernel(
+                    indexer, [&](const void* src, void* dst) {
+                        const int64_t q = static_cast<int64_t>(
+                                *static_cast<const src_t*>(src));
+                        *static_cast<dst_t*>(dst) = static_cast<dst_t>(
+                                static_cast<double>(q - zero_point) * scale);
+                    });
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -32,11 +32,125 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+#ifdef BUILD_CUDA_MODULE
+/// The CUDA kernels accumulate in the dtype of the tensor. Float32 sums that
+/// request another SumMode are computed in Float64 instead.
+static void ReductionCUDAWithSumMode(const Tensor& src,
+                                     Tensor& dst,
+                                     const SizeVector& dims,
+                                     bool keepdim,
+                                     ReductionOpCode op_code,
+                                     SumMode sum_mode) {
+    if (op_code == ReductionOpCode::Sum && sum_mode != SumMode::Native &&
+        src.GetDtype() == Dtype::Float32) {
+        Tensor dst_float64(dst.GetShape(), Dtype::Float64, dst.GetDevice());
+        ReductionCUDA(src.To(Dtype::Float64), dst_float64, dims, keepdim,
+                      op_code);
+        dst.AsRvalue() = dst_float64.To(dst.GetDtype());
+    } else {
+        ReductionCUDA(src, dst, dims, keepdim, op_code);
+    }
+}
+#endif
+
+void Reduction(const Tensor& src,
+               std::vector<Tensor>& dsts,
+               const SizeVector& dims,
+               bool keepdim,
+               const std::vector<ReductionOpCode>& op_codes,
+               SumMode sum_mode) {
+    if (dsts.size() != op_codes.size()) {
+        utility::LogError("Expected {} output tensors but got {}.",
+                          op_codes.size(), dsts.size());
+    }
+    if (static_cast<int64_t>(op_codes.size()) > kMaxFusedReductions) {
+        utility::LogError("At most {} reductions can be fused, but got {}.",
+                          kMaxFusedReductions, op_codes.size());
+    }
+    for (const ReductionOpCode& op_code : op_codes) {
+        if (s_regular_reduce_ops.find(op_code) == s_regular_reduce_ops.end()) {
+            utility::LogError(
+                    "Only Sum, Prod, Min and Max reductions can be fused.");
+        }
+    }
+
+    SizeVector keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, true);
+    SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, false);
+    for (Tensor& dst : dsts) {
+        if (keepdim && keepdim_shape != dst.GetShape()) {
+            utility::LogError("Expected output shape {} but got {}.",
+                              keepdim_shape.ToString(),
+                              dst.GetShape().ToString());
+        }
+        if (!keepdim && non_keepdim_shape != dst.GetShape()) {
+            utility::LogError("Expected output shape {} but got {}.",
+                              non_keepdim_shape.ToString(),
+                              dst.GetShape().ToString());
+        }
+        if (src.GetDtype() != dst.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              src.GetDtype().ToString(),
+                              dst.GetDtype().ToString());
+        }
+        if (src.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    // Directly copy for non-reduction.
+    if (dims.size() == 0) {
+        for (Tensor& dst : dsts) {
+            dst.AsRvalue() = src;
+        }
+        return;
+    }
+
+    // Always reshape to keepdim case. This reshaping is copy-free.
+    if (!keepdim) {
+        for (Tensor& dst : dsts) {
+            dst = dst.Reshape(keepdim_shape);
+        }
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ReductionCPU(src, dsts, dims, op_codes, sum_mode);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        for (size_t i = 0; i < op_codes.size(); ++i) {
+            ReductionCUDAWithSumMode(src, dsts[i], dims, keepdim, op_codes[i],
+                                     sum_mode);
+        }
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    if (!keepdim) {
+        for (Tensor& dst : dsts) {
+            dst = dst.Reshape(non_keepdim_shape);
+        }
+    }
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
-               ReductionOpCode op_code) {
+               ReductionOpCode op_code,
+               SumMode sum_mode) {
+    if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
+        std::vector<Tensor> dsts = {dst};
+        Reduction(src, dsts, dims, keepdim, {op_code}, sum_mode);
+        return;
+    }
+
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
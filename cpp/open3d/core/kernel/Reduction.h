@@ -27,6 +27,7 @@
 #pragma once
 
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
@@ -66,11 +67,27 @@ static const std::unordered_set<ReductionOpCode, utility::hash_enum_class>
                 ReductionOpCode::Any,
 };
 
+/// Maximum number of reductions that Reduction() fuses into one pass.
+static constexpr int64_t kMaxFusedReductions = 4;
+
+/// Reduces \p src over \p dims into \p dst. Sum reductions accumulate
+/// floating point values with \p sum_mode.
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
-               ReductionOpCode op_code);
+               ReductionOpCode op_code,
+               SumMode sum_mode = SumMode::Native);
+
+/// Computes several regular reductions (Sum, Prod, Min or Max) of \p src over
+/// the same \p dims, writing the result of op_codes[i] to dsts[i]. On CPU, all
+/// results are computed in a single pass over \p src.
+void Reduction(const Tensor& src,
+               std::vector<Tensor>& dsts,
+               const SizeVector& dims,
+               bool keepdim,
+               const std::vector<ReductionOpCode>& op_codes,
+               SumMode sum_mode = SumMode::Native);
 
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
@@ -78,6 +95,13 @@ void ReductionCPU(const Tensor& src,
                   bool keepdim,
                   ReductionOpCode op_code);
 
+/// \p dsts must have the keepdim shape.
+void ReductionCPU(const Tensor& src,
+                  std::vector<Tensor>& dsts,
+                  const SizeVector& dims,
+                  const std::vector<ReductionOpCode>& op_codes,
+                  SumMode sum_mode);
+
 #ifdef BUILD_CUDA_MODULE
 void ReductionCUDA(const Tensor& src,
                    Tensor& dst,
@@ -24,7 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
@@ -37,33 +42,190 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+template <typename scalar_t, typename acc_t = scalar_t>
+struct CPUSumReducer {
+    using AccType = acc_t;
+    acc_t Identity() const { return static_cast<acc_t>(0); }
+    void Reduce(acc_t& acc, scalar_t value) const {
+        acc = acc + static_cast<acc_t>(value);
+    }
+    void Combine(acc_t& acc, const acc_t& other) const { acc = acc + other; }
+    scalar_t Project(const acc_t& acc, int64_t) const {
+        return static_cast<scalar_t>(acc);
+    }
+};
+
+/// Compensated summation: the compensation carries the low-order bits lost
+/// when adding a value to the running sum.
 template <typename scalar_t>
-static inline scalar_t CPUSumReductionKernel(scalar_t a, scalar_t b) {
-    return a + b;
-}
+struct CPUKahanSumReducer {
+    struct AccType {
+        scalar_t sum;
+        scalar_t compensation;
+    };
+    AccType Identity() const { return {0, 0}; }
+    void Reduce(AccType& acc, scalar_t value) const {
+        scalar_t y = value - acc.compensation;
+        scalar_t t = acc.sum + y;
+        // Keeps infinite sums from turning into NaN through inf - inf.
+        acc.compensation = std::isfinite(t) ? (t - acc.sum) - y : 0;
+        acc.sum = t;
+    }
+    void Combine(AccType& acc, const AccType& other) const {
+        Reduce(acc, other.sum);
+        Reduce(acc, -other.compensation);
+    }
+    scalar_t Project(const AccType& acc, int64_t) const {
+        return acc.sum - acc.compensation;
+    }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUProdReductionKernel(scalar_t a, scalar_t b) {
-    return a * b;
-}
+struct CPUProdReducer {
+    using AccType = scalar_t;
+    scalar_t Identity() const { return static_cast<scalar_t>(1); }
+    void Reduce(scalar_t& acc, scalar_t value) const { acc = acc * value; }
+    void Combine(scalar_t& acc, const scalar_t& other) const {
+        acc = acc * other;
+    }
+    scalar_t Project(const scalar_t& acc, int64_t) const { return acc; }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUMinReductionKernel(scalar_t a, scalar_t b) {
-    return std::min(a, b);
-}
+struct CPUMinReducer {
+    using AccType = scalar_t;
+    scalar_t Identity() const { return std::numeric_limits<scalar_t>::max(); }
+    void Reduce(scalar_t& acc, scalar_t value) const {
+        acc = std::min(acc, value);
+    }
+    void Combine(scalar_t& acc, const scalar_t& other) const {
+        acc = std::min(acc, other);
+    }
+    scalar_t Project(const scalar_t& acc, int64_t) const { return acc; }
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUMaxReductionKernel(scalar_t a, scalar_t b) {
-    return std::max(a, b);
-}
+struct CPUMaxReducer {
+    using AccType = scalar_t;
+    scalar_t Identity() const {
+        return std::numeric_limits<scalar_t>::lowest();
+    }
+    void Reduce(scalar_t& acc, scalar_t value) const {
+        acc = std::max(acc, value);
+    }
+    void Combine(scalar_t& acc, const scalar_t& other) const {
+        acc = std::max(acc, other);
+    }
+    scalar_t Project(const scalar_t& acc, int64_t) const { return acc; }
+};
 
-static inline uint8_t CPUAllReductionKernel(uint8_t a, uint8_t b) {
-    return a && b;
-}
+struct CPUAllReducer {
+    using AccType = bool;
+    bool Identity() const { return true; }
+    void Reduce(bool& acc, bool value) const { acc = acc && value; }
+    void Combine(bool& acc, const bool& other) const { acc = acc && other; }
+    bool Project(const bool& acc, int64_t) const { return acc; }
+};
 
-static inline uint8_t CPUAnyReductionKernel(uint8_t a, uint8_t b) {
-    return a || b;
-}
+struct CPUAnyReducer {
+    using AccType = bool;
+    bool Identity() const { return false; }
+    void Reduce(bool& acc, bool value) const { acc = acc || value; }
+    void Combine(bool& acc, const bool& other) const { acc = acc || other; }
+    bool Project(const bool& acc, int64_t) const { return acc; }
+};
+
+/// Up to kMaxFusedReductions regular reductions of the same input, selected at
+/// runtime. The i-th output is the result of the i-th op code.
+template <typename scalar_t, typename acc_t>
+class CPUFusedReducer {
+public:
+    struct AccType {
+        acc_t values[kMaxFusedReductions];
+        acc_t compensations[kMaxFusedReductions];
+    };
+
+    CPUFusedReducer(const std::vector<ReductionOpCode>& op_codes, bool kahan)
+        : num_ops_(static_cast<int64_t>(op_codes.size())), kahan_(kahan) {
+        for (int64_t i = 0; i < num_ops_; ++i) {
+            op_codes_[i] = op_codes[i];
+        }
+    }
+
+    AccType Identity() const {
+        AccType acc;
+        for (int64_t i = 0; i < num_ops_; ++i) {
+            acc.compensations[i] = 0;
+            switch (op_codes_[i]) {
+                case ReductionOpCode::Sum:
+                    acc.values[i] = 0;
+                    break;
+                case ReductionOpCode::Prod:
+                    acc.values[i] = 1;
+                    break;
+                case ReductionOpCode::Min:
+                    acc.values[i] = static_cast<acc_t>(
+                            std::numeric_limits<scalar_t>::max());
+                    break;
+                default:
+                    acc.values[i] = static_cast<acc_t>(
+                            std::numeric_limits<scalar_t>::lowest());
+                    break;
+            }
+        }
+        return acc;
+    }
+
+    void Reduce(AccType& acc, scalar_t value) const {
+        for (int64_t i = 0; i < num_ops_; ++i) {
+            Update(acc, i, static_cast<acc_t>(value));
+        }
+    }
+
+    void Combine(AccType& acc, const AccType& other) const {
+        for (int64_t i = 0; i < num_ops_; ++i) {
+            Update(acc, i, other.values[i]);
+            if (kahan_ && op_codes_[i] == ReductionOpCode::Sum) {
+                Update(acc, i, -other.compensations[i]);
+            }
+        }
+    }
+
+    scalar_t Project(const AccType& acc, int64_t i) const {
+        return static_cast<scalar_t>(acc.values[i] - acc.compensations[i]);
+    }
+
+private:
+    void Update(AccType& acc, int64_t i, acc_t value) const {
+        acc_t& current = acc.values[i];
+        switch (op_codes_[i]) {
+            case ReductionOpCode::Sum:
+                if (kahan_) {
+                    acc_t& compensation = acc.compensations[i];
+                    acc_t y = value - compensation;
+                    acc_t t = current + y;
+                    compensation = std::isfinite(t) ? (t - current) - y : 0;
+                    current = t;
+                } else {
+                    current = current + value;
+                }
+                break;
+            case ReductionOpCode::Prod:
+                current = current * value;
+                break;
+            case ReductionOpCode::Min:
+                current = std::min(current, value);
+                break;
+            default:
+                current = std::max(current, value);
+                break;
+        }
+    }
+
+    int64_t num_ops_;
+    ReductionOpCode op_codes_[kMaxFusedReductions];
+    bool kahan_;
+};
 
 template <typename scalar_t>
 static inline std::pair<int64_t, scalar_t> CPUArgMinReductionKernel(
@@ -85,113 +247,293 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Reduces a tensor over an arbitrary set of dimensions with a reducer.
+///
+/// The non-reduced ("output") and reduced dimensions of the source are each
+/// merged where their strides allow it, so that e.g. a contiguous tensor
+/// reduced over its trailing dimensions becomes a single output dimension and
+/// a single reduced dimension. The work is split into tasks, each of which
+/// covers a tile of up to kOutputTileSize consecutive outputs and a chunk of
+/// the reduced elements. The reduction is only chunked if there are fewer
+/// output tiles than threads, in which case the partial results of the chunks
+/// are combined in order afterwards. Within a task, the reduced elements are
+/// visited in the outer loop when the output dimension has the smaller source
+/// stride, so that neighbouring outputs are read from neighbouring memory.
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
     CPUReductionEngine& operator=(const CPUReductionEngine&) = delete;
-    CPUReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
 
-    template <typename func_t, typename scalar_t>
-    void Run(const func_t& reduce_func, scalar_t identity) {
-        // See: PyTorch's TensorIterator::parallel_reduce for the reference
-        // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
-        } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+    /// \param dsts Output tensors with the keepdim shape of the reduction.
+    CPUReductionEngine(const Tensor& src,
+                       const std::vector<Tensor>& dsts,
+                       const SizeVector& dims)
+        : src_(src), dsts_(dsts) {
+        // Non-const GetDataPtr() detaches shared outputs, which is not
+        // thread-safe, so the output pointers are fetched once here.
+        for (Tensor& dst : dsts_) {
+            dst_ptrs_.push_back(dst.GetDataPtr());
+        }
+        const int64_t ndims = src.NumDims();
+        if (ndims > MAX_DIMS) {
+            utility::LogError("NumDims() {} exceeds MAX_DIMS {}.", ndims,
+                              MAX_DIMS);
+        }
+        const SizeVector& shape = src.GetShape();
+        const SizeVector& strides = src.GetStrides();
+        std::vector<bool> is_reduction_dim(ndims, false);
+        for (int64_t dim : dims) {
+            is_reduction_dim[shape_util::WrapDim(dim, ndims)] = true;
         }
-    }
 
-private:
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
+        // Reduced dimensions are visited with the smallest stride innermost.
+        std::vector<int64_t> reduction_dims;
+        for (int64_t dim = 0; dim < ndims; ++dim) {
+            if (is_reduction_dim[dim]) {
+                reduction_dims.push_back(dim);
+            }
+        }
+        std::stable_sort(reduction_dims.begin(), reduction_dims.end(),
+                         [&](int64_t a, int64_t b) {
+                             return std::abs(strides[a]) > std::abs(strides[b]);
+                         });
+        for (auto it = reduction_dims.rbegin(); it != reduction_dims.rend();
+             ++it) {
+            AddDim(reduction_, shape[*it], strides[*it], nullptr);
+        }
+
+        // Output dimensions keep the row-major order of the outputs.
+        for (int64_t dim = ndims - 1; dim >= 0; --dim) {
+            if (!is_reduction_dim[dim]) {
+                int64_t dst_strides[kMaxFusedReductions];
+                for (size_t i = 0; i < dsts.size(); ++i) {
+                    dst_strides[i] = dsts[i].GetStrides()[dim];
+                }
+                AddDim(output_, shape[dim], strides[dim], dst_strides);
+            }
         }
     }
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
-        if (indexer.NumOutputElements() > 1) {
-            utility::LogError(
-                    "Internal error: two-pass reduction only works for "
-                    "single-output reduction ops.");
+    template <typename scalar_t, typename reducer_t>
+    void Run(const reducer_t& reducer) {
+        using acc_t = typename reducer_t::AccType;
+        const int64_t num_outputs = output_.NumElements();
+        const int64_t num_reduced = reduction_.NumElements();
+        if (num_outputs == 0) {
+            return;
         }
-        int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+        const int64_t num_threads =
+                GetMaxThreads() == 1 || InParallel() ? 1 : GetMaxThreads();
+        const int64_t num_tiles =
+                (num_outputs + kOutputTileSize - 1) / kOutputTileSize;
+        int64_t num_chunks = 1;
+        if (num_tiles < num_threads) {
+            num_chunks = std::min((num_threads + num_tiles - 1) / num_tiles,
+                                  num_reduced / kReductionGrainSize);
+            num_chunks = std::max<int64_t>(num_chunks, 1);
+        }
+        const bool outputs_inner =
+                output_.ndims_ > 0 && reduction_.ndims_ > 0 &&
+                std::abs(output_.src_strides_[0]) <
+                        std::abs(reduction_.src_strides_[0]);
+
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_.GetDataPtr());
+        std::vector<acc_t> partials(num_chunks > 1 ? num_chunks * num_outputs
+                                                   : 0);
+
+#pragma omp parallel for schedule(static) if (num_threads > 1)
+        for (int64_t task = 0; task < num_tiles * num_chunks; ++task) {
+            const int64_t tile = task / num_chunks;
+            const int64_t chunk = task % num_chunks;
+            const int64_t output_start = tile * kOutputTileSize;
+            const int64_t tile_size = std::min(kOutputTileSize,
+                                               num_outputs - output_start);
+            const int64_t reduced_start = num_reduced * chunk / num_chunks;
+            const int64_t reduced_end = num_reduced * (chunk + 1) / num_chunks;
+
+            acc_t accs[kOutputTileSize];
+            int64_t src_offsets[kOutputTileSize];
+            for (int64_t i = 0; i < tile_size; ++i) {
+                accs[i] = reducer.Identity();
+                src_offsets[i] = output_.SrcOffset(output_start + i);
+            }
+
+            if (outputs_inner) {
+                reduction_.ForEach(
+                        reduced_start, reduced_end, [&](int64_t offset) {
+                            const scalar_t* ptr = src_ptr + offset;
+                            for (int64_t i = 0; i < tile_size; ++i) {
+                                reducer.Reduce(accs[i], ptr[src_offsets[i]]);
+                            }
+                        });
+            } else {
+                for (int64_t i = 0; i < tile_size; ++i) {
+                    const scalar_t* ptr = src_ptr + src_offsets[i];
+                    acc_t& acc = accs[i];
+                    reduction_.ForEach(reduced_start, reduced_end,
+                                       [&](int64_t offset) {
+                                           reducer.Reduce(acc, ptr[offset]);
+                                       });
+                }
+            }
+
+            if (num_chunks == 1) {
+                for (int64_t i = 0; i < tile_size; ++i) {
+                    Write<scalar_t>(reducer, output_start + i, accs[i]);
+                }
+            } else {
+                std::copy(accs, accs + tile_size,
+                          partials.begin() + chunk * num_outputs +
+                                  output_start);
             }
         }
-        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+
+        if (num_chunks > 1) {
+#pragma omp parallel for schedule(static) if (num_threads > 1)
+            for (int64_t output_idx = 0; output_idx < num_outputs;
+                 ++output_idx) {
+                acc_t acc = partials[output_idx];
+                for (int64_t chunk = 1; chunk < num_chunks; ++chunk) {
+                    reducer.Combine(acc,
+                                    partials[chunk * num_outputs + output_idx]);
+                }
+                Write<scalar_t>(reducer, output_idx, acc);
+            }
         }
     }
 
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
-        // Prefers outer dimension >= num_threads.
-        const int64_t* indexer_shape = indexer.GetMasterShape();
-        const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
-
-        // Init best_dim as the outer-most non-reduction dim.
-        int64_t best_dim = num_dims - 1;
-        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
-            best_dim--;
+private:
+    /// Number of consecutive outputs reduced together by one task.
+    static constexpr int64_t kOutputTileSize = 64;
+    /// Minimum number of reduced elements per chunk of a split reduction.
+    static constexpr int64_t kReductionGrainSize = 32768;
+
+    /// Merged dimensions, innermost first, with the source strides and, for
+    /// output dimensions, the strides of each output tensor.
+    struct Dims {
+        int64_t ndims_ = 0;
+        int64_t shape_[MAX_DIMS];
+        int64_t src_strides_[MAX_DIMS];
+        int64_t dst_strides_[kMaxFusedReductions][MAX_DIMS];
+
+        int64_t NumElements() const {
+            int64_t num_elements = 1;
+            for (int64_t d = 0; d < ndims_; ++d) {
+                num_elements *= shape_[d];
+            }
+            return num_elements;
         }
-        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
-             --dim) {
-            if (indexer_shape[dim] >= num_threads) {
-                best_dim = dim;
-                break;
-            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
-                best_dim = dim;
+
+        int64_t SrcOffset(int64_t idx) const {
+            int64_t offset = 0;
+            for (int64_t d = 0; d < ndims_; ++d) {
+                offset += idx % shape_[d] * src_strides_[d];
+                idx /= shape_[d];
             }
+            return offset;
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
+
+        int64_t DstOffset(int64_t idx, int64_t dst_idx) const {
+            int64_t offset = 0;
+            for (int64_t d = 0; d < ndims_; ++d) {
+                offset += idx % shape_[d] * dst_strides_[dst_idx][d];
+                idx /= shape_[d];
+            }
+            return offset;
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        /// Calls func(src_offset) for the elements [start, end), walking the
+        /// innermost dimension with a running offset.
+        template <typename func_t>
+        void ForEach(int64_t start, int64_t end, const func_t& func) const {
+            if (start >= end) {
+                return;
+            }
+            if (ndims_ == 0) {
+                func(0);
+                return;
+            }
+            int64_t coords[MAX_DIMS];
+            int64_t idx = start;
+            int64_t offset = 0;
+            for (int64_t d = 0; d < ndims_; ++d) {
+                coords[d] = idx % shape_[d];
+                offset += coords[d] * src_strides_[d];
+                idx /= shape_[d];
+            }
+            const int64_t inner_size = shape_[0];
+            const int64_t inner_stride = src_strides_[0];
+            for (int64_t i = start; i < end;) {
+                const int64_t n = std::min(end - i, inner_size - coords[0]);
+                for (int64_t j = 0; j < n; ++j) {
+                    func(offset + j * inner_stride);
+                }
+                i += n;
+                if (i == end) {
+                    break;
+                }
+                // Carry into the outer dimensions.
+                offset -= coords[0] * inner_stride;
+                coords[0] = 0;
+                for (int64_t d = 1; d < ndims_; ++d) {
+                    offset += src_strides_[d];
+                    if (++coords[d] < shape_[d]) {
+                        break;
+                    }
+                    offset -= coords[d] * src_strides_[d];
+                    coords[d] = 0;
+                }
+            }
+        }
+    };
+
+    /// Appends a dimension outside of the current outermost one, merging the
+    /// two if the strides are consistent. Dimensions of size 1 are skipped.
+    void AddDim(Dims& dims,
+                int64_t size,
+                int64_t src_stride,
+                const int64_t* dst_strides) {
+        if (size == 1) {
+            return;
         }
+        const int64_t num_dsts = dst_strides ? dsts_.size() : 0;
+        if (dims.ndims_ > 0) {
+            const int64_t last = dims.ndims_ - 1;
+            bool can_merge = src_stride ==
+                             dims.shape_[last] * dims.src_strides_[last];
+            for (int64_t i = 0; i < num_dsts && can_merge; ++i) {
+                can_merge = dst_strides[i] ==
+                            dims.shape_[last] * dims.dst_strides_[i][last];
+            }
+            if (can_merge) {
+                dims.shape_[last] *= size;
+                return;
+            }
+        }
+        dims.shape_[dims.ndims_] = size;
+        dims.src_strides_[dims.ndims_] = src_stride;
+        for (int64_t i = 0; i < num_dsts; ++i) {
+            dims.dst_strides_[i][dims.ndims_] = dst_strides[i];
+        }
+        dims.ndims_++;
     }
 
-private:
-    Indexer indexer_;
+    template <typename scalar_t, typename reducer_t, typename acc_t>
+    void Write(const reducer_t& reducer, int64_t output_idx, const acc_t& acc) {
+        for (size_t i = 0; i < dsts_.size(); ++i) {
+            scalar_t* dst_ptr = static_cast<scalar_t*>(dst_ptrs_[i]);
+            dst_ptr[output_.DstOffset(output_idx, i)] =
+                    reducer.Project(acc, i);
+        }
+    }
+
+    Tensor src_;
+    std::vector<Tensor> dsts_;
+    std::vector<void*> dst_ptrs_;
+    Dims output_;
+    Dims reduction_;
 };
 
 class CPUArgReductionEngine {
@@ -232,52 +574,96 @@ private:
     Indexer indexer_;
 };
 
+/// Runs a sum accumulated in acc_t, or a compensated sum if \p kahan is set.
+/// The compensated reducer is only instantiated for float and double, the
+/// std::false_type overload serves Float16 and integer types.
+template <typename scalar_t, typename acc_t>
+static void RunSum(CPUReductionEngine& re, bool kahan, std::true_type) {
+    if (kahan) {
+        re.Run<scalar_t>(CPUKahanSumReducer<scalar_t>());
+    } else {
+        re.Run<scalar_t>(CPUSumReducer<scalar_t, acc_t>());
+    }
+}
+
+template <typename scalar_t, typename acc_t>
+static void RunSum(CPUReductionEngine& re, bool kahan, std::false_type) {
+    re.Run<scalar_t>(CPUSumReducer<scalar_t, acc_t>());
+}
+
+template <typename scalar_t>
+static void RunFusedReduction(CPUReductionEngine& re,
+                              const std::vector<ReductionOpCode>& op_codes,
+                              SumMode sum_mode) {
+    // Float16 always accumulates in float, a Float16 sum saturates quickly.
+    constexpr bool is_half = std::is_same<scalar_t, Half>::value;
+    using native_acc_t =
+            typename std::conditional<is_half, float, scalar_t>::type;
+    const bool is_float = std::is_floating_point<native_acc_t>::value;
+    const bool kahan = is_float && sum_mode == SumMode::Kahan;
+    const bool wide = (std::is_same<scalar_t, float>::value || is_half) &&
+                      sum_mode == SumMode::Float64;
+    if (op_codes.size() > 1) {
+        if (wide) {
+            re.Run<scalar_t>(
+                    CPUFusedReducer<scalar_t, double>(op_codes, false));
+        } else {
+            re.Run<scalar_t>(
+                    CPUFusedReducer<scalar_t, native_acc_t>(op_codes, kahan));
+        }
+        return;
+    }
+    switch (op_codes[0]) {
+        case ReductionOpCode::Sum:
+            if (wide) {
+                re.Run<scalar_t>(CPUSumReducer<scalar_t, double>());
+            } else {
+                RunSum<scalar_t, native_acc_t>(
+                        re, kahan, std::is_floating_point<scalar_t>());
+            }
+            break;
+        case ReductionOpCode::Prod:
+            re.Run<scalar_t>(CPUProdReducer<scalar_t>());
+            break;
+        case ReductionOpCode::Min:
+            re.Run<scalar_t>(CPUMinReducer<scalar_t>());
+            break;
+        case ReductionOpCode::Max:
+            re.Run<scalar_t>(CPUMaxReducer<scalar_t>());
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
+void ReductionCPU(const Tensor& src,
+                  std::vector<Tensor>& dsts,
+                  const SizeVector& dims,
+                  const std::vector<ReductionOpCode>& op_codes,
+                  SumMode sum_mode) {
+    for (const ReductionOpCode& op_code : op_codes) {
+        if (src.NumElements() == 0 && op_code == ReductionOpCode::Min) {
+            utility::LogError("Zero-size Tensor does not suport Min.");
+        }
+        if (src.NumElements() == 0 && op_code == ReductionOpCode::Max) {
+            utility::LogError("Zero-size Tensor does not suport Max.");
+        }
+    }
+    CPUReductionEngine re(src, dsts, dims);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
+        RunFusedReduction<scalar_t>(re, op_codes, sum_mode);
+    });
+}
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
-        Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
-            scalar_t identity;
-            switch (op_code) {
-                case ReductionOpCode::Sum:
-                    identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Prod:
-                    identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Min:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Min.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::max();
-                        dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                case ReductionOpCode::Max:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Max.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::lowest();
-                        dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                default:
-                    utility::LogError("Unsupported op code.");
-                    break;
-            }
-        });
+        std::vector<Tensor> dsts = {dst};
+        ReductionCPU(src, dsts, dims, {op_code}, SumMode::Native);
     } else if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
         if (dst.GetDtype() != Dtype::Int64) {
             utility::LogError("Arg-reduction must have int64 output dtype.");
@@ -287,7 +673,7 @@ void ReductionCPU(const Tensor& src,
 
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
         CPUArgReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::ArgMin:
@@ -325,18 +711,15 @@ void ReductionCPU(const Tensor& src,
             utility::LogError(
                     "Boolean reduction only supports boolean output tensor.");
         }
-        Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
+        CPUReductionEngine re(src, {dst}, dims);
         switch (op_code) {
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
-                dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
+                re.Run<bool>(CPUAllReducer());
                 break;
             case ReductionOpCode::Any:
                 // Identity == false. 0-sized tensor, returns false.
-                dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
+                re.Run<bool>(CPUAnyReducer());
                 break;
             default:
                 utility::LogError("Unsupported op code.");
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Minimum number of elements per chunk of the parallel scans. Shorter inputs
+/// run on fewer threads, down to a single serial pass.
+static constexpr int64_t kScanGrainSize = 1 << 15;
+
+/// Number of contiguous chunks [0, n) is split into by the parallel scans.
+/// Every chunk is processed by one thread in each pass of a scan.
+inline int64_t GetNumScanChunks(int64_t n) {
+    const int64_t max_chunks = InParallel() ? 1 : GetMaxThreads();
+    return std::max<int64_t>(
+            1, std::min<int64_t>(max_chunks,
+                                 (n + kScanGrainSize - 1) / kScanGrainSize));
+}
+
+/// Writes the exclusive prefix sum of \p src to \p dst, i.e.
+/// dst[i] = src[0] + ... + src[i - 1], and returns the sum of all elements.
+/// \p src and \p dst may be the same array.
+///
+/// The input is split into one chunk per thread. The first pass sums up each
+/// chunk, and the second pass scans each chunk starting from the sum of the
+/// chunks before it.
+template <typename scalar_t>
+scalar_t ExclusiveScanCPU(const scalar_t* src, scalar_t* dst, int64_t n) {
+    const int64_t num_chunks = GetNumScanChunks(n);
+    std::vector<scalar_t> chunk_offsets(num_chunks + 1, scalar_t(0));
+#pragma omp parallel for schedule(static, 1)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        scalar_t sum(0);
+        for (int64_t i = c * n / num_chunks; i < (c + 1) * n / num_chunks;
+             ++i) {
+            sum += src[i];
+        }
+        chunk_offsets[c + 1] = sum;
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        chunk_offsets[c + 1] += chunk_offsets[c];
+    }
+#pragma omp parallel for schedule(static, 1)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        scalar_t sum = chunk_offsets[c];
+        for (int64_t i = c * n / num_chunks; i < (c + 1) * n / num_chunks;
+             ++i) {
+            const scalar_t value = src[i];
+            dst[i] = sum;
+            sum += value;
+        }
+    }
+    return chunk_offsets[num_chunks];
+}
+
+/// Stream compaction: returns the Int64 CPU tensor of all indices i in
+/// [0, n) for which \p pred(i) is true, in increasing order.
+///
+/// The first pass counts the selected indices of each chunk, and the second
+/// pass writes them at the exclusive prefix sum of the counts. \p pred is
+/// therefore called twice per index and must not have side effects. No
+/// temporary buffer of size \p n is needed.
+template <typename pred_t>
+Tensor CompactIndicesCPU(int64_t n, const pred_t& pred) {
+    const int64_t num_chunks = GetNumScanChunks(n);
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static, 1)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t count = 0;
+        for (int64_t i = c * n / num_chunks; i < (c + 1) * n / num_chunks;
+             ++i) {
+            count += pred(i) ? 1 : 0;
+        }
+        chunk_offsets[c + 1] = count;
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        chunk_offsets[c + 1] += chunk_offsets[c];
+    }
+
+    Tensor indices({chunk_offsets[num_chunks]}, Dtype::Int64, Device("CPU:0"));
+    int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+#pragma omp parallel for schedule(static, 1)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t* dst = indices_ptr + chunk_offsets[c];
+        for (int64_t i = c * n / num_chunks; i < (c + 1) * n / num_chunks;
+             ++i) {
+            if (pred(i)) {
+                *dst++ = i;
+            }
+        }
+    }
+    return indices;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
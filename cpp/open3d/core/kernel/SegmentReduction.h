@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentReductionOpCode {
+    Sum,
+    Mean,
+    Min,
+    Max,
+};
+
+/// Reduces the rows (slices along the first dimension) of \p src that have
+/// the same segment id.
+///
+/// \param src Tensor of shape {N, ...}.
+/// \param segment_ids Int64 tensor of shape {N} with ids sorted in ascending
+/// order.
+/// \param dst Preallocated tensor of shape {num_segments, ...}. All segment
+/// ids must be smaller than num_segments. Rows of empty segments are set to
+/// zero.
+void SegmentReduction(const Tensor& src,
+                      const Tensor& segment_ids,
+                      Tensor& dst,
+                      SegmentReductionOpCode op_code);
+
+void SegmentReductionCPU(const Tensor& src,
+                         const Tensor& segment_ids,
+                         Tensor& dst,
+                         SegmentReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
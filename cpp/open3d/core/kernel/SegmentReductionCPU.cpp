@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+template <typename scalar_t>
+static void SegmentReductionKernel(const scalar_t* src_ptr,
+                                   const std::vector<int64_t>& row_begins,
+                                   int64_t row_size,
+                                   scalar_t* dst_ptr,
+                                   SegmentReductionOpCode op_code) {
+    const int64_t num_segments = int64_t(row_begins.size()) - 1;
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int64_t segment = 0; segment < num_segments; ++segment) {
+        scalar_t* dst_row = dst_ptr + segment * row_size;
+        const int64_t begin = row_begins[segment];
+        const int64_t end = row_begins[segment + 1];
+        if (begin == end) {
+            std::fill(dst_row, dst_row + row_size, scalar_t(0));
+            continue;
+        }
+        std::copy(src_ptr + begin * row_size, src_ptr + (begin + 1) * row_size,
+                  dst_row);
+        for (int64_t row = begin + 1; row < end; ++row) {
+            const scalar_t* src_row = src_ptr + row * row_size;
+            switch (op_code) {
+                case SegmentReductionOpCode::Sum:
+                case SegmentReductionOpCode::Mean:
+                    for (int64_t i = 0; i < row_size; ++i) {
+                        dst_row[i] += src_row[i];
+                    }
+                    break;
+                case SegmentReductionOpCode::Min:
+                    for (int64_t i = 0; i < row_size; ++i) {
+                        dst_row[i] = std::min(dst_row[i], src_row[i]);
+                    }
+                    break;
+                case SegmentReductionOpCode::Max:
+                    for (int64_t i = 0; i < row_size; ++i) {
+                        dst_row[i] = std::max(dst_row[i], src_row[i]);
+                    }
+                    break;
+            }
+        }
+        if (op_code == SegmentReductionOpCode::Mean) {
+            const scalar_t count = static_cast<scalar_t>(end - begin);
+            for (int64_t i = 0; i < row_size; ++i) {
+                dst_row[i] /= count;
+            }
+        }
+    }
+}
+
+void SegmentReductionCPU(const Tensor& src,
+                         const Tensor& segment_ids,
+                         Tensor& dst,
+                         SegmentReductionOpCode op_code) {
+    const int64_t num_rows = src.GetShape()[0];
+    const int64_t num_segments = dst.GetShape()[0];
+    int64_t row_size = 1;
+    for (int64_t dim = 1; dim < dst.NumDims(); ++dim) {
+        row_size *= dst.GetShape()[dim];
+    }
+    const Tensor src_contiguous = src.Contiguous();
+    const Tensor ids_contiguous = segment_ids.Contiguous();
+    const int64_t* ids_ptr =
+            static_cast<const int64_t*>(ids_contiguous.GetDataPtr());
+
+    bool ids_valid = true;
+#pragma omp parallel for schedule(static) reduction(&& : ids_valid)
+    for (int64_t row = 1; row < num_rows; ++row) {
+        ids_valid = ids_valid && ids_ptr[row - 1] <= ids_ptr[row];
+    }
+    if (!ids_valid) {
+        utility::LogError("Segment ids must be sorted in ascending order.");
+    }
+    if (num_rows > 0 &&
+        (ids_ptr[0] < 0 || ids_ptr[num_rows - 1] >= num_segments)) {
+        utility::LogError("Segment ids must be in [0, {}), but got [{}, {}].",
+                          num_segments, ids_ptr[0], ids_ptr[num_rows - 1]);
+    }
+
+    // Segment s covers the rows [row_begins[s], row_begins[s + 1]).
+    std::vector<int64_t> row_begins(num_segments + 1);
+#pragma omp parallel for schedule(static)
+    for (int64_t segment = 0; segment <= num_segments; ++segment) {
+        row_begins[segment] =
+                std::lower_bound(ids_ptr, ids_ptr + num_rows, segment) -
+                ids_ptr;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        SegmentReductionKernel(
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                row_begins, row_size, static_cast<scalar_t*>(dst.GetDataPtr()),
+                op_code);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
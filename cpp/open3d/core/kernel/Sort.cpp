@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void CheckSortInput(const Tensor& src) {
+    if (src.NumDims() != 1) {
+        utility::LogError("Expected a 1-D tensor, but got shape {}.",
+                          src.GetShape().ToString());
+    }
+}
+
+Tensor ArgSort(const Tensor& src, bool descending) {
+    CheckSortInput(src);
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return ArgSortCPU(src, descending);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // Sorted on the host, there is no CUDA kernel yet.
+        return ArgSortCPU(src.Copy(Device("CPU:0")), descending)
+                .Copy(src.GetDevice());
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ArgSort: Unimplemented device");
+    }
+}
+
+void Unique(const Tensor& src,
+            Tensor& values,
+            Tensor& inverse,
+            Tensor& counts) {
+    CheckSortInput(src);
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        UniqueCPU(src, values, inverse, counts);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // Computed on the host, there is no CUDA kernel yet.
+        UniqueCPU(src.Copy(Device("CPU:0")), values, inverse, counts);
+        values = values.Copy(src.GetDevice());
+        inverse = inverse.Copy(src.GetDevice());
+        counts = counts.Copy(src.GetDevice());
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unique: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the Int64 indices that stably sort the 1-D tensor \p src.
+///
+/// Floating point values are ordered as by operator<, with -0 equal to +0
+/// and NaNs after all other values.
+Tensor ArgSort(const Tensor& src, bool descending);
+
+/// Computes the unique elements of the 1-D tensor \p src in ascending order,
+/// the Int64 index of the unique element for every input element and the
+/// Int64 number of occurrences of each unique element.
+void Unique(const Tensor& src, Tensor& values, Tensor& inverse, Tensor& counts);
+
+Tensor ArgSortCPU(const Tensor& src, bool descending);
+
+void UniqueCPU(const Tensor& src,
+               Tensor& values,
+               Tensor& inverse,
+               Tensor& counts);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
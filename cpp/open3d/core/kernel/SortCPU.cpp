@@ -0,0 +1,245 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Inputs with fewer elements are sorted with std::stable_sort, and every
+/// thread of the radix sort handles at least this many elements.
+static constexpr int64_t kRadixSortMinSize = 1 << 14;
+
+/// Unsigned integer with the size of \p scalar_t.
+template <typename scalar_t>
+using RadixKey = typename std::conditional<
+        sizeof(scalar_t) == 1,
+        uint8_t,
+        typename std::conditional<
+                sizeof(scalar_t) == 2,
+                uint16_t,
+                typename std::conditional<sizeof(scalar_t) == 4,
+                                          uint32_t,
+                                          uint64_t>::type>::type>::type;
+
+/// Maps \p value to an unsigned key with the same order, so that keys can be
+/// sorted digit by digit.
+template <typename scalar_t>
+static RadixKey<scalar_t> ToRadixKey(scalar_t value) {
+    using key_t = RadixKey<scalar_t>;
+    constexpr key_t sign_bit = key_t(key_t(1) << (8 * sizeof(key_t) - 1));
+    if (std::is_floating_point<scalar_t>::value) {
+        if (value != value) {
+            return std::numeric_limits<key_t>::max();
+        }
+        if (value == scalar_t(0)) {
+            value = scalar_t(0);
+        }
+    }
+    key_t key;
+    std::memcpy(&key, &value, sizeof(key_t));
+    if (std::is_floating_point<scalar_t>::value) {
+        // Negative values have all bits flipped to reverse their order.
+        return (key & sign_bit) ? key_t(~key) : key_t(key | sign_bit);
+    } else if (std::is_signed<scalar_t>::value) {
+        return key_t(key ^ sign_bit);
+    } else {
+        return key;
+    }
+}
+
+/// Stable LSD radix sort of \p keys with 8 bit digits, \p indices are
+/// permuted with the keys.
+///
+/// Every thread counts the digits of a contiguous chunk and scatters the chunk
+/// to the offsets of its digits, which are ordered by digit and then by
+/// thread to keep the sort stable.
+template <typename key_t>
+static void RadixSortPairs(std::vector<key_t>& keys,
+                           std::vector<int64_t>& indices) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int num_threads = static_cast<int>(std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), n / kRadixSortMinSize)));
+    const int64_t chunk_size = (n + num_threads - 1) / num_threads;
+    std::vector<key_t> keys_out(n);
+    std::vector<int64_t> indices_out(n);
+    std::vector<int64_t> offsets(num_threads * 256);
+
+    for (size_t shift = 0; shift < 8 * sizeof(key_t); shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+        for (int t = 0; t < num_threads; ++t) {
+            int64_t* counts = offsets.data() + t * 256;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                ++counts[(keys[i] >> shift) & 0xff];
+            }
+        }
+
+        bool single_digit = false;
+        int64_t offset = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            const int64_t digit_begin = offset;
+            for (int t = 0; t < num_threads; ++t) {
+                const int64_t count = offsets[t * 256 + digit];
+                offsets[t * 256 + digit] = offset;
+                offset += count;
+            }
+            single_digit = single_digit || offset - digit_begin == n;
+        }
+        // The pass would not change the order.
+        if (single_digit) {
+            continue;
+        }
+
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+        for (int t = 0; t < num_threads; ++t) {
+            int64_t* positions = offsets.data() + t * 256;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                const int64_t dst = positions[(keys[i] >> shift) & 0xff]++;
+                keys_out[dst] = keys[i];
+                indices_out[dst] = indices[i];
+            }
+        }
+        keys.swap(keys_out);
+        indices.swap(indices_out);
+    }
+}
+
+/// Sorts the keys of the contiguous CPU tensor \p src. Returns the sorted keys
+/// in \p keys and the indices of the sorted elements in \p indices.
+template <typename scalar_t>
+static void SortKeys(const Tensor& src,
+                     bool descending,
+                     std::vector<RadixKey<scalar_t>>& keys,
+                     std::vector<int64_t>& indices) {
+    using key_t = RadixKey<scalar_t>;
+    const int64_t n = src.NumElements();
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    keys.resize(n);
+    indices.resize(n);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        const key_t key = ToRadixKey(src_ptr[i]);
+        keys[i] = descending ? key_t(~key) : key;
+        indices[i] = i;
+    }
+
+    if (n < kRadixSortMinSize) {
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&keys](int64_t a, int64_t b) {
+                             return keys[a] < keys[b];
+                         });
+        std::vector<key_t> sorted_keys(n);
+        for (int64_t i = 0; i < n; ++i) {
+            sorted_keys[i] = keys[indices[i]];
+        }
+        keys.swap(sorted_keys);
+    } else {
+        RadixSortPairs(keys, indices);
+    }
+}
+
+Tensor ArgSortCPU(const Tensor& src, bool descending) {
+    const int64_t n = src.NumElements();
+    std::vector<int64_t> indices;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        std::vector<RadixKey<scalar_t>> keys;
+        SortKeys<scalar_t>(src.Contiguous(), descending, keys, indices);
+    });
+    return Tensor(indices, {n}, Dtype::Int64, src.GetDevice());
+}
+
+template <typename scalar_t>
+static void UniqueKernel(const Tensor& src,
+                         Tensor& values,
+                         Tensor& inverse,
+                         Tensor& counts) {
+    const int64_t n = src.NumElements();
+    std::vector<RadixKey<scalar_t>> keys;
+    std::vector<int64_t> indices;
+    SortKeys<scalar_t>(src, false, keys, indices);
+
+    // The inclusive prefix sum of the flags marking the first sorted element
+    // of every unique value gives the one based unique index of each element.
+    std::vector<int64_t> unique_ids(n);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        unique_ids[i] = (i == 0 || keys[i] != keys[i - 1]) ? 1 : 0;
+    }
+    utility::InclusivePrefixSum(unique_ids.data(), unique_ids.data() + n,
+                                unique_ids.data());
+    const int64_t num_unique = n > 0 ? unique_ids[n - 1] : 0;
+
+    inverse = Tensor({n}, Dtype::Int64, src.GetDevice());
+    int64_t* inverse_ptr = static_cast<int64_t*>(inverse.GetDataPtr());
+    std::vector<int64_t> first(num_unique + 1, n);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        const int64_t unique_id = unique_ids[i] - 1;
+        inverse_ptr[indices[i]] = unique_id;
+        if (i == 0 || unique_ids[i] != unique_ids[i - 1]) {
+            first[unique_id] = i;
+        }
+    }
+
+    values = Tensor({num_unique}, src.GetDtype(), src.GetDevice());
+    counts = Tensor({num_unique}, Dtype::Int64, src.GetDevice());
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* values_ptr = static_cast<scalar_t*>(values.GetDataPtr());
+    int64_t* counts_ptr = static_cast<int64_t*>(counts.GetDataPtr());
+#pragma omp parallel for schedule(static)
+    for (int64_t u = 0; u < num_unique; ++u) {
+        values_ptr[u] = src_ptr[indices[first[u]]];
+        counts_ptr[u] = first[u + 1] - first[u];
+    }
+}
+
+void UniqueCPU(const Tensor& src,
+               Tensor& values,
+               Tensor& inverse,
+               Tensor& counts) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        UniqueKernel<scalar_t>(src.Contiguous(), values, inverse, counts);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
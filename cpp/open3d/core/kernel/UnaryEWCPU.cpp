@@ -106,6 +106,19 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
         MemoryManager::Memcpy(dst.GetDataPtr(), dst.GetDevice(),
                               src.GetDataPtr(), src.GetDevice(),
                               src_dtype.ByteSize() * shape.NumElements());
+    } else if (src.IsContiguous() && dst.IsContiguous() &&
+               src.GetShape() == dst.GetShape() &&
+               src_dtype == Dtype::Float32 && dst_dtype == Dtype::Float16) {
+        // Bulk conversion, uses F16C instructions when available.
+        ConvertFloatToHalf(static_cast<const float*>(src.GetDataPtr()),
+                           static_cast<Half*>(dst.GetDataPtr()),
+                           shape.NumElements());
+    } else if (src.IsContiguous() && dst.IsContiguous() &&
+               src.GetShape() == dst.GetShape() &&
+               src_dtype == Dtype::Float16 && dst_dtype == Dtype::Float32) {
+        ConvertHalfToFloat(static_cast<const Half*>(src.GetDataPtr()),
+                           static_cast<float*>(dst.GetDataPtr()),
+                           shape.NumElements());
     } else {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
         if (src.GetDtype().IsObject()) {
@@ -116,9 +129,9 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                     });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dst_dtype, [&]() {
                     using dst_t = scalar_t;
                     CPULauncher::LaunchUnaryEWKernel(
                             indexer, CPUCopyElementKernel<src_t, dst_t>);
@@ -134,15 +147,17 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 CPULauncher::LaunchUnaryEWKernel(
@@ -161,7 +176,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
@@ -134,19 +134,22 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
                     using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                        using dst_t = scalar_t;
-                        CUDALauncher::LaunchUnaryEWKernel(
-                                indexer,
-                                // Need to wrap as extended CUDA lambda function
-                                [] OPEN3D_HOST_DEVICE(const void* src,
-                                                      void* dst) {
-                                    CUDACopyElementKernel<src_t, dst_t>(src,
-                                                                        dst);
-                                });
-                    });
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(
+                            dst_dtype, [&]() {
+                                using dst_t = scalar_t;
+                                CUDALauncher::LaunchUnaryEWKernel(
+                                        indexer,
+                                        // Need to wrap as extended CUDA lambda
+                                        // function
+                                        [] OPEN3D_HOST_DEVICE(const void* src,
+                                                              void* dst) {
+                                            CUDACopyElementKernel<src_t,
+                                                                  dst_t>(src,
+                                                                         dst);
+                                        });
+                            });
                 });
             }
         } else {
@@ -0,0 +1,381 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include <string>
+
+#include "open3d/core/linalg/Inverse.h"
+#include "open3d/core/linalg/LeastSquares.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
+
+namespace open3d {
+namespace core {
+
+/// Matrices of at most this size are solved by BatchedCholeskySolve in
+/// registers.
+static constexpr int64_t kMaxRegisterCholeskySize = 6;
+
+static void CheckFloatDtype(const Tensor& A) {
+    Dtype dtype = A.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "Only tensors with Float32 or Float64 are supported, but "
+                "received {}.",
+                dtype.ToString());
+    }
+}
+
+static void CheckSameDeviceAndDtype(const Tensor& A, const Tensor& B) {
+    if (A.GetDevice() != B.GetDevice()) {
+        utility::LogError("Tensor A device {} and Tensor B device {} mismatch.",
+                          A.GetDevice().ToString(), B.GetDevice().ToString());
+    }
+    if (A.GetDtype() != B.GetDtype()) {
+        utility::LogError("Tensor A dtype {} and Tensor B dtype {} mismatch.",
+                          A.GetDtype().ToString(), B.GetDtype().ToString());
+    }
+}
+
+/// Checks that A is a [batch_size, m, n] batch of non-empty matrices.
+static void CheckBatchedMatrix(const Tensor& A, bool square) {
+    const SizeVector& A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError(
+                "Tensor A must be 3D (a batch of matrices), but got {}D.",
+                A_shape.size());
+    }
+    if (A_shape[1] == 0 || A_shape[2] == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (square && A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor A must be a batch of square matrices, but "
+                          "got {} x {}.",
+                          A_shape[1], A_shape[2]);
+    }
+}
+
+/// Returns a contiguous [batch_size, rows, k] copy of the right hand side B,
+/// which is [batch_size, rows, k] or a batch of vectors [batch_size, rows].
+static Tensor CopyBatchedRHS(const Tensor& B,
+                             int64_t batch_size,
+                             int64_t rows) {
+    const SizeVector& B_shape = B.GetShape();
+    if ((B_shape.size() != 2 && B_shape.size() != 3) ||
+        B_shape[0] != batch_size || B_shape[1] != rows) {
+        utility::LogError(
+                "Tensor B must have shape ({}, {}) or ({}, {}, k), but got {}.",
+                batch_size, rows, batch_size, rows, B_shape.ToString());
+    }
+    const int64_t k = B_shape.size() == 3 ? B_shape[2] : 1;
+    if (k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    return B.Contiguous().Reshape({batch_size, rows, k}).Copy();
+}
+
+/// Raises an error for the first matrix with a non-zero status in \p info.
+static void CheckBatchedInfo(const Tensor& info, const std::string& msg) {
+    Tensor info_cpu = info.Copy(Device("CPU:0"));
+    const int32_t* info_ptr =
+            static_cast<const int32_t*>(info_cpu.GetDataPtr());
+    for (int64_t i = 0; i < info_cpu.NumElements(); ++i) {
+        if (info_ptr[i] < 0) {
+            utility::LogError("{}: {}-th parameter is invalid.", msg,
+                              -info_ptr[i]);
+        } else if (info_ptr[i] > 0) {
+            utility::LogError("{}: singular condition detected in matrix {}.",
+                              msg, i);
+        }
+    }
+}
+
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& C) {
+    CheckSameDeviceAndDtype(A, B);
+    CheckBatchedMatrix(A, /*square=*/false);
+    Device device = A.GetDevice();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t m = A.GetShape()[1];
+    const int64_t k = A.GetShape()[2];
+
+    // As in numpy's A @ B, a 1D or 2D B, or a batch of one matrix, is
+    // multiplied with every matrix of A. This is a single matrix product.
+    if (B.NumDims() == 1 || B.NumDims() == 2 ||
+        (B.NumDims() == 3 && B.GetShape()[0] == 1 && batch_size != 1)) {
+        const Tensor B_matrix = B.NumDims() == 3 ? B[0] : B;
+        SizeVector C_shape = {batch_size, m};
+        if (B_matrix.NumDims() == 2) {
+            C_shape.push_back(B_matrix.GetShape()[1]);
+        }
+        if (batch_size == 0) {
+            C = Tensor::Empty(C_shape, A.GetDtype(), device);
+            return;
+        }
+        Tensor C_matrix;
+        Matmul(A.Reshape({batch_size * m, k}), B_matrix, C_matrix);
+        C = C_matrix.Reshape(C_shape);
+        return;
+    }
+
+    const SizeVector& B_shape = B.GetShape();
+    if (B_shape.size() != 3 || B_shape[0] != batch_size || B_shape[1] != k ||
+        B_shape[2] == 0) {
+        utility::LogError(
+                "Tensor B must have shape ({}, {}, n), (1, {}, n), ({}, n) or "
+                "({}), but got {}.",
+                batch_size, k, k, k, k, B_shape.ToString());
+    }
+    Dtype dtype = A.GetDtype(), dtype_original = dtype;
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogDebug("Converting to Float32 dtype to from {}.",
+                          dtype.ToString());
+        dtype = Dtype::Float32;
+    }
+    const int64_t n = B_shape[2];
+    Tensor A_contiguous = A.Contiguous().To(dtype);
+    Tensor B_contiguous = B.Contiguous().To(dtype);
+
+    C = Tensor::Empty({batch_size, m, n}, dtype, device);
+    if (batch_size > 0) {
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            BatchedMatmulCUDA(A_contiguous.GetDataPtr(),
+                              B_contiguous.GetDataPtr(), C.GetDataPtr(),
+                              batch_size, m, k, n, dtype);
+#else
+            utility::LogError("Unimplemented device.");
+#endif
+        } else {
+            BatchedMatmulCPU(A_contiguous.GetDataPtr(),
+                             B_contiguous.GetDataPtr(), C.GetDataPtr(),
+                             batch_size, m, k, n, dtype);
+        }
+    }
+    C = C.To(dtype_original);
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/true);
+    Device device = A.GetDevice();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        // There is no batched cuSolver backend yet, solve one by one.
+        output = Tensor::Empty({batch_size, n, n}, A.GetDtype(), device);
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor output_i;
+            Inverse(A[i], output_i);
+            output[i] = output_i;
+        }
+    } else {
+        output = A.Contiguous().Copy();
+        Tensor info = Tensor::Zeros({batch_size}, Dtype::Int32, device);
+        BatchedInverseCPU(output.GetDataPtr(), info.GetDataPtr(), batch_size,
+                          n, A.GetDtype());
+        CheckBatchedInfo(info, "getrf/getri failed in BatchedInverseCPU");
+    }
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    CheckSameDeviceAndDtype(A, B);
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/true);
+    Device device = A.GetDevice();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    X = CopyBatchedRHS(B, batch_size, n);
+    const int64_t k = X.GetShape()[2];
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        // There is no batched cuSolver backend yet, solve one by one.
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor X_i;
+            Solve(A[i], X[i], X_i);
+            X[i] = X_i;
+        }
+    } else {
+        Tensor A_copy = A.Contiguous().Copy();
+        Tensor info = Tensor::Zeros({batch_size}, Dtype::Int32, device);
+        BatchedSolveCPU(A_copy.GetDataPtr(), X.GetDataPtr(), info.GetDataPtr(),
+                        batch_size, n, k, A.GetDtype());
+        CheckBatchedInfo(info, "gesv failed in BatchedSolveCPU");
+    }
+    X = X.Reshape(B.GetShape());
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/false);
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t m = A.GetShape()[1];
+    const int64_t n = A.GetShape()[2];
+    if (m < n) {
+        utility::LogError("Only support m >= n, but got {} and {} matrix", m,
+                          n);
+    }
+
+    U = Tensor::Empty({batch_size, m, m}, dtype, device);
+    S = Tensor::Empty({batch_size, n}, dtype, device);
+    VT = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        // There is no batched cuSolver backend yet, decompose one by one.
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor U_i, S_i, VT_i;
+            SVD(A[i], U_i, S_i, VT_i);
+            U[i] = U_i;
+            S[i] = S_i;
+            VT[i] = VT_i;
+        }
+    } else {
+        Tensor A_copy = A.Contiguous().Copy();
+        Tensor info = Tensor::Zeros({batch_size}, Dtype::Int32, device);
+        BatchedSVDCPU(A_copy.GetDataPtr(), U.GetDataPtr(), S.GetDataPtr(),
+                      VT.GetDataPtr(), info.GetDataPtr(), batch_size, m, n,
+                      dtype);
+        CheckBatchedInfo(info, "gesvd failed in BatchedSVDCPU");
+    }
+}
+
+void BatchedLeastSquares(const Tensor& A, const Tensor& B, Tensor& X) {
+    CheckSameDeviceAndDtype(A, B);
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/false);
+    Device device = A.GetDevice();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t m = A.GetShape()[1];
+    const int64_t n = A.GetShape()[2];
+    if (m < n) {
+        utility::LogError("Tensor A shape must satisfy rows({}) > cols({}).", m,
+                          n);
+    }
+    Tensor B_copy = CopyBatchedRHS(B, batch_size, m);
+    const int64_t k = B_copy.GetShape()[2];
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        // There is no batched cuSolver backend yet, solve one by one.
+        X = Tensor::Empty({batch_size, n, k}, A.GetDtype(), device);
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor X_i;
+            LeastSquares(A[i], B_copy[i], X_i);
+            X[i] = X_i;
+        }
+    } else {
+        // gels overwrites the first n rows of B with the solution.
+        Tensor A_copy = A.Contiguous().Copy();
+        Tensor info = Tensor::Zeros({batch_size}, Dtype::Int32, device);
+        BatchedLeastSquaresCPU(A_copy.GetDataPtr(), B_copy.GetDataPtr(),
+                               info.GetDataPtr(), batch_size, m, n, k,
+                               A.GetDtype());
+        CheckBatchedInfo(info, "gels failed in BatchedLeastSquaresCPU");
+        X = B_copy.Slice(1, 0, n).Contiguous();
+    }
+    if (B.NumDims() == 2) {
+        X = X.Reshape({batch_size, n});
+    }
+}
+
+void BatchedCholeskySolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    CheckSameDeviceAndDtype(A, B);
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/true);
+    Device device = A.GetDevice();
+    const int64_t batch_size = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    if (n > kMaxRegisterCholeskySize) {
+        BatchedSolve(A, B, X);
+        return;
+    }
+
+    Tensor A_contiguous = A.Contiguous();
+    X = CopyBatchedRHS(B, batch_size, n);
+    const int64_t k = X.GetShape()[2];
+    Tensor info = Tensor::Zeros({batch_size}, Dtype::Int32, device);
+    if (batch_size > 0) {
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            BatchedCholeskySolveCUDA(A_contiguous.GetDataPtr(), X.GetDataPtr(),
+                                     info.GetDataPtr(), batch_size, n, k,
+                                     A.GetDtype());
+#else
+            utility::LogError("Unimplemented device.");
+#endif
+        } else {
+            BatchedCholeskySolveCPU(A_contiguous.GetDataPtr(), X.GetDataPtr(),
+                                    info.GetDataPtr(), batch_size, n, k,
+                                    A.GetDtype());
+        }
+    }
+    CheckBatchedInfo(info, "Cholesky factorization failed");
+    X = X.Reshape(B.GetShape());
+}
+
+void BatchedSymmetricEigen3x3(const Tensor& A,
+                              Tensor& eigenvalues,
+                              Tensor& eigenvectors) {
+    CheckFloatDtype(A);
+    CheckBatchedMatrix(A, /*square=*/true);
+    if (A.GetShape()[1] != 3) {
+        utility::LogError("Tensor A must be a batch of 3 x 3 matrices, but "
+                          "got {} x {}.",
+                          A.GetShape()[1], A.GetShape()[2]);
+    }
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    const int64_t batch_size = A.GetShape()[0];
+
+    Tensor A_contiguous = A.Contiguous();
+    eigenvalues = Tensor::Empty({batch_size, 3}, dtype, device);
+    eigenvectors = Tensor::Empty({batch_size, 3, 3}, dtype, device);
+    if (batch_size == 0) {
+        return;
+    }
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSymmetricEigen3x3CUDA(A_contiguous.GetDataPtr(),
+                                     eigenvalues.GetDataPtr(),
+                                     eigenvectors.GetDataPtr(), batch_size,
+                                     dtype);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSymmetricEigen3x3CPU(A_contiguous.GetDataPtr(),
+                                    eigenvalues.GetDataPtr(),
+                                    eigenvectors.GetDataPtr(), batch_size,
+                                    dtype);
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Batched matrix multiplication C[i] = A[i] B[i] with the broadcasting of
+/// numpy's A @ B. A is a [batch_size, m, k] tensor. B is [batch_size, k, n],
+/// or a [1, k, n] or [k, n] matrix or a [k] vector used for every A[i]. A
+/// batch of vectors is passed as [batch_size, k, 1].
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& C);
+
+/// Batched inverse of the [batch_size, n, n] tensor A with LU factorization.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Solves A[i] X[i] = B[i] with LU factorization. A is [batch_size, n, n], B
+/// is [batch_size, n, k] or [batch_size, n].
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Batched SVD A[i] = U[i] diag(S[i]) VT[i] of the [batch_size, m, n] tensor A
+/// with m >= n.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+/// Solves the least squares problems min |A[i] X[i] - B[i]| with QR
+/// factorization. A is [batch_size, m, n] with m >= n and full rank, B is
+/// [batch_size, m, k] or [batch_size, m].
+void BatchedLeastSquares(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Solves A[i] X[i] = B[i] for symmetric positive definite A[i] with the
+/// Cholesky decomposition. Matrices up to 6 x 6 are factorized in registers,
+/// larger ones fall back to BatchedSolve.
+void BatchedCholeskySolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Eigen decomposition of the symmetric [batch_size, 3, 3] tensor A. The
+/// [batch_size, 3] eigenvalues are in ascending order, and the columns of the
+/// [batch_size, 3, 3] eigenvectors are the corresponding unit eigenvectors.
+void BatchedSymmetricEigen3x3(const Tensor& A,
+                              Tensor& eigenvalues,
+                              Tensor& eigenvectors);
+
+// The backends work on contiguous row-major batches, and operate in-place on
+// the copies made by the functions above. \p info_data is an Int32 array with
+// one LAPACK style status per matrix: 0 on success, > 0 if the matrix is
+// singular or not positive definite.
+
+void BatchedMatmulCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch_size,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype);
+
+void BatchedInverseCPU(void* A_data,
+                       void* info_data,
+                       int64_t batch_size,
+                       int64_t n,
+                       Dtype dtype);
+
+void BatchedSolveCPU(void* A_data,
+                     void* B_data,
+                     void* info_data,
+                     int64_t batch_size,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype);
+
+void BatchedSVDCPU(void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   void* info_data,
+                   int64_t batch_size,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype);
+
+void BatchedLeastSquaresCPU(void* A_data,
+                            void* B_data,
+                            void* info_data,
+                            int64_t batch_size,
+                            int64_t m,
+                            int64_t n,
+                            int64_t k,
+                            Dtype dtype);
+
+void BatchedCholeskySolveCPU(const void* A_data,
+                             void* B_data,
+                             void* info_data,
+                             int64_t batch_size,
+                             int64_t n,
+                             int64_t k,
+                             Dtype dtype);
+
+void BatchedSymmetricEigen3x3CPU(const void* A_data,
+                                 void* eigenvalues_data,
+                                 void* eigenvectors_data,
+                                 int64_t batch_size,
+                                 Dtype dtype);
+
+#ifdef BUILD_CUDA_MODULE
+void BatchedMatmulCUDA(const void* A_data,
+                       const void* B_data,
+                       void* C_data,
+                       int64_t batch_size,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype);
+
+void BatchedCholeskySolveCUDA(const void* A_data,
+                              void* B_data,
+                              void* info_data,
+                              int64_t batch_size,
+                              int64_t n,
+                              int64_t k,
+                              Dtype dtype);
+
+void BatchedSymmetricEigen3x3CUDA(const void* A_data,
+                                  void* eigenvalues_data,
+                                  void* eigenvectors_data,
+                                  int64_t batch_size,
+                                  Dtype dtype);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,337 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/BatchedLinalgKernels.h"
+#include "open3d/core/linalg/BlasWrapper.h"
+#include "open3d/core/linalg/LapackWrapper.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+
+namespace open3d {
+namespace core {
+
+/// Batches of matrix products with at most this many multiply-adds each are
+/// computed with plain loops in parallel over the batch. A BLAS call per
+/// matrix costs more than the product itself for such sizes.
+static constexpr int64_t kMaxLoopMatmulSize = 16 * 16 * 16;
+
+template <typename scalar_t>
+static void BatchedMatmulKernel(const scalar_t* A,
+                                const scalar_t* B,
+                                scalar_t* C,
+                                int64_t batch_size,
+                                int64_t m,
+                                int64_t k,
+                                int64_t n) {
+    if (m * k * n <= kMaxLoopMatmulSize) {
+#pragma omp parallel for schedule(static)
+        for (int64_t b = 0; b < batch_size; ++b) {
+            const scalar_t* A_b = A + b * m * k;
+            const scalar_t* B_b = B + b * k * n;
+            scalar_t* C_b = C + b * m * n;
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < n; ++j) {
+                    C_b[i * n + j] = 0;
+                }
+                for (int64_t p = 0; p < k; ++p) {
+                    const scalar_t a = A_b[i * k + p];
+                    for (int64_t j = 0; j < n; ++j) {
+                        C_b[i * n + j] += a * B_b[p * n + j];
+                    }
+                }
+            }
+        }
+    } else {
+        // BLAS parallelizes each product internally.
+        for (int64_t b = 0; b < batch_size; ++b) {
+            gemm_cpu<scalar_t>(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n,
+                               k, 1, A + b * m * k, k, B + b * k * n, n, 0,
+                               C + b * m * n, n);
+        }
+    }
+}
+
+void BatchedMatmulCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch_size,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedMatmulKernel<scalar_t>(static_cast<const scalar_t*>(A_data),
+                                      static_cast<const scalar_t*>(B_data),
+                                      static_cast<scalar_t*>(C_data),
+                                      batch_size, m, k, n);
+    });
+}
+
+/// Limits the BLAS and LAPACK calls of the calling thread to one thread while
+/// in scope. The LAPACK based kernels below factorize one matrix per OpenMP
+/// iteration, and MKL with the TBB threading layer would start its own threads
+/// in every iteration. Other BLAS libraries are not changed, OpenBLAS built
+/// with OpenMP already runs single threaded inside a parallel region.
+class SingleThreadedLapackScope {
+public:
+    SingleThreadedLapackScope() {
+#ifndef USE_BLAS
+        num_threads_ = mkl_set_num_threads_local(1);
+#endif
+    }
+    ~SingleThreadedLapackScope() {
+#ifndef USE_BLAS
+        mkl_set_num_threads_local(num_threads_);
+#endif
+    }
+
+private:
+#ifndef USE_BLAS
+    int num_threads_;
+#endif
+};
+
+template <typename scalar_t>
+static void BatchedInverseKernel(scalar_t* A,
+                                 int32_t* info,
+                                 int64_t batch_size,
+                                 int64_t n) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        SingleThreadedLapackScope single_threaded;
+        scalar_t* A_b = A + b * n * n;
+        std::vector<OPEN3D_CPU_LINALG_INT> ipiv(n);
+        OPEN3D_CPU_LINALG_INT status = getrf_cpu<scalar_t>(
+                LAPACK_ROW_MAJOR, n, n, A_b, n, ipiv.data());
+        if (status == 0) {
+            status = getri_cpu<scalar_t>(LAPACK_ROW_MAJOR, n, A_b, n,
+                                         ipiv.data());
+        }
+        info[b] = static_cast<int32_t>(status);
+    }
+}
+
+void BatchedInverseCPU(void* A_data,
+                       void* info_data,
+                       int64_t batch_size,
+                       int64_t n,
+                       Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedInverseKernel<scalar_t>(static_cast<scalar_t*>(A_data),
+                                       static_cast<int32_t*>(info_data),
+                                       batch_size, n);
+    });
+}
+
+template <typename scalar_t>
+static void BatchedSolveKernel(scalar_t* A,
+                               scalar_t* B,
+                               int32_t* info,
+                               int64_t batch_size,
+                               int64_t n,
+                               int64_t k) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        SingleThreadedLapackScope single_threaded;
+        std::vector<OPEN3D_CPU_LINALG_INT> ipiv(n);
+        info[b] = static_cast<int32_t>(
+                gesv_cpu<scalar_t>(LAPACK_ROW_MAJOR, n, k, A + b * n * n, n,
+                                   ipiv.data(), B + b * n * k, k));
+    }
+}
+
+void BatchedSolveCPU(void* A_data,
+                     void* B_data,
+                     void* info_data,
+                     int64_t batch_size,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedSolveKernel<scalar_t>(static_cast<scalar_t*>(A_data),
+                                     static_cast<scalar_t*>(B_data),
+                                     static_cast<int32_t*>(info_data),
+                                     batch_size, n, k);
+    });
+}
+
+template <typename scalar_t>
+static void BatchedSVDKernel(scalar_t* A,
+                             scalar_t* U,
+                             scalar_t* S,
+                             scalar_t* VT,
+                             int32_t* info,
+                             int64_t batch_size,
+                             int64_t m,
+                             int64_t n) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        SingleThreadedLapackScope single_threaded;
+        std::vector<scalar_t> superb(std::max<int64_t>(1, n - 1));
+        info[b] = static_cast<int32_t>(gesvd_cpu<scalar_t>(
+                LAPACK_ROW_MAJOR, 'A', 'A', m, n, A + b * m * n, n, S + b * n,
+                U + b * m * m, m, VT + b * n * n, n, superb.data()));
+    }
+}
+
+void BatchedSVDCPU(void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   void* info_data,
+                   int64_t batch_size,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedSVDKernel<scalar_t>(
+                static_cast<scalar_t*>(A_data), static_cast<scalar_t*>(U_data),
+                static_cast<scalar_t*>(S_data), static_cast<scalar_t*>(VT_data),
+                static_cast<int32_t*>(info_data), batch_size, m, n);
+    });
+}
+
+template <typename scalar_t>
+static void BatchedLeastSquaresKernel(scalar_t* A,
+                                      scalar_t* B,
+                                      int32_t* info,
+                                      int64_t batch_size,
+                                      int64_t m,
+                                      int64_t n,
+                                      int64_t k) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        SingleThreadedLapackScope single_threaded;
+        info[b] = static_cast<int32_t>(
+                gels_cpu<scalar_t>(LAPACK_ROW_MAJOR, 'N', m, n, k,
+                                   A + b * m * n, n, B + b * m * k, k));
+    }
+}
+
+void BatchedLeastSquaresCPU(void* A_data,
+                            void* B_data,
+                            void* info_data,
+                            int64_t batch_size,
+                            int64_t m,
+                            int64_t n,
+                            int64_t k,
+                            Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedLeastSquaresKernel<scalar_t>(static_cast<scalar_t*>(A_data),
+                                            static_cast<scalar_t*>(B_data),
+                                            static_cast<int32_t*>(info_data),
+                                            batch_size, m, n, k);
+    });
+}
+
+template <typename scalar_t, int N>
+static void BatchedCholeskySolveKernel(const scalar_t* A,
+                                       scalar_t* B,
+                                       int32_t* info,
+                                       int64_t batch_size,
+                                       int64_t k) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        scalar_t* B_b = B + b * N * k;
+        info[b] = linalg_kernels::CholeskySolve<scalar_t, N>(A + b * N * N,
+                                                             B_b, B_b, k)
+                          ? 0
+                          : 1;
+    }
+}
+
+void BatchedCholeskySolveCPU(const void* A_data,
+                             void* B_data,
+                             void* info_data,
+                             int64_t batch_size,
+                             int64_t n,
+                             int64_t k,
+                             Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* B = static_cast<scalar_t*>(B_data);
+        int32_t* info = static_cast<int32_t*>(info_data);
+        switch (n) {
+            case 1:
+                BatchedCholeskySolveKernel<scalar_t, 1>(A, B, info, batch_size,
+                                                        k);
+                break;
+            case 2:
+                BatchedCholeskySolveKernel<scalar_t, 2>(A, B, info, batch_size,
+                                                        k);
+                break;
+            case 3:
+                BatchedCholeskySolveKernel<scalar_t, 3>(A, B, info, batch_size,
+                                                        k);
+                break;
+            case 4:
+                BatchedCholeskySolveKernel<scalar_t, 4>(A, B, info, batch_size,
+                                                        k);
+                break;
+            case 5:
+                BatchedCholeskySolveKernel<scalar_t, 5>(A, B, info, batch_size,
+                                                        k);
+                break;
+            case 6:
+                BatchedCholeskySolveKernel<scalar_t, 6>(A, B, info, batch_size,
+                                                        k);
+                break;
+            default:
+                utility::LogError("Unsupported matrix size {}.", n);
+        }
+    });
+}
+
+template <typename scalar_t>
+static void BatchedSymmetricEigen3x3Kernel(const scalar_t* A,
+                                           scalar_t* eigenvalues,
+                                           scalar_t* eigenvectors,
+                                           int64_t batch_size) {
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < batch_size; ++b) {
+        linalg_kernels::SymmetricEigen3x3<scalar_t>(
+                A + b * 9, eigenvalues + b * 3, eigenvectors + b * 9);
+    }
+}
+
+void BatchedSymmetricEigen3x3CPU(const void* A_data,
+                                 void* eigenvalues_data,
+                                 void* eigenvectors_data,
+                                 int64_t batch_size,
+                                 Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        BatchedSymmetricEigen3x3Kernel<scalar_t>(
+                static_cast<const scalar_t*>(A_data),
+                static_cast<scalar_t*>(eigenvalues_data),
+                static_cast<scalar_t*>(eigenvectors_data), batch_size);
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/BatchedLinalgKernels.h"
+#include "open3d/core/linalg/BlasWrapper.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+
+namespace open3d {
+namespace core {
+
+void BatchedMatmulCUDA(const void* A_data,
+                       const void* B_data,
+                       void* C_data,
+                       int64_t batch_size,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype) {
+    // cuBLAS is column-major: the row-major C = AB is computed as the
+    // column-major C^T = B^T A^T. The batch count is an int.
+    constexpr int64_t kMaxBatchCount = 1 << 30;
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B = static_cast<const scalar_t*>(B_data);
+        scalar_t* C = static_cast<scalar_t*>(C_data);
+        for (int64_t b = 0; b < batch_size; b += kMaxBatchCount) {
+            const int64_t count = std::min(kMaxBatchCount, batch_size - b);
+            OPEN3D_CUBLAS_CHECK(
+                    gemm_strided_batched_cuda<scalar_t>(
+                            handle, CUBLAS_OP_N, CUBLAS_OP_N, n, m, k, &alpha,
+                            B + b * k * n, n, k * n, A + b * m * k, k, m * k,
+                            &beta, C + b * m * n, n, m * n, count),
+                    "cuda batched gemm failed");
+        }
+    });
+}
+
+template <typename scalar_t, int N>
+void LaunchBatchedCholeskySolveKernel(const scalar_t* A,
+                                      scalar_t* B,
+                                      int32_t* info,
+                                      int64_t batch_size,
+                                      int64_t k) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            batch_size, [=] OPEN3D_DEVICE(int64_t b) {
+                scalar_t* B_b = B + b * N * k;
+                info[b] = linalg_kernels::CholeskySolve<scalar_t, N>(
+                                  A + b * N * N, B_b, B_b, k)
+                                  ? 0
+                                  : 1;
+            });
+}
+
+void BatchedCholeskySolveCUDA(const void* A_data,
+                              void* B_data,
+                              void* info_data,
+                              int64_t batch_size,
+                              int64_t n,
+                              int64_t k,
+                              Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* B = static_cast<scalar_t*>(B_data);
+        int32_t* info = static_cast<int32_t*>(info_data);
+        switch (n) {
+            case 1:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 1>(A, B, info,
+                                                              batch_size, k);
+                break;
+            case 2:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 2>(A, B, info,
+                                                              batch_size, k);
+                break;
+            case 3:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 3>(A, B, info,
+                                                              batch_size, k);
+                break;
+            case 4:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 4>(A, B, info,
+                                                              batch_size, k);
+                break;
+            case 5:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 5>(A, B, info,
+                                                              batch_size, k);
+                break;
+            case 6:
+                LaunchBatchedCholeskySolveKernel<scalar_t, 6>(A, B, info,
+                                                              batch_size, k);
+                break;
+            default:
+                utility::LogError("Unsupported matrix size {}.", n);
+        }
+    });
+}
+
+template <typename scalar_t>
+void LaunchBatchedSymmetricEigen3x3Kernel(const scalar_t* A,
+                                          scalar_t* eigenvalues,
+                                          scalar_t* eigenvectors,
+                                          int64_t batch_size) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            batch_size, [=] OPEN3D_DEVICE(int64_t b) {
+                linalg_kernels::SymmetricEigen3x3<scalar_t>(
+                        A + b * 9, eigenvalues + b * 3, eigenvectors + b * 9);
+            });
+}
+
+void BatchedSymmetricEigen3x3CUDA(const void* A_data,
+                                  void* eigenvalues_data,
+                                  void* eigenvectors_data,
+                                  int64_t batch_size,
+                                  Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        LaunchBatchedSymmetricEigen3x3Kernel<scalar_t>(
+                static_cast<const scalar_t*>(A_data),
+                static_cast<scalar_t*>(eigenvalues_data),
+                static_cast<scalar_t*>(eigenvectors_data), batch_size);
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Register-resident kernels for a single small matrix of a batch. The matrix
+// sizes are template parameters, so that all loops have constant trip counts
+// and are fully unrolled. They are shared by the CPU and CUDA backends of the
+// batched linear algebra functions in BatchedLinalg.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+namespace linalg_kernels {
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t Abs(scalar_t x) {
+    return x < 0 ? -x : x;
+}
+
+/// Solves AX = B for a symmetric positive definite N x N matrix A with the
+/// Cholesky decomposition A = L L^T. A is read from its lower triangle. B and
+/// X are row-major N x \p k matrices, X may be the same array as B. Returns
+/// false if A is not positive definite, X is not written in that case.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE bool CholeskySolve(const scalar_t* A,
+                                      const scalar_t* B,
+                                      scalar_t* X,
+                                      int64_t k) {
+    scalar_t L[N][N];
+    for (int j = 0; j < N; ++j) {
+        scalar_t diag = A[j * N + j];
+        for (int p = 0; p < j; ++p) {
+            diag -= L[j][p] * L[j][p];
+        }
+        if (!(diag > 0)) {
+            return false;
+        }
+        L[j][j] = scalar_t(sqrt(diag));
+        const scalar_t inv_diag = scalar_t(1) / L[j][j];
+        for (int i = j + 1; i < N; ++i) {
+            scalar_t value = A[i * N + j];
+            for (int p = 0; p < j; ++p) {
+                value -= L[i][p] * L[j][p];
+            }
+            L[i][j] = value * inv_diag;
+        }
+    }
+
+    for (int64_t c = 0; c < k; ++c) {
+        // Forward substitution L y = b, then back substitution L^T x = y.
+        scalar_t y[N];
+        for (int i = 0; i < N; ++i) {
+            scalar_t value = B[i * k + c];
+            for (int p = 0; p < i; ++p) {
+                value -= L[i][p] * y[p];
+            }
+            y[i] = value / L[i][i];
+        }
+        for (int i = N - 1; i >= 0; --i) {
+            scalar_t value = y[i];
+            for (int p = i + 1; p < N; ++p) {
+                value -= L[p][i] * y[p];
+            }
+            y[i] = value / L[i][i];
+        }
+        for (int i = 0; i < N; ++i) {
+            X[i * k + c] = y[i];
+        }
+    }
+    return true;
+}
+
+/// One Jacobi rotation that zeroes a[P][Q] of the symmetric 3x3 matrix \p a
+/// and accumulates the rotation into the columns of \p v.
+template <typename scalar_t, int P, int Q>
+OPEN3D_HOST_DEVICE inline void JacobiRotate3x3(scalar_t a[3][3],
+                                               scalar_t v[3][3]) {
+    constexpr int R = 3 - P - Q;
+    const scalar_t a_pq = a[P][Q];
+    if (a_pq == 0) {
+        return;
+    }
+    const scalar_t theta = (a[Q][Q] - a[P][P]) / (2 * a_pq);
+    scalar_t t = scalar_t(1) /
+                 (Abs(theta) + scalar_t(sqrt(theta * theta + scalar_t(1))));
+    if (theta < 0) {
+        t = -t;
+    }
+    const scalar_t c = scalar_t(1) / scalar_t(sqrt(t * t + scalar_t(1)));
+    const scalar_t s = t * c;
+
+    a[P][P] -= t * a_pq;
+    a[Q][Q] += t * a_pq;
+    a[P][Q] = a[Q][P] = 0;
+    const scalar_t a_rp = a[R][P];
+    const scalar_t a_rq = a[R][Q];
+    a[R][P] = a[P][R] = c * a_rp - s * a_rq;
+    a[R][Q] = a[Q][R] = s * a_rp + c * a_rq;
+    for (int r = 0; r < 3; ++r) {
+        const scalar_t v_rp = v[r][P];
+        const scalar_t v_rq = v[r][Q];
+        v[r][P] = c * v_rp - s * v_rq;
+        v[r][Q] = s * v_rp + c * v_rq;
+    }
+}
+
+/// Swaps eigenpair \p I and \p J if eigenvalue \p I is the larger one.
+template <typename scalar_t, int I, int J>
+OPEN3D_HOST_DEVICE inline void SortEigenPair3x3(scalar_t w[3],
+                                                scalar_t v[3][3]) {
+    if (w[J] < w[I]) {
+        const scalar_t w_i = w[I];
+        w[I] = w[J];
+        w[J] = w_i;
+        for (int r = 0; r < 3; ++r) {
+            const scalar_t v_ri = v[r][I];
+            v[r][I] = v[r][J];
+            v[r][J] = v_ri;
+        }
+    }
+}
+
+/// Eigen decomposition of the symmetric row-major 3x3 matrix \p A with the
+/// cyclic Jacobi method, read from its upper triangle. The eigenvalues are
+/// written to \p eigenvalues in ascending order, and the corresponding unit
+/// eigenvectors to the columns of the row-major 3x3 \p eigenvectors.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void SymmetricEigen3x3(const scalar_t* A,
+                                          scalar_t* eigenvalues,
+                                          scalar_t* eigenvectors) {
+    // Jacobi sweeps converge quadratically, a handful is enough to reach
+    // machine precision for both float and double.
+    constexpr int kMaxSweeps = 8;
+    // std::numeric_limits is not available in device code.
+    const scalar_t epsilon = sizeof(scalar_t) == 4
+                                     ? scalar_t(1.1920929e-7)
+                                     : scalar_t(2.220446049250313e-16);
+    scalar_t a[3][3] = {{A[0], A[1], A[2]}, {A[1], A[4], A[5]},
+                        {A[2], A[5], A[8]}};
+    scalar_t v[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+        const scalar_t off_diag = Abs(a[0][1]) + Abs(a[0][2]) + Abs(a[1][2]);
+        const scalar_t diag = Abs(a[0][0]) + Abs(a[1][1]) + Abs(a[2][2]);
+        // Also stops for the zero matrix and once off_diag underflows.
+        if (!(off_diag > diag * epsilon)) {
+            break;
+        }
+        JacobiRotate3x3<scalar_t, 0, 1>(a, v);
+        JacobiRotate3x3<scalar_t, 0, 2>(a, v);
+        JacobiRotate3x3<scalar_t, 1, 2>(a, v);
+    }
+
+    scalar_t w[3] = {a[0][0], a[1][1], a[2][2]};
+    SortEigenPair3x3<scalar_t, 0, 1>(w, v);
+    SortEigenPair3x3<scalar_t, 1, 2>(w, v);
+    SortEigenPair3x3<scalar_t, 0, 1>(w, v);
+    for (int i = 0; i < 3; ++i) {
+        eigenvalues[i] = w[i];
+        for (int j = 0; j < 3; ++j) {
+            eigenvectors[i * 3 + j] = v[i][j];
+        }
+    }
+}
+
+}  // namespace linalg_kernels
+}  // namespace core
+}  // namespace open3d
@@ -207,6 +207,80 @@ inline cublasStatus_t trsm_cuda<double>(cublasHandle_t handle,
     return cublasDtrsm(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B,
                        ldb);
 }
+
+template <typename scalar_t>
+inline cublasStatus_t gemm_strided_batched_cuda(cublasHandle_t handle,
+                                                cublasOperation_t transa,
+                                                cublasOperation_t transb,
+                                                int m,
+                                                int n,
+                                                int k,
+                                                const scalar_t *alpha,
+                                                const scalar_t *A_data,
+                                                int lda,
+                                                long long int stride_A,
+                                                const scalar_t *B_data,
+                                                int ldb,
+                                                long long int stride_B,
+                                                const scalar_t *beta,
+                                                scalar_t *C_data,
+                                                int ldc,
+                                                long long int stride_C,
+                                                int batch_count) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<float>(cublasHandle_t handle,
+                                                       cublasOperation_t transa,
+                                                       cublasOperation_t transb,
+                                                       int m,
+                                                       int n,
+                                                       int k,
+                                                       const float *alpha,
+                                                       const float *A_data,
+                                                       int lda,
+                                                       long long int stride_A,
+                                                       const float *B_data,
+                                                       int ldb,
+                                                       long long int stride_B,
+                                                       const float *beta,
+                                                       float *C_data,
+                                                       int ldc,
+                                                       long long int stride_C,
+                                                       int batch_count) {
+    return cublasSgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_count);
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<double>(
+        cublasHandle_t handle,
+        cublasOperation_t transa,
+        cublasOperation_t transb,
+        int m,
+        int n,
+        int k,
+        const double *alpha,
+        const double *A_data,
+        int lda,
+        long long int stride_A,
+        const double *B_data,
+        int ldb,
+        long long int stride_B,
+        const double *beta,
+        double *C_data,
+        int ldc,
+        long long int stride_C,
+        int batch_count) {
+    return cublasDgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_count);
+}
 #endif
 }  // namespace core
 }  // namespace open3d
@@ -28,12 +28,18 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
 void Inverse(const Tensor &A, Tensor &output) {
+    if (A.NumDims() == 3) {
+        BatchedInverse(A, output);
+        return;
+    }
+
     // Check devices
     Device device = A.GetDevice();
 
@@ -28,10 +28,17 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
+
 namespace open3d {
 namespace core {
 
 void LeastSquares(const Tensor &A, const Tensor &B, Tensor &X) {
+    if (A.NumDims() == 3) {
+        BatchedLeastSquares(A, B, X);
+        return;
+    }
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
@@ -28,10 +28,17 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
+
 namespace open3d {
 namespace core {
 
 void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    if (A.NumDims() == 3) {
+        BatchedMatmul(A, B, output);
+        return;
+    }
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
@@ -28,10 +28,17 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
+
 namespace open3d {
 namespace core {
 
 void SVD(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
+    if (A.NumDims() == 3) {
+        BatchedSVD(A, U, S, VT);
+        return;
+    }
+
     // Check devices
     Device device = A.GetDevice();
 
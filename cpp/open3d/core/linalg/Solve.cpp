@@ -32,12 +32,18 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
 void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
+    if (A.NumDims() == 3) {
+        BatchedSolve(A, B, X);
+        return;
+    }
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
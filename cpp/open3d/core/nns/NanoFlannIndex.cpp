@@ -93,22 +93,26 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
 
+        // Non-const GetDataPtr() may detach, which is not thread-safe, so the
+        // pointers are fetched before the parallel search.
+        const Tensor query_points_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = static_cast<const scalar_t *>(
+                query_points_contiguous.GetDataPtr());
+        int64_t *indices_ptr =
+                static_cast<int64_t *>(batch_indices.GetDataPtr());
+        scalar_t *distances_ptr =
+                static_cast<scalar_t *>(batch_distances.GetDataPtr());
+        const int64_t dimension = GetDimension();
+
         // Parallel search.
         tbb::parallel_for(
                 tbb::blocked_range<size_t>(0, num_query_points),
                 [&](const tbb::blocked_range<size_t> &r) {
                     for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
                         holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                static_cast<size_t>(knn), single_indices,
-                                single_distances);
+                                query_ptr + i * dimension,
+                                static_cast<size_t>(knn), indices_ptr + i * knn,
+                                distances_ptr + i * knn);
                     }
                 });
         // Check if the number of neighbors are same.
@@ -163,6 +167,11 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
                     "larger than 0.");
         }
 
+        const Tensor query_points_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = static_cast<const scalar_t *>(
+                query_points_contiguous.GetDataPtr());
+        const int64_t dimension = GetDimension();
+
         // Parallel search.
         tbb::parallel_for(
                 tbb::blocked_range<size_t>(0, num_query_points),
@@ -172,9 +181,8 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
                         scalar_t radius = radii[i].Item<scalar_t>();
 
                         size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                radius * radius, ret_matches, params);
+                                query_ptr + i * dimension, radius * radius,
+                                ret_matches, params);
                         ret_matches.resize(num_results);
                         std::vector<size_t> single_indices;
                         std::vector<scalar_t> single_distances;
@@ -25,42 +25,34 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
 #include <list>
+#include <unordered_map>
 
 #include "open3d/geometry/IntersectionTest.h"
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
-
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+/// Handle of an edge or a triangle in the arena of BallPivoting. The upper 32
+/// bits select the pool, the lower 32 bits the element within the pool.
+typedef int64_t BallPivotingHandle;
+static const BallPivotingHandle BALL_PIVOTING_NULL = -1;
 
 class BallPivotingVertex {
 public:
     enum Type { Orphan = 0, Front = 1, Inner = 2 };
 
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
+    BallPivotingVertex() : type_(Orphan) {}
 
 public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    std::vector<BallPivotingHandle> edges_;
     Type type_;
 };
 
@@ -68,123 +60,157 @@ class BallPivotingEdge {
 public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
-
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
+    BallPivotingEdge(int source, int target)
+        : source_(source),
+          target_(target),
+          triangle0_(BALL_PIVOTING_NULL),
+          triangle1_(BALL_PIVOTING_NULL),
+          type_(Type::Front) {}
 
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    int source_;
+    int target_;
+    BallPivotingHandle triangle0_;
+    BallPivotingHandle triangle1_;
     Type type_;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
+/// Uniform grid over the points used for the fixed radius neighbourhood
+/// queries. The point indices are stored contiguously per cell.
+class BallPivotingGrid {
+public:
+    BallPivotingGrid(const std::vector<Eigen::Vector3d>& points,
+                     double cell_size)
+        : points_(points), cell_size_(cell_size) {
+        std::vector<Eigen::Vector3i> cells(points.size());
+        for (size_t idx = 0; idx < points.size(); ++idx) {
+            cells[idx] = Cell(points[idx]);
+            cell_ranges_[cells[idx]].second++;
+        }
+        int offset = 0;
+        for (auto& cell_range : cell_ranges_) {
+            int count = cell_range.second.second;
+            cell_range.second.first = offset;
+            cell_range.second.second = offset;
+            offset += count;
+        }
+        indices_.resize(points.size());
+        for (size_t idx = 0; idx < points.size(); ++idx) {
+            indices_[cell_ranges_[cells[idx]].second++] = static_cast<int>(idx);
         }
-        type_ = Type::Inner;
     }
-}
 
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            BallPivotingVertexPtr opp = GetOppositeVertex();
-            Eigen::Vector3d tr_norm =
-                    (target_->point_ - source_->point_)
-                            .cross(opp->point_ - source_->point_);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm =
-                    source_->normal_ + target_->normal_ + opp->normal_;
-            pt_norm /= pt_norm.norm();
-            if (pt_norm.dot(tr_norm) < 0) {
-                std::swap(target_, source_);
+    /// Returns the (squared distance, index) pairs of all points within
+    /// \p radius of \p query, sorted by distance.
+    void SearchRadius(const Eigen::Vector3d& query,
+                      double radius,
+                      std::vector<std::pair<double, int>>& neighbors) const {
+        neighbors.clear();
+        const double radius2 = radius * radius;
+        const int reach = static_cast<int>(std::ceil(radius / cell_size_));
+        const Eigen::Vector3i center = Cell(query);
+        for (int dx = -reach; dx <= reach; ++dx) {
+            for (int dy = -reach; dy <= reach; ++dy) {
+                for (int dz = -reach; dz <= reach; ++dz) {
+                    auto it = cell_ranges_.find(center +
+                                                Eigen::Vector3i(dx, dy, dz));
+                    if (it == cell_ranges_.end()) {
+                        continue;
+                    }
+                    for (int i = it->second.first; i < it->second.second;
+                         ++i) {
+                        double dist2 =
+                                (points_[indices_[i]] - query).squaredNorm();
+                        if (dist2 <= radius2) {
+                            neighbors.emplace_back(dist2, indices_[i]);
+                        }
+                    }
+                }
             }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
         }
+        std::sort(neighbors.begin(), neighbors.end());
     }
-}
 
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
+private:
+    Eigen::Vector3i Cell(const Eigen::Vector3d& point) const {
+        return Eigen::Vector3i(
+                static_cast<int>(std::floor(point(0) / cell_size_)),
+                static_cast<int>(std::floor(point(1) / cell_size_)),
+                static_cast<int>(std::floor(point(2) / cell_size_)));
     }
-}
 
+private:
+    const std::vector<Eigen::Vector3d>& points_;
+    double cell_size_;
+    std::unordered_map<Eigen::Vector3i,
+                       std::pair<int, int>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            cell_ranges_;
+    std::vector<int> indices_;
+};
+
+class BallPivotingWorker;
+
+/// State shared by all workers. Vertices are assigned to spatial tiles, and
+/// the edges and triangles created by a tile are stored in the pool of that
+/// tile, so that tiles can be processed in parallel as long as every worker
+/// only modifies the vertices of its own tile. The last pool belongs to the
+/// serial worker that stitches the tiles together.
+///
+/// Tiles seed and expand independently, so the processing order differs from
+/// a single tile run and the triangulation can differ where ball pivoting is
+/// ambiguous. It is deterministic for a given tile layout.
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+        : points_(pcd.points_),
+          normals_(pcd.normals_),
+          has_normals_(pcd.HasNormals()),
+          vertices_(pcd.points_.size()) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
-        }
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
+    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii);
+
+    BallPivotingEdge& Edge(BallPivotingHandle handle) {
+        return edge_pools_[handle >> 32][handle & 0xffffffff];
     }
 
+    BallPivotingTriangle& Triangle(BallPivotingHandle handle) {
+        return triangle_pools_[handle >> 32][handle & 0xffffffff];
+    }
+
+    int NumTiles() const { return static_cast<int>(tile_vertices_.size()); }
+
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -215,9 +241,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -230,195 +255,249 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
+    static Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
+                                             const Eigen::Vector3d& v1,
+                                             const Eigen::Vector3d& v2) {
+        Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+        double norm = normal.norm();
+        if (norm > 0) {
+            normal /= norm;
+        }
+        return normal;
+    }
+
+    bool IsCompatible(int v0, int v1, int v2) const {
+        Eigen::Vector3d normal =
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
+            normal *= -1;
+        }
+        return normal.dot(normals_[v0]) > -1e-16 &&
+               normal.dot(normals_[v1]) > -1e-16 &&
+               normal.dot(normals_[v2]) > -1e-16;
+    }
+
+private:
+    /// Splits the bounding box of the points into tiles that are large
+    /// compared to \p max_radius and assigns every vertex to a tile.
+    void SetupTiles(double max_radius);
+
+    /// Whether vertex \p vidx is closer than \p margin to a face of its tile
+    /// that is shared with another tile.
+    bool NearTileBorder(int vidx, double margin) const;
+
+    /// Appends the results of \p worker to the mesh and the global lists.
+    void Collect(BallPivotingWorker& worker);
+
+public:
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    bool has_normals_;
+    std::vector<BallPivotingVertex> vertices_;
+    std::vector<int> vertex_tile_;
+    std::vector<std::vector<int>> tile_vertices_;
+    Eigen::Vector3d tile_origin_;
+    Eigen::Vector3i tile_dims_;
+    double tile_size_;
+    std::vector<std::deque<BallPivotingEdge>> edge_pools_;
+    std::vector<std::deque<BallPivotingTriangle>> triangle_pools_;
+    std::unique_ptr<BallPivotingGrid> grid_;
+    std::list<BallPivotingHandle> edge_front_;
+    std::list<BallPivotingHandle> border_edges_;
+    std::shared_ptr<TriangleMesh> mesh_;
+};
+
+/// Expands the triangulation from seeds and front edges of one tile (or of the
+/// whole point cloud for the serial worker, \p tile < 0). Front edges that
+/// would create a triangle with a vertex of another tile are deferred to the
+/// serial worker.
+class BallPivotingWorker {
+public:
+    BallPivotingWorker(BallPivoting& bp, int tile)
+        : bp_(bp), tile_(tile), pool_(tile < 0 ? bp.NumTiles() : tile) {}
+
+    bool Owns(int vidx) const {
+        return tile_ < 0 || bp_.vertex_tile_[vidx] == tile_;
+    }
+
+    void SearchRadius(const Eigen::Vector3d& query,
+                      double radius,
+                      std::vector<int>& indices) {
+        bp_.grid_->SearchRadius(query, radius, neighbors_);
+        indices.resize(neighbors_.size());
+        for (size_t i = 0; i < neighbors_.size(); ++i) {
+            indices[i] = neighbors_[i].second;
+        }
+    }
+
+    void UpdateType(int vidx) {
+        BallPivotingVertex& vertex = bp_.vertices_[vidx];
+        if (vertex.edges_.empty()) {
+            vertex.type_ = BallPivotingVertex::Type::Orphan;
+        } else {
+            for (BallPivotingHandle edge : vertex.edges_) {
+                if (bp_.Edge(edge).type_ != BallPivotingEdge::Type::Inner) {
+                    vertex.type_ = BallPivotingVertex::Type::Front;
+                    return;
                 }
             }
+            vertex.type_ = BallPivotingVertex::Type::Inner;
         }
-        return nullptr;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
-        }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
-
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
-        }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
-
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
-        }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+    int GetOppositeVertex(const BallPivotingEdge& edge) {
+        if (edge.triangle0_ == BALL_PIVOTING_NULL) {
+            return -1;
+        }
+        const BallPivotingTriangle& triangle = bp_.Triangle(edge.triangle0_);
+        if (triangle.vert0_ != edge.source_ &&
+            triangle.vert0_ != edge.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != edge.source_ &&
+                   triangle.vert1_ != edge.target_) {
+            return triangle.vert1_;
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            return triangle.vert2_;
         }
-        mesh_->triangle_normals_.push_back(face_normal);
     }
 
-    Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
-                                      const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
-        Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
-        double norm = normal.norm();
-        if (norm > 0) {
-            normal /= norm;
+    void AddAdjacentTriangle(BallPivotingEdge& edge,
+                             BallPivotingHandle triangle) {
+        if (triangle != edge.triangle0_ && triangle != edge.triangle1_) {
+            if (edge.triangle0_ == BALL_PIVOTING_NULL) {
+                edge.triangle0_ = triangle;
+                edge.type_ = BallPivotingEdge::Type::Front;
+                // update orientation
+                int opp = GetOppositeVertex(edge);
+                const Eigen::Vector3d& source = bp_.points_[edge.source_];
+                Eigen::Vector3d tr_norm =
+                        (bp_.points_[edge.target_] - source)
+                                .cross(bp_.points_[opp] - source);
+                tr_norm /= tr_norm.norm();
+                Eigen::Vector3d pt_norm = bp_.normals_[edge.source_] +
+                                          bp_.normals_[edge.target_] +
+                                          bp_.normals_[opp];
+                pt_norm /= pt_norm.norm();
+                if (pt_norm.dot(tr_norm) < 0) {
+                    std::swap(edge.target_, edge.source_);
+                }
+            } else if (edge.triangle1_ == BALL_PIVOTING_NULL) {
+                edge.triangle1_ = triangle;
+                edge.type_ = BallPivotingEdge::Type::Inner;
+            } else {
+                utility::LogDebug("!!! This case should not happen");
+            }
         }
-        return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
-        Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
-            normal *= -1;
+    BallPivotingHandle GetLinkingEdge(int v0, int v1) {
+        for (BallPivotingHandle handle : bp_.vertices_[v0].edges_) {
+            const BallPivotingEdge& edge = bp_.Edge(handle);
+            if ((edge.source_ == v0 && edge.target_ == v1) ||
+                (edge.source_ == v1 && edge.target_ == v0)) {
+                return handle;
+            }
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
-        return ret;
+        return BALL_PIVOTING_NULL;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+    BallPivotingHandle LinkEdge(int v0, int v1, BallPivotingHandle triangle) {
+        BallPivotingHandle handle = GetLinkingEdge(v0, v1);
+        if (handle == BALL_PIVOTING_NULL) {
+            std::deque<BallPivotingEdge>& pool = bp_.edge_pools_[pool_];
+            handle = (BallPivotingHandle(pool_) << 32) |
+                     BallPivotingHandle(pool.size());
+            pool.emplace_back(v0, v1);
+        }
+        AddAdjacentTriangle(bp_.Edge(handle), triangle);
+        std::vector<BallPivotingHandle>& edges0 = bp_.vertices_[v0].edges_;
+        if (std::find(edges0.begin(), edges0.end(), handle) == edges0.end()) {
+            edges0.push_back(handle);
+        }
+        std::vector<BallPivotingHandle>& edges1 = bp_.vertices_[v1].edges_;
+        if (std::find(edges1.begin(), edges1.end(), handle) == edges1.end()) {
+            edges1.push_back(handle);
+        }
+        return handle;
+    }
+
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        std::deque<BallPivotingTriangle>& pool = bp_.triangle_pools_[pool_];
+        BallPivotingHandle triangle = (BallPivotingHandle(pool_) << 32) |
+                                      BallPivotingHandle(pool.size());
+        pool.emplace_back(v0, v1, v2, center);
+
+        LinkEdge(v0, v1, triangle);
+        LinkEdge(v1, v2, triangle);
+        LinkEdge(v2, v0, triangle);
+
+        UpdateType(v0);
+        UpdateType(v1);
+        UpdateType(v2);
+
+        Eigen::Vector3d face_normal = BallPivoting::ComputeFaceNormal(
+                bp_.points_[v0], bp_.points_[v1], bp_.points_[v2]);
+        if (face_normal.dot(bp_.normals_[v0]) > -1e-16) {
+            triangles_.emplace_back(v0, v1, v2);
+        } else {
+            triangles_.emplace_back(v0, v2, v1);
+        }
+        triangle_normals_.push_back(face_normal);
+    }
+
+    int FindCandidateVertex(const BallPivotingEdge& edge,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) {
+        const int src = edge.source_;
+        const int tgt = edge.target_;
+        const int opp = GetOppositeVertex(edge);
+        const Eigen::Vector3d& src_point = bp_.points_[src];
+        const Eigen::Vector3d& tgt_point = bp_.points_[tgt];
+        const Eigen::Vector3d& opp_point = bp_.points_[opp];
+
+        Eigen::Vector3d mp = 0.5 * (src_point + tgt_point);
+        const Eigen::Vector3d& center =
+                bp_.Triangle(edge.triangle0_).ball_center_;
+
+        Eigen::Vector3d v = tgt_point - src_point;
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
+        SearchRadius(mp, 2 * radius, indices_);
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+        for (int candidate : indices_) {
+            if (candidate == src || candidate == tgt || candidate == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
+            const Eigen::Vector3d& candidate_point = bp_.points_[candidate];
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    src_point, tgt_point, opp_point, candidate_point);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, candidate_point, src_point,
+                                     opp_point) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
+                                     mp, candidate_point, tgt_point,
+                                     opp_point) < 1e-12)) {
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!bp_.ComputeBallCenter(src, tgt, candidate, radius,
+                                       new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -428,323 +507,378 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+            for (int nb : indices_) {
+                if (nb == src || nb == tgt || nb == candidate) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - bp_.points_[nb]).norm() < radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
-
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
-        utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            BallPivotingHandle handle = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            BallPivotingEdge& edge = bp_.Edge(handle);
+            if (edge.type_ != BallPivotingEdge::Front) {
                 continue;
             }
+            const int src = edge.source_;
+            const int tgt = edge.target_;
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int candidate = FindCandidateVertex(edge, radius, center);
+            if (candidate >= 0 && !Owns(candidate)) {
+                deferred_edges_.push_back(handle);
+                continue;
+            }
+            if (candidate < 0 ||
+                bp_.vertices_[candidate].type_ ==
+                        BallPivotingVertex::Type::Inner ||
+                !bp_.IsCompatible(candidate, src, tgt)) {
+                edge.type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(handle);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            BallPivotingHandle e0 = GetLinkingEdge(candidate, src);
+            BallPivotingHandle e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 != BALL_PIVOTING_NULL &&
+                 bp_.Edge(e0).type_ != BallPivotingEdge::Type::Front) ||
+                (e1 != BALL_PIVOTING_NULL &&
+                 bp_.Edge(e1).type_ != BallPivotingEdge::Type::Front)) {
+                edge.type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(handle);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (bp_.Edge(e0).type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (bp_.Edge(e1).type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
                          Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
-                "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
-
-        if (!IsCompatible(v0, v1, v2)) {
+        if (!bp_.IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
+        BallPivotingHandle e0 = GetLinkingEdge(v0, v2);
+        BallPivotingHandle e1 = GetLinkingEdge(v1, v2);
+        if (e0 != BALL_PIVOTING_NULL &&
+            bp_.Edge(e0).type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
+        if (e1 != BALL_PIVOTING_NULL &&
+            bp_.Edge(e1).type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
+        if (!bp_.ComputeBallCenter(v0, v1, v2, radius, center)) {
             return false;
         }
 
         // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+        for (int nb : nb_indices) {
+            if (nb == v0 || nb == v1 || nb == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
+            if ((center - bp_.points_[nb]).norm() < radius - 1e-16) {
                 return false;
             }
         }
-
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
-        if (indices.size() < 3u) {
+    bool IsFrontOrNull(BallPivotingHandle handle) {
+        return handle == BALL_PIVOTING_NULL ||
+               bp_.Edge(handle).type_ == BallPivotingEdge::Type::Front;
+    }
+
+    bool TrySeed(int v, double radius) {
+        SearchRadius(bp_.points_[v], 2 * radius, indices_);
+        if (indices_.size() < 3u) {
             return false;
         }
 
-        for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
-                continue;
-            }
-            if (nb0->idx_ == v->idx_) {
+        for (size_t nbidx0 = 0; nbidx0 < indices_.size(); ++nbidx0) {
+            const int nb0 = indices_[nbidx0];
+            if (nb0 == v || !Owns(nb0) ||
+                bp_.vertices_[nb0].type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
-            for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
+            for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices_.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int candidate = indices_[nbidx1];
+                if (candidate == v || !Owns(candidate) ||
+                    bp_.vertices_[candidate].type_ !=
+                            BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
-                    continue;
-                }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices_, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+            if (nb1 >= 0) {
+                if (!IsFrontOrNull(GetLinkingEdge(v, nb1)) ||
+                    !IsFrontOrNull(GetLinkingEdge(nb0, nb1)) ||
+                    !IsFrontOrNull(GetLinkingEdge(v, nb0))) {
                     continue;
                 }
 
                 CreateTriangle(v, nb0, nb1, center);
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
+                BallPivotingHandle e0 = GetLinkingEdge(v, nb1);
+                BallPivotingHandle e1 = GetLinkingEdge(nb0, nb1);
+                BallPivotingHandle e2 = GetLinkingEdge(v, nb0);
+                if (bp_.Edge(e0).type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e0);
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
+                if (bp_.Edge(e1).type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e1);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
+                if (bp_.Edge(e2).type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e2);
                 }
 
                 if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
                     return true;
                 }
             }
         }
-
-        utility::LogDebug("[TrySeed] return false");
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+    void FindSeedTriangle(double radius, const std::vector<int>& seeds) {
+        for (int vidx : seeds) {
+            if (bp_.vertices_[vidx].type_ ==
+                BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(vidx, radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
+public:
+    std::deque<BallPivotingHandle> edge_front_;
+    std::vector<BallPivotingHandle> deferred_edges_;
+    std::vector<BallPivotingHandle> border_edges_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3d> triangle_normals_;
+
+private:
+    BallPivoting& bp_;
+    int tile_;
+    int pool_;
+    std::vector<int> indices_;
+    std::vector<std::pair<double, int>> neighbors_;
+};
+
+void BallPivoting::SetupTiles(double max_radius) {
+    Eigen::Vector3d max_bound = mesh_->GetMaxBound();
+    tile_origin_ = mesh_->GetMinBound();
+    Eigen::Vector3d extent = max_bound - tile_origin_;
+    // Tiles have to be large compared to the ball so that only few fronts
+    // cross their borders, but small enough to keep all threads busy.
+    tile_size_ = std::max(extent.maxCoeff() / 32.0, 20.0 * max_radius);
+    for (int d = 0; d < 3; ++d) {
+        tile_dims_(d) = std::max(
+                1, static_cast<int>(std::ceil(extent(d) / tile_size_)));
+    }
+    int num_tiles = tile_dims_(0) * tile_dims_(1) * tile_dims_(2);
+
+    vertex_tile_.resize(points_.size());
+    tile_vertices_.assign(num_tiles, std::vector<int>());
+    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
+        Eigen::Vector3d rel = (points_[vidx] - tile_origin_) / tile_size_;
+        int tile = 0;
+        for (int d = 2; d >= 0; --d) {
+            int coord = std::min(std::max(static_cast<int>(rel(d)), 0),
+                                 tile_dims_(d) - 1);
+            tile = tile * tile_dims_(d) + coord;
         }
+        vertex_tile_[vidx] = tile;
+        tile_vertices_[tile].push_back(static_cast<int>(vidx));
+    }
+    edge_pools_.resize(num_tiles + 1);
+    triangle_pools_.resize(num_tiles + 1);
+}
 
-        mesh_->triangles_.clear();
+bool BallPivoting::NearTileBorder(int vidx, double margin) const {
+    Eigen::Vector3d rel = points_[vidx] - tile_origin_;
+    for (int d = 0; d < 3; ++d) {
+        int coord = std::min(
+                std::max(static_cast<int>(rel(d) / tile_size_), 0),
+                tile_dims_(d) - 1);
+        if (coord > 0 && rel(d) - coord * tile_size_ < margin) {
+            return true;
+        }
+        if (coord < tile_dims_(d) - 1 &&
+            (coord + 1) * tile_size_ - rel(d) < margin) {
+            return true;
+        }
+    }
+    return false;
+}
 
-        for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
-            utility::LogDebug("[Run] change to radius {:.4f}", radius);
-            if (radius <= 0) {
-                utility::LogError(
-                        "got an invalid, negative radius as parameter");
-            }
+void BallPivoting::Collect(BallPivotingWorker& worker) {
+    mesh_->triangles_.insert(mesh_->triangles_.end(),
+                             worker.triangles_.begin(),
+                             worker.triangles_.end());
+    mesh_->triangle_normals_.insert(mesh_->triangle_normals_.end(),
+                                    worker.triangle_normals_.begin(),
+                                    worker.triangle_normals_.end());
+    border_edges_.insert(border_edges_.end(), worker.border_edges_.begin(),
+                         worker.border_edges_.end());
+    worker.triangles_.clear();
+    worker.triangle_normals_.clear();
+    worker.border_edges_.clear();
+}
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
+std::shared_ptr<TriangleMesh> BallPivoting::Run(
+        const std::vector<double>& radii) {
+    if (!has_normals_) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
 
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
+    mesh_->triangles_.clear();
+    if (points_.empty() || radii.empty()) {
+        return mesh_;
+    }
+    SetupTiles(*std::max_element(radii.begin(), radii.end()));
+    const int num_tiles = NumTiles();
+    utility::LogDebug("[Run] {:d} points in {:d} tiles", points_.size(),
+                      num_tiles);
+
+    for (double radius : radii) {
+        utility::LogDebug("[Run] change to radius {:.4f}", radius);
+        grid_.reset(new BallPivotingGrid(points_, 2 * radius));
+
+        // update radius => update border edges
+        std::vector<std::pair<double, int>> neighbors;
+        for (auto it = border_edges_.begin(); it != border_edges_.end();) {
+            BallPivotingEdge& edge = Edge(*it);
+            const BallPivotingTriangle& triangle = Triangle(edge.triangle0_);
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                grid_->SearchRadius(center, radius, neighbors);
+                bool empty_ball = true;
+                for (const auto& nb : neighbors) {
+                    if (nb.second != triangle.vert0_ &&
+                        nb.second != triangle.vert1_ &&
+                        nb.second != triangle.vert2_) {
+                        empty_ball = false;
+                        break;
                     }
                 }
-                ++it;
+
+                if (empty_ball) {
+                    edge.type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(*it);
+                    it = border_edges_.erase(it);
+                    continue;
+                }
             }
+            ++it;
+        }
+
+        // Seeds are only searched if there is nothing to expand, as in the
+        // serial algorithm.
+        const bool find_seeds = edge_front_.empty();
 
-            // do the reconstruction
-            if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
+        // Hand the front edges to the tile that owns both of their vertices.
+        std::vector<BallPivotingWorker> workers;
+        workers.reserve(num_tiles);
+        for (int tile = 0; tile < num_tiles; ++tile) {
+            workers.emplace_back(*this, tile);
+        }
+        BallPivotingWorker serial(*this, -1);
+        for (BallPivotingHandle handle : edge_front_) {
+            const BallPivotingEdge& edge = Edge(handle);
+            const int tile = vertex_tile_[edge.source_];
+            if (tile == vertex_tile_[edge.target_]) {
+                workers[tile].edge_front_.push_back(handle);
             } else {
-                ExpandTriangulation(radius);
+                serial.edge_front_.push_back(handle);
             }
+        }
+        edge_front_.clear();
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+#pragma omp parallel for schedule(dynamic)
+        for (int tile = 0; tile < num_tiles; ++tile) {
+            workers[tile].ExpandTriangulation(radius);
+            if (find_seeds) {
+                workers[tile].FindSeedTriangle(radius, tile_vertices_[tile]);
+            }
         }
-        return mesh_;
-    }
 
-private:
-    bool has_normals_;
-    KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
-    std::shared_ptr<TriangleMesh> mesh_;
-};
+        // Stitch the tiles: continue the deferred fronts and look for seeds
+        // that need vertices of several tiles.
+        for (BallPivotingWorker& worker : workers) {
+            serial.edge_front_.insert(serial.edge_front_.end(),
+                                      worker.deferred_edges_.begin(),
+                                      worker.deferred_edges_.end());
+            Collect(worker);
+        }
+        serial.ExpandTriangulation(radius);
+        if (find_seeds && num_tiles > 1) {
+            std::vector<int> seeds;
+            for (int vidx = 0; vidx < static_cast<int>(points_.size());
+                 ++vidx) {
+                if (vertices_[vidx].type_ == BallPivotingVertex::Type::Orphan &&
+                    NearTileBorder(vidx, 2 * radius)) {
+                    seeds.push_back(vidx);
+                }
+            }
+            serial.FindSeedTriangle(radius, seeds);
+        }
+        Collect(serial);
+
+        utility::LogDebug("[Run] mesh_ has {:d} triangles",
+                          mesh_->triangles_.size());
+    }
+    return mesh_;
+}
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
         const PointCloud& pcd, const std::vector<double>& radii) {
@@ -30,6 +30,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
 
 #include "open3d/geometry/PointCloud.h"
@@ -405,7 +406,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
              int depth,
-             size_t width,
+             float width,
              float scale,
              bool linear_fit,
              UIntPack<FEMSigs...>) {
@@ -723,6 +724,128 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+static void InitThreadPool(int n_threads) {
+    if (n_threads <= 0) {
+        n_threads = (int)std::thread::hardware_concurrency();
+    }
+
+#ifdef _OPENMP
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                     n_threads);
+#else
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                     n_threads);
+#endif
+}
+
+/// Regular grid of cubic tiles covering the bounding box of the input of the
+/// streaming reconstruction.
+class TileGrid {
+public:
+    TileGrid(const Eigen::Vector3d& min_bound,
+             const Eigen::Vector3d& max_bound,
+             size_t tile_depth,
+             double overlap)
+        : min_bound_(min_bound) {
+        Eigen::Vector3d extent = max_bound - min_bound;
+        double max_extent = std::max(extent.maxCoeff(), 1e-12);
+        edge_ = max_extent / double(size_t(1) << tile_depth);
+        margin_ = overlap * edge_;
+        for (int d = 0; d < 3; ++d) {
+            dims_(d) = std::max(1, int(std::ceil(extent(d) / edge_)));
+        }
+    }
+
+    size_t NumTiles() const { return size_t(dims_(0)) * dims_(1) * dims_(2); }
+
+    /// Calls \p f with the index of every tile whose bounds enlarged by the
+    /// overlap margin contain \p p.
+    template <typename F>
+    void ForEachTile(const Eigen::Vector3d& p, F f) const {
+        Eigen::Vector3i lo, hi;
+        for (int d = 0; d < 3; ++d) {
+            double x = p(d) - min_bound_(d);
+            lo(d) = Clamp(int(std::floor((x - margin_) / edge_)), d);
+            hi(d) = Clamp(int(std::floor((x + margin_) / edge_)), d);
+        }
+        for (int i = lo(0); i <= hi(0); ++i) {
+            for (int j = lo(1); j <= hi(1); ++j) {
+                for (int k = lo(2); k <= hi(2); ++k) {
+                    f(TileIndex(i, j, k));
+                }
+            }
+        }
+    }
+
+    /// Whether \p p lies in the core (non-overlapping) bounds of
+    /// \p tile_idx. Boundary tiles extend to infinity on their outer sides,
+    /// so every point belongs to exactly one tile.
+    bool InCore(size_t tile_idx, const Eigen::Vector3d& p) const {
+        int ijk[3] = {int(tile_idx % dims_(0)),
+                      int((tile_idx / dims_(0)) % dims_(1)),
+                      int(tile_idx / (size_t(dims_(0)) * dims_(1)))};
+        for (int d = 0; d < 3; ++d) {
+            double x = p(d) - min_bound_(d);
+            if (ijk[d] > 0 && x < ijk[d] * edge_) return false;
+            if (ijk[d] < dims_(d) - 1 && x >= (ijk[d] + 1) * edge_) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    int Clamp(int v, int d) const {
+        return std::min(std::max(v, 0), dims_(d) - 1);
+    }
+    size_t TileIndex(int i, int j, int k) const {
+        return (size_t(k) * dims_(1) + j) * dims_(0) + i;
+    }
+
+private:
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3i dims_;
+    double edge_;
+    double margin_;
+};
+
+/// Keeps the triangles of \p mesh whose centroid lies in the core of
+/// \p tile_idx and drops the vertices that are no longer referenced.
+static void CropToTile(const TileGrid& grid,
+                       size_t tile_idx,
+                       TriangleMesh& mesh,
+                       std::vector<double>& densities) {
+    std::vector<int> vertex_map(mesh.vertices_.size(), -1);
+    TriangleMesh cropped;
+    std::vector<double> cropped_densities;
+    for (const Eigen::Vector3i& triangle : mesh.triangles_) {
+        Eigen::Vector3d centroid = (mesh.vertices_[triangle(0)] +
+                                    mesh.vertices_[triangle(1)] +
+                                    mesh.vertices_[triangle(2)]) /
+                                   3.0;
+        if (!grid.InCore(tile_idx, centroid)) {
+            continue;
+        }
+        Eigen::Vector3i new_triangle;
+        for (int v = 0; v < 3; ++v) {
+            int& idx = vertex_map[triangle(v)];
+            if (idx < 0) {
+                idx = int(cropped.vertices_.size());
+                cropped.vertices_.push_back(mesh.vertices_[triangle(v)]);
+                cropped.vertex_normals_.push_back(
+                        mesh.vertex_normals_[triangle(v)]);
+                cropped.vertex_colors_.push_back(
+                        mesh.vertex_colors_[triangle(v)]);
+                cropped_densities.push_back(densities[triangle(v)]);
+            }
+            new_triangle(v) = idx;
+        }
+        cropped.triangles_.push_back(new_triangle);
+    }
+    mesh = std::move(cropped);
+    densities = std::move(cropped_densities);
+}
+
 }  // namespace poisson
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -742,27 +865,187 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
 
-    if (n_threads <= 0) {
-        n_threads = (int)std::thread::hardware_concurrency();
-    }
-
-#ifdef _OPENMP
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
-                     n_threads);
-#else
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
-                     n_threads);
-#endif
+    poisson::InitThreadPool(n_threads);
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
     poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+                            static_cast<float>(width), scale, linear_fit,
+                            FEMSigs());
 
     ThreadPool::Terminate();
 
     return std::make_tuple(mesh, densities);
 }
 
+void TriangleMesh::CreateFromPointCloudPoissonStreaming(
+        const PointCloudChunkSource& source,
+        const TriangleMeshChunkCallback& callback,
+        size_t depth,
+        size_t tile_depth,
+        double overlap,
+        size_t max_points_in_memory,
+        bool linear_fit,
+        int n_threads) {
+    static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
+    typedef IsotropicUIntPack<
+            poisson::DIMENSION,
+            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMSigs;
+
+    if (tile_depth + 2 > depth) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonStreaming] depth (={}) has to be "
+                ">= tile_depth (={}) + 2",
+                depth, tile_depth);
+    }
+    if (overlap < 0 || overlap >= 1) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonStreaming] overlap (={}) has to "
+                "be in [0, 1)",
+                overlap);
+    }
+
+    // Calls f(point_idx, chunk) for every point of the source.
+    PointCloud chunk;
+    auto ForEachPoint = [&](const std::function<void(size_t,
+                                                     const PointCloud&)>& f) {
+        for (size_t chunk_idx = 0;; ++chunk_idx) {
+            chunk.Clear();
+            if (!source(chunk_idx, chunk)) {
+                break;
+            }
+            if (!chunk.HasPoints()) {
+                continue;
+            }
+            if (!chunk.HasNormals()) {
+                utility::LogError(
+                        "[CreateFromPointCloudPoissonStreaming] chunk {} has "
+                        "no normals",
+                        chunk_idx);
+            }
+            for (size_t i = 0; i < chunk.points_.size(); ++i) {
+                f(i, chunk);
+            }
+        }
+    };
+
+    // First pass: bounding box of the whole input.
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector3d max_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+    size_t num_points = 0;
+    ForEachPoint([&](size_t i, const PointCloud& pcd) {
+        min_bound = min_bound.cwiseMin(pcd.points_[i]);
+        max_bound = max_bound.cwiseMax(pcd.points_[i]);
+        num_points++;
+    });
+    if (num_points == 0) {
+        utility::LogWarning(
+                "[CreateFromPointCloudPoissonStreaming] source has no points");
+        return;
+    }
+
+    // Second pass: number of points gathered by every tile.
+    poisson::TileGrid grid(min_bound, max_bound, tile_depth, overlap);
+    std::vector<size_t> tile_counts(grid.NumTiles(), 0);
+    ForEachPoint([&](size_t i, const PointCloud& pcd) {
+        grid.ForEachTile(pcd.points_[i],
+                         [&](size_t tile_idx) { tile_counts[tile_idx]++; });
+    });
+
+    // Group the tiles into batches that fit the memory budget.
+    std::vector<std::vector<size_t>> batches;
+    size_t batch_points = 0;
+    size_t num_tiles = 0;
+    for (size_t tile_idx = 0; tile_idx < tile_counts.size(); ++tile_idx) {
+        if (tile_counts[tile_idx] == 0) {
+            continue;
+        }
+        num_tiles++;
+        if (tile_counts[tile_idx] > max_points_in_memory) {
+            utility::LogWarning(
+                    "[CreateFromPointCloudPoissonStreaming] tile {} has {} "
+                    "points, more than max_points_in_memory (={}). Consider "
+                    "increasing tile_depth.",
+                    tile_idx, tile_counts[tile_idx], max_points_in_memory);
+        }
+        if (batches.empty() ||
+            batch_points + tile_counts[tile_idx] > max_points_in_memory) {
+            batches.emplace_back();
+            batch_points = 0;
+        }
+        batches.back().push_back(tile_idx);
+        batch_points += tile_counts[tile_idx];
+    }
+    utility::LogDebug(
+            "[CreateFromPointCloudPoissonStreaming] {} points, {} non-empty "
+            "tiles in {} batches",
+            num_points, num_tiles, batches.size());
+
+    // Finest cell size of the equivalent in-memory reconstruction.
+    const double width = (max_bound - min_bound).maxCoeff() * 1.1 /
+                         double(size_t(1) << depth);
+
+    poisson::InitThreadPool(n_threads);
+    std::vector<int> tile_to_slot(grid.NumTiles(), -1);
+    for (const std::vector<size_t>& batch : batches) {
+        std::vector<PointCloud> tiles(batch.size());
+        for (size_t slot = 0; slot < batch.size(); ++slot) {
+            tile_to_slot[batch[slot]] = int(slot);
+            tiles[slot].points_.reserve(tile_counts[batch[slot]]);
+            tiles[slot].normals_.reserve(tile_counts[batch[slot]]);
+        }
+        ForEachPoint([&](size_t i, const PointCloud& pcd) {
+            grid.ForEachTile(pcd.points_[i], [&](size_t tile_idx) {
+                int slot = tile_to_slot[tile_idx];
+                if (slot < 0) {
+                    return;
+                }
+                PointCloud& tile = tiles[slot];
+                tile.points_.push_back(pcd.points_[i]);
+                tile.normals_.push_back(pcd.normals_[i]);
+                if (pcd.HasColors()) {
+                    tile.colors_.push_back(pcd.colors_[i]);
+                }
+            });
+        });
+
+        for (size_t slot = 0; slot < batch.size(); ++slot) {
+            size_t tile_idx = batch[slot];
+            tile_to_slot[tile_idx] = -1;
+            PointCloud& tile = tiles[slot];
+            if (tile.colors_.size() != tile.points_.size()) {
+                tile.colors_.clear();
+            }
+            // The solver needs at least 4 cells of the finest level.
+            if ((tile.GetMaxBound() - tile.GetMinBound()).maxCoeff() <
+                4 * width) {
+                utility::LogWarning(
+                        "[CreateFromPointCloudPoissonStreaming] skipping "
+                        "degenerate tile {} with {} points, its surface is "
+                        "dropped",
+                        tile_idx, tile.points_.size());
+                tile.Clear();
+                continue;
+            }
+
+            auto mesh = std::make_shared<TriangleMesh>();
+            std::vector<double> densities;
+            poisson::Execute<float>(tile, mesh, densities, 0,
+                                    static_cast<float>(width), 1.1f,
+                                    linear_fit, FEMSigs());
+            tile.Clear();
+            poisson::CropToTile(grid, tile_idx, *mesh, densities);
+            if (!mesh->triangles_.empty()) {
+                callback(*mesh, densities);
+            }
+        }
+    }
+
+    ThreadPool::Terminate();
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -542,7 +543,12 @@ public:
     /// Parallel Ball Pivoting Algorithm", 2014. The surface reconstruction is
     /// done by rolling a ball with a given radius (cf. \p radii) over the
     /// point cloud, whenever the ball touches three points a triangle is
-    /// created.
+    /// created. Large point clouds are split into spatial tiles that are
+    /// triangulated in parallel and stitched serially. As the result of ball
+    /// pivoting depends on the order in which seeds and fronts are processed,
+    /// the triangles can differ from a single tile run where several pivots
+    /// are valid, e.g. for (nearly) co-circular points. The result does not
+    /// depend on the number of threads.
     /// \param pcd defines the PointCloud from which the TriangleMesh surface is
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
@@ -581,6 +587,57 @@ public:
                                 bool linear_fit = false,
                                 int n_threads = -1);
 
+    /// \brief Callback that provides the input of
+    /// CreateFromPointCloudPoissonStreaming. It is called with increasing
+    /// \p chunk_index starting at 0, fills \p chunk with the points (and
+    /// normals, optionally colors) of that chunk and returns false once the
+    /// source is exhausted. The source is read several times, so it must be
+    /// able to restart from chunk 0.
+    typedef std::function<bool(size_t chunk_index, PointCloud &chunk)>
+            PointCloudChunkSource;
+
+    /// \brief Callback that receives the output of
+    /// CreateFromPointCloudPoissonStreaming, one mesh per reconstructed tile
+    /// together with the per vertex densities of that mesh.
+    typedef std::function<void(const TriangleMesh &mesh,
+                               const std::vector<double> &densities)>
+            TriangleMeshChunkCallback;
+
+    /// \brief Out-of-core variant of CreateFromPointCloudPoisson.
+    ///
+    /// The bounding box of the input is split into a regular grid of cubic
+    /// tiles whose edge is 1 / 2^tile_depth of the largest extent. Each tile
+    /// is reconstructed independently from the points inside its bounds
+    /// enlarged by \p overlap, with the same finest cell size as a single
+    /// reconstruction of depth \p depth over the whole cloud. Only the
+    /// triangles whose centroid lies inside the tile are emitted, so peak
+    /// memory is bounded by \p max_points_in_memory and the size of a single
+    /// tile instead of the whole input. Vertices on tile borders are not
+    /// merged.
+    ///
+    /// \param source Chunked point source, see PointCloudChunkSource.
+    /// \param callback Called once for every non-empty tile.
+    /// \param depth Depth of the equivalent in-memory reconstruction.
+    /// \param tile_depth Number of octree levels handled by tiling, i.e. each
+    /// tile is solved at depth \p depth - \p tile_depth.
+    /// \param overlap Fraction of the tile edge added on every side of a tile
+    /// when gathering its points.
+    /// \param max_points_in_memory Upper bound on the number of points
+    /// gathered at once. Tiles are read in batches that fit this budget.
+    /// \param linear_fit If true, the reconstructor use linear interpolation
+    /// to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for the octree solve of a
+    /// tile. Set to -1 to automatically determine it.
+    static void CreateFromPointCloudPoissonStreaming(
+            const PointCloudChunkSource &source,
+            const TriangleMeshChunkCallback &callback,
+            size_t depth = 10,
+            size_t tile_depth = 2,
+            double overlap = 0.1,
+            size_t max_points_in_memory = 10000000,
+            bool linear_fit = false,
+            int n_threads = -1);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
     /// distance from the center to the mesh vertices.
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/AsyncImageWriter.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+AsyncImageWriter::AsyncImageWriter(int num_workers,
+                                   size_t queue_capacity,
+                                   bool drop_when_full)
+    : capacity_(queue_capacity > 0 ? queue_capacity : 1),
+      drop_when_full_(drop_when_full) {
+    if (num_workers <= 0) {
+        num_workers = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < num_workers; i++) {
+        workers_.emplace_back(&AsyncImageWriter::Run, this);
+    }
+}
+
+AsyncImageWriter::~AsyncImageWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_cv_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+bool AsyncImageWriter::Write(
+        const std::string &filename,
+        const std::shared_ptr<const geometry::Image> &image,
+        int quality) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_) {
+        if (drop_when_full_) {
+            statistics_.num_dropped_++;
+            return false;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        done_cv_.wait(lock, [this]() { return queue_.size() < capacity_; });
+        statistics_.blocked_seconds_ +=
+                std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    }
+    queue_.push_back(Task{filename, image, quality});
+    num_pending_++;
+    statistics_.max_queue_size_ =
+            std::max(statistics_.max_queue_size_, queue_.size());
+    lock.unlock();
+    task_cv_.notify_one();
+    return true;
+}
+
+bool AsyncImageWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return num_pending_ == 0; });
+    const bool success = !failed_since_flush_;
+    failed_since_flush_ = false;
+    return success;
+}
+
+size_t AsyncImageWriter::QueueSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+AsyncImageWriter::Statistics AsyncImageWriter::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void AsyncImageWriter::Run() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_cv_.wait(lock, [this]() { return !queue_.empty() || stop_; });
+            // Queued images are written before the workers stop.
+            if (queue_.empty()) {
+                break;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        done_cv_.notify_all();
+
+        const auto start = std::chrono::steady_clock::now();
+        bool success = false;
+        try {
+            success = WriteImage(task.filename_, *task.image_, task.quality_);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write image {} failed: {}", task.filename_,
+                                e.what());
+        }
+        const double seconds = std::chrono::duration<double>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count();
+        task.image_.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            statistics_.write_seconds_ += seconds;
+            if (success) {
+                statistics_.num_written_++;
+            } else {
+                statistics_.num_failed_++;
+                failed_since_flush_ = true;
+            }
+            num_pending_--;
+        }
+        done_cv_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
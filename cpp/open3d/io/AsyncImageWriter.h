@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/io/ImageIO.h"
+
+namespace open3d {
+namespace io {
+
+/// \class AsyncImageWriter
+///
+/// \brief Encodes and writes images on a pool of worker threads, so that a
+/// capture loop is not slowed down by the PNG or JPG encoder.
+///
+/// Write() queues an image and returns immediately while the queue holds
+/// fewer than \p queue_capacity images. When the queue is full, Write()
+/// either waits for a free slot or drops the image, depending on
+/// \p drop_when_full. GetStatistics() reports how often this happened.
+class AsyncImageWriter {
+public:
+    /// Counters of an AsyncImageWriter since its construction.
+    struct Statistics {
+        /// Number of images written successfully.
+        size_t num_written_ = 0;
+        /// Number of images that could not be written.
+        size_t num_failed_ = 0;
+        /// Number of images dropped because the queue was full.
+        size_t num_dropped_ = 0;
+        /// Largest number of images waiting in the queue.
+        size_t max_queue_size_ = 0;
+        /// Total time Write() waited for a free slot in the queue, in
+        /// seconds.
+        double blocked_seconds_ = 0.0;
+        /// Total time the workers spent encoding and writing, in seconds.
+        double write_seconds_ = 0.0;
+    };
+
+    /// \param num_workers Number of worker threads. 0 uses one thread per
+    /// hardware thread.
+    /// \param queue_capacity Maximum number of images waiting to be written.
+    /// \param drop_when_full If true, Write() drops images when the queue is
+    /// full instead of waiting.
+    AsyncImageWriter(int num_workers = 0,
+                     size_t queue_capacity = 16,
+                     bool drop_when_full = false);
+    AsyncImageWriter(const AsyncImageWriter &) = delete;
+    AsyncImageWriter &operator=(const AsyncImageWriter &) = delete;
+
+    /// Writes all queued images before returning.
+    ~AsyncImageWriter();
+
+public:
+    /// \brief Queues \p image to be written to \p filename. The image must not
+    /// be modified until it is written. See WriteImage() for \p quality.
+    ///
+    /// \return false if the image is dropped because the queue is full.
+    bool Write(const std::string &filename,
+               const std::shared_ptr<const geometry::Image> &image,
+               int quality = kOpen3DImageIODefaultQuality);
+
+    /// Queues a copy of \p image to be written to \p filename.
+    bool Write(const std::string &filename,
+               const geometry::Image &image,
+               int quality = kOpen3DImageIODefaultQuality) {
+        return Write(filename, std::make_shared<geometry::Image>(image),
+                     quality);
+    }
+
+    /// \brief Waits until all queued images are written.
+    ///
+    /// \return false if an image could not be written since the previous
+    /// call of Flush().
+    bool Flush();
+
+    /// Returns the number of images waiting in the queue.
+    size_t QueueSize() const;
+
+    Statistics GetStatistics() const;
+
+private:
+    struct Task {
+        std::string filename_;
+        std::shared_ptr<const geometry::Image> image_;
+        int quality_;
+    };
+
+    void Run();
+
+    size_t capacity_;
+    bool drop_when_full_;
+    std::deque<Task> queue_;
+    /// Number of queued images and images being written.
+    size_t num_pending_ = 0;
+    bool failed_since_flush_ = false;
+    bool stop_ = false;
+    Statistics statistics_;
+    mutable std::mutex mutex_;
+    /// Signals the workers that a task is queued or that they should stop.
+    std::condition_variable task_cv_;
+    /// Signals Write() that a slot is free and Flush() that a task is done.
+    std::condition_variable done_cv_;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace open3d
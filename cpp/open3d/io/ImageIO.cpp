@@ -26,6 +26,7 @@
 
 #include "open3d/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "open3d/utility/Console.h"
@@ -45,6 +46,15 @@ static const std::unordered_map<
                 {"jpeg", ReadImageFromJPG},
         };
 
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, const ImageBufferAllocator &)>>
+        file_extension_to_image_buffer_read_function{
+                {"png", ReadImageBufferFromPNG},
+                {"jpg", ReadImageBufferFromJPG},
+                {"jpeg", ReadImageBufferFromJPG},
+        };
+
 static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &, const geometry::Image &, int)>>
@@ -83,6 +93,38 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
     return map_itr->second(filename, image);
 }
 
+bool ReadImageBuffer(const std::string &filename,
+                     const ImageBufferAllocator &allocate) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext.empty()) {
+        utility::LogWarning(
+                "Read geometry::Image failed: missing file extension.");
+        return false;
+    }
+    auto map_itr =
+            file_extension_to_image_buffer_read_function.find(filename_ext);
+    if (map_itr == file_extension_to_image_buffer_read_function.end()) {
+        utility::LogWarning(
+                "Read geometry::Image failed: file extension {} unknown",
+                filename_ext);
+        return false;
+    }
+    return map_itr->second(filename, allocate);
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images) {
+    images.resize(filenames.size());
+    std::vector<uint8_t> success(filenames.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < int64_t(filenames.size()); i++) {
+        success[i] = ReadImage(filenames[i], images[i]);
+    }
+    return std::all_of(success.begin(), success.end(),
+                       [](uint8_t s) { return s != 0; });
+}
+
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
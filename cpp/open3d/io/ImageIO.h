@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "open3d/geometry/Image.h"
 
@@ -41,17 +43,37 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// The general entrance for reading an Image from a file
 /// The function calls read functions based on the extension name of filename.
 /// \return return true if the read function is successful, false otherwise.
+/// The buffer of \p image is reused if it has the size of the file.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// \brief Returns the buffer an image is decoded into, given its width,
+/// height, number of channels and bytes per channel. The buffer must hold
+/// width * height * num_of_channels * bytes_per_channel bytes, pixels are
+/// stored row by row. Returning nullptr cancels reading.
+using ImageBufferAllocator = std::function<uint8_t *(
+        int width, int height, int num_of_channels, int bytes_per_channel)>;
+
+/// \brief Decodes an image file into a buffer returned by \p allocate, e.g.
+/// the memory of a preallocated tensor. 16 bit PNG samples are stored in
+/// host byte order.
+bool ReadImageBuffer(const std::string &filename,
+                     const ImageBufferAllocator &allocate);
+
+/// \brief Reads the files \p filenames into \p images in parallel. The
+/// buffers of \p images are reused if they have the size of the files.
+/// \return true if all files are read successfully.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images);
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports quality, the parameter will be used.
 /// Otherwise it will be ignored.
-/// \param quality: PNG: [0-9] <=2 fast write for storing intermediate data
-///                            >=3 (default) normal write for balanced speed and
-///                            file size
+/// \param quality: PNG: [0-9] zlib compression level. <=2 fast write for
+///                            storing intermediate data, >=3 (default 6)
+///                            normal write for balanced speed and file size
 ///                 JPEG: [0-100] Typically in [70,95]. 90 is default (good
 ///                 quality).
 /// \return return true if the write function is successful, false otherwise.
@@ -61,12 +83,20 @@ bool WriteImage(const std::string &filename,
 
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
 
+/// Decodes a PNG file into a buffer returned by \p allocate.
+bool ReadImageBufferFromPNG(const std::string &filename,
+                            const ImageBufferAllocator &allocate);
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
 
 bool ReadImageFromJPG(const std::string &filename, geometry::Image &image);
 
+/// Decodes a JPG file into a buffer returned by \p allocate.
+bool ReadImageBufferFromJPG(const std::string &filename,
+                            const ImageBufferAllocator &allocate);
+
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
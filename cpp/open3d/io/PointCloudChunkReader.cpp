@@ -0,0 +1,433 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudChunkReader.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+#include "open3d/io/file_format/BinaryPLY.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
+#include "open3d/io/file_format/PCDData.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// @cond
+namespace {
+
+class ChunkSource {
+public:
+    virtual ~ChunkSource() {}
+    virtual bool Open(const std::string &filename) = 0;
+    /// Reads at most \p max_points points into \p chunk. Returns false at the
+    /// end of the file or on errors.
+    virtual bool Read(int64_t max_points, geometry::PointCloud &chunk) = 0;
+    virtual int64_t NumPoints() const = 0;
+};
+
+/// Text formats with one point per line. The file is read in blocks, the
+/// partial line at the end of a block is kept for the next one.
+class ASCIIChunkSource : public ChunkSource {
+public:
+    enum class Attribute { None, Normals, Colors };
+
+    explicit ASCIIChunkSource(Attribute attribute)
+        : attribute_(attribute),
+          num_fields_(attribute == Attribute::None ? 3 : 6) {}
+    ~ASCIIChunkSource() override {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) override {
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (!file_) {
+            utility::LogWarning("Read point cloud failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    bool Read(int64_t max_points, geometry::PointCloud &chunk) override {
+        while (NumParsedRecords() < max_points && !eof_) {
+            if (!ReadBlock()) {
+                return false;
+            }
+        }
+        const int64_t num_points = std::min(max_points, NumParsedRecords());
+        if (num_points == 0) {
+            return false;
+        }
+        const double *values = values_.data() + record_begin_ * num_fields_;
+        chunk.Clear();
+        chunk.points_.resize(num_points);
+        std::vector<Eigen::Vector3d> *attribute = nullptr;
+        if (attribute_ == Attribute::Normals) {
+            attribute = &chunk.normals_;
+        } else if (attribute_ == Attribute::Colors) {
+            attribute = &chunk.colors_;
+        }
+        if (attribute) {
+            attribute->resize(num_points);
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *record = values + i * num_fields_;
+            chunk.points_[i] = Eigen::Vector3d(record[0], record[1], record[2]);
+            if (attribute) {
+                (*attribute)[i] =
+                        Eigen::Vector3d(record[3], record[4], record[5]);
+            }
+        }
+        record_begin_ += num_points;
+        return true;
+    }
+
+    int64_t NumPoints() const override { return -1; }
+
+private:
+    int64_t NumParsedRecords() const {
+        return int64_t(values_.size()) / num_fields_ - record_begin_;
+    }
+
+    /// Reads the next block of the file and parses its complete lines.
+    bool ReadBlock() {
+        static const size_t kBlockSize = 4 << 20;
+        values_.erase(values_.begin(),
+                      values_.begin() + record_begin_ * num_fields_);
+        record_begin_ = 0;
+
+        const size_t tail_size = text_.size();
+        text_.resize(tail_size + kBlockSize);
+        const size_t read_size =
+                fread(text_.data() + tail_size, 1, kBlockSize, file_);
+        text_.resize(tail_size + read_size);
+        if (read_size < kBlockSize) {
+            if (ferror(file_)) {
+                utility::LogWarning("Read point cloud failed: read error.");
+                return false;
+            }
+            eof_ = true;
+        }
+
+        int64_t parse_size = int64_t(text_.size());
+        if (!eof_) {
+            // Lines longer than a block are completed by the next block.
+            while (parse_size > 0 && text_[parse_size - 1] != '\n') {
+                parse_size--;
+            }
+        }
+        if (parse_size > 0) {
+            std::vector<double> values =
+                    ParseASCIIRecords(text_.data(), parse_size, num_fields_);
+            values_.insert(values_.end(), values.begin(), values.end());
+            text_.erase(text_.begin(), text_.begin() + parse_size);
+        }
+        return true;
+    }
+
+private:
+    Attribute attribute_;
+    int num_fields_;
+    FILE *file_ = nullptr;
+    bool eof_ = false;
+    /// Text after the last complete line read so far.
+    std::vector<char> text_;
+    /// Parsed records, the first record_begin_ records are already returned.
+    std::vector<double> values_;
+    int64_t record_begin_ = 0;
+};
+
+/// Binary PLY files, read from a memory map by ranges of vertices.
+class PLYChunkSource : public ChunkSource {
+public:
+    bool Open(const std::string &filename) override {
+        if (!reader_.Open(filename)) {
+            utility::LogWarning(
+                    "Read point cloud failed: {} is not a valid binary PLY "
+                    "file, ASCII PLY files cannot be read in chunks.",
+                    filename);
+            return false;
+        }
+        vertex_ = reader_.GetElement("vertex");
+        if (!vertex_ || vertex_->stride_ == 0 ||
+            !GetProperties({"x", "y", "z"}, points_)) {
+            utility::LogWarning(
+                    "Read point cloud failed: {} has no vertices with fixed "
+                    "size records.",
+                    filename);
+            return false;
+        }
+        has_normals_ = GetProperties({"nx", "ny", "nz"}, normals_);
+        has_colors_ = GetProperties({"red", "green", "blue"}, colors_);
+        return true;
+    }
+
+    bool Read(int64_t max_points, geometry::PointCloud &chunk) override {
+        const int64_t num_points = std::min(max_points, vertex_->count_ - pos_);
+        if (num_points <= 0) {
+            return false;
+        }
+        chunk.Clear();
+        ReadProperties(points_, num_points, chunk.points_);
+        if (has_normals_) {
+            ReadProperties(normals_, num_points, chunk.normals_);
+        }
+        if (has_colors_) {
+            ReadProperties(colors_, num_points, chunk.colors_);
+#pragma omp parallel for schedule(static)
+            for (int64_t i = 0; i < num_points; i++) {
+                chunk.colors_[i] /= 255.0;
+            }
+        }
+        pos_ += num_points;
+        return true;
+    }
+
+    int64_t NumPoints() const override { return vertex_->count_; }
+
+private:
+    typedef std::array<const BinaryPLYReader::Property *, 3> Properties;
+
+    bool GetProperties(const std::array<const char *, 3> &names,
+                       Properties &properties) const {
+        for (int i = 0; i < 3; i++) {
+            properties[i] = vertex_->GetProperty(names[i]);
+            if (!properties[i] || properties[i]->IsList()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ReadProperties(const Properties &properties,
+                        int64_t num_points,
+                        std::vector<Eigen::Vector3d> &dst) const {
+        dst.resize(num_points);
+        for (int i = 0; i < 3; i++) {
+            reader_.ReadProperty(*vertex_, *properties[i],
+                                 dst.data()->data() + i, 3, pos_, num_points);
+        }
+    }
+
+private:
+    BinaryPLYReader reader_;
+    const BinaryPLYReader::Element *vertex_ = nullptr;
+    Properties points_;
+    Properties normals_;
+    Properties colors_;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    int64_t pos_ = 0;
+};
+
+/// Binary PCD files. Binary data is read one chunk at a time,
+/// binary_compressed data is decompressed as a whole.
+class PCDChunkSource : public ChunkSource {
+public:
+    ~PCDChunkSource() override {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) override {
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (!file_) {
+            utility::LogWarning("Read point cloud failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        if (!ReadPCDHeader(file_, header_)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            return false;
+        }
+        if (header_.datatype == PCD_DATA_ASCII) {
+            utility::LogWarning(
+                    "Read point cloud failed: ASCII PCD files cannot be read "
+                    "in chunks.");
+            return false;
+        }
+        if (header_.datatype == PCD_DATA_BINARY_COMPRESSED) {
+            return data_.Read(file_, header_);
+        }
+        return true;
+    }
+
+    bool Read(int64_t max_points, geometry::PointCloud &chunk) override {
+        const int64_t num_points =
+                std::min(max_points, int64_t(header_.points) - pos_);
+        if (num_points <= 0) {
+            return false;
+        }
+        int64_t begin = pos_;
+        if (header_.datatype == PCD_DATA_BINARY) {
+            if (!data_.ReadPoints(file_, header_, num_points)) {
+                return false;
+            }
+            begin = 0;
+        }
+        chunk.Clear();
+        chunk.points_.resize(num_points);
+        if (header_.has_normals) {
+            chunk.normals_.resize(num_points);
+        }
+        if (header_.has_colors) {
+            chunk.colors_.resize(num_points);
+        }
+        for (const auto &field : header_.fields) {
+            if (field.name == "x") {
+                data_.DecodeField(field, chunk.points_[0].data() + 0, 3, begin,
+                                  num_points);
+            } else if (field.name == "y") {
+                data_.DecodeField(field, chunk.points_[0].data() + 1, 3, begin,
+                                  num_points);
+            } else if (field.name == "z") {
+                data_.DecodeField(field, chunk.points_[0].data() + 2, 3, begin,
+                                  num_points);
+            } else if (field.name == "normal_x" && header_.has_normals) {
+                data_.DecodeField(field, chunk.normals_[0].data() + 0, 3,
+                                  begin, num_points);
+            } else if (field.name == "normal_y" && header_.has_normals) {
+                data_.DecodeField(field, chunk.normals_[0].data() + 1, 3,
+                                  begin, num_points);
+            } else if (field.name == "normal_z" && header_.has_normals) {
+                data_.DecodeField(field, chunk.normals_[0].data() + 2, 3,
+                                  begin, num_points);
+            } else if (field.name == "rgb" || field.name == "rgba") {
+                data_.DecodeColorField(field, chunk.colors_[0].data(), 3,
+                                       begin, num_points);
+            }
+        }
+        pos_ += num_points;
+        return true;
+    }
+
+    int64_t NumPoints() const override { return header_.points; }
+
+private:
+    FILE *file_ = nullptr;
+    PCDHeader header_;
+    PCDBinaryData data_;
+    int64_t pos_ = 0;
+};
+
+std::shared_ptr<ChunkSource> CreateChunkSource(const std::string &format) {
+    if (format == "xyz") {
+        return std::make_shared<ASCIIChunkSource>(
+                ASCIIChunkSource::Attribute::None);
+    } else if (format == "xyzn") {
+        return std::make_shared<ASCIIChunkSource>(
+                ASCIIChunkSource::Attribute::Normals);
+    } else if (format == "xyzrgb") {
+        return std::make_shared<ASCIIChunkSource>(
+                ASCIIChunkSource::Attribute::Colors);
+    } else if (format == "ply") {
+        return std::make_shared<PLYChunkSource>();
+    } else if (format == "pcd") {
+        return std::make_shared<PCDChunkSource>();
+    }
+    return nullptr;
+}
+
+}  // unnamed namespace
+/// @endcond
+
+bool PointCloudChunkReader::Open(const std::string &filename,
+                                 int64_t chunk_size,
+                                 size_t read_ahead,
+                                 const ReadPointCloudOption &params) {
+    Close();
+    if (chunk_size <= 0) {
+        utility::LogWarning("Read point cloud failed: invalid chunk size {}.",
+                            chunk_size);
+        return false;
+    }
+    const std::string format =
+            params.format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : params.format;
+    std::shared_ptr<ChunkSource> source = CreateChunkSource(format);
+    if (!source) {
+        utility::LogWarning(
+                "Read point cloud failed: format {} cannot be read in chunks.",
+                format);
+        return false;
+    }
+    if (!source->Open(filename)) {
+        return false;
+    }
+    num_points_ = source->NumPoints();
+
+    const bool remove_nan = params.remove_nan_points;
+    const bool remove_infinite = params.remove_infinite_points;
+    prefetcher_.reset(new utility::Prefetcher<geometry::PointCloud>(
+            [source, chunk_size, remove_nan,
+             remove_infinite](geometry::PointCloud &chunk) {
+                while (source->Read(chunk_size, chunk)) {
+                    if (remove_nan || remove_infinite) {
+                        chunk.RemoveNonFinitePoints(remove_nan,
+                                                    remove_infinite);
+                    }
+                    // Chunks without finite points are skipped.
+                    if (chunk.HasPoints()) {
+                        return true;
+                    }
+                }
+                return false;
+            },
+            read_ahead));
+    return true;
+}
+
+bool PointCloudChunkReader::ReadNext(geometry::PointCloud &chunk) {
+    if (!prefetcher_) {
+        return false;
+    }
+    try {
+        return prefetcher_->Next(chunk);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read point cloud chunk failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+void PointCloudChunkReader::Close() {
+    prefetcher_.reset();
+    num_points_ = -1;
+}
+
+}  // namespace io
+}  // namespace open3d
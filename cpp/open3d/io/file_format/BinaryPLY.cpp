@@ -0,0 +1,284 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/BinaryPLY.h"
+
+#include <sstream>
+
+namespace open3d {
+namespace io {
+
+static PLYScalarType GetScalarType(const std::string &name) {
+    if (name == "char" || name == "int8") {
+        return PLYScalarType::Int8;
+    } else if (name == "uchar" || name == "uint8") {
+        return PLYScalarType::UInt8;
+    } else if (name == "short" || name == "int16") {
+        return PLYScalarType::Int16;
+    } else if (name == "ushort" || name == "uint16") {
+        return PLYScalarType::UInt16;
+    } else if (name == "int" || name == "int32") {
+        return PLYScalarType::Int32;
+    } else if (name == "uint" || name == "uint32") {
+        return PLYScalarType::UInt32;
+    } else if (name == "float" || name == "float32") {
+        return PLYScalarType::Float32;
+    } else if (name == "double" || name == "float64") {
+        return PLYScalarType::Float64;
+    } else {
+        return PLYScalarType::Undefined;
+    }
+}
+
+static bool IsHostLittleEndian() {
+    const uint16_t value = 1;
+    uint8_t byte;
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+
+int64_t BinaryPLYReader::ScalarByteSize(PLYScalarType type) {
+    switch (type) {
+        case PLYScalarType::Int8:
+        case PLYScalarType::UInt8:
+            return 1;
+        case PLYScalarType::Int16:
+        case PLYScalarType::UInt16:
+            return 2;
+        case PLYScalarType::Int32:
+        case PLYScalarType::UInt32:
+        case PLYScalarType::Float32:
+            return 4;
+        case PLYScalarType::Float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+const BinaryPLYReader::Property *BinaryPLYReader::Element::GetProperty(
+        const std::string &name) const {
+    for (const Property &property : properties_) {
+        if (property.name_ == name) {
+            return &property;
+        }
+    }
+    return nullptr;
+}
+
+const BinaryPLYReader::Element *BinaryPLYReader::GetElement(
+        const std::string &name) const {
+    for (const Element &element : elements_) {
+        if (element.name_ == name) {
+            return &element;
+        }
+    }
+    return nullptr;
+}
+
+int64_t BinaryPLYReader::GetRecordSize(const Element &element,
+                                       const uint8_t *ptr,
+                                       const uint8_t *end) const {
+    // Sizes are compared with the remaining bytes before they are added, so
+    // that lengths read from the file cannot overflow.
+    const int64_t remaining = end - ptr;
+    int64_t size = 0;
+    for (const Property &p : element.properties_) {
+        if (p.IsList()) {
+            const int64_t length_size = ScalarByteSize(p.length_type_);
+            if (length_size > remaining - size) {
+                return -1;
+            }
+            int64_t length = ReadScalar<int64_t>(ptr + size, p.length_type_);
+            size += length_size;
+            if (length < 0 ||
+                length > (remaining - size) / ScalarByteSize(p.type_)) {
+                return -1;
+            }
+            size += length * ScalarByteSize(p.type_);
+        } else {
+            size += ScalarByteSize(p.type_);
+            if (size > remaining) {
+                return -1;
+            }
+        }
+    }
+    return size;
+}
+
+bool BinaryPLYReader::Open(const std::string &filename) {
+    elements_.clear();
+    if (!file_.Open(filename) || file_.GetSize() == 0) {
+        return false;
+    }
+    const char *data = reinterpret_cast<const char *>(file_.GetData());
+    const int64_t file_size = file_.GetSize();
+
+    // Parse the header line by line.
+    int64_t pos = 0;
+    bool is_first_line = true;
+    bool has_format = false;
+    while (true) {
+        int64_t line_end = pos;
+        while (line_end < file_size && data[line_end] != '\n') {
+            line_end++;
+        }
+        if (line_end >= file_size) {
+            return false;
+        }
+        std::string line(data + pos, data + line_end);
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        pos = line_end + 1;
+
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (is_first_line) {
+            if (keyword != "ply") {
+                return false;
+            }
+            is_first_line = false;
+        } else if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            if (format == "binary_little_endian") {
+                swap_bytes_ = !IsHostLittleEndian();
+            } else if (format == "binary_big_endian") {
+                swap_bytes_ = IsHostLittleEndian();
+            } else {
+                return false;
+            }
+            has_format = true;
+        } else if (keyword == "element") {
+            Element element;
+            tokens >> element.name_ >> element.count_;
+            if (tokens.fail() || element.count_ < 0) {
+                return false;
+            }
+            elements_.push_back(element);
+        } else if (keyword == "property") {
+            if (elements_.empty()) {
+                return false;
+            }
+            Property property;
+            std::string type;
+            tokens >> type;
+            if (type == "list") {
+                std::string length_type;
+                tokens >> length_type >> type;
+                property.length_type_ = GetScalarType(length_type);
+                if (property.length_type_ == PLYScalarType::Undefined) {
+                    return false;
+                }
+            }
+            property.type_ = GetScalarType(type);
+            tokens >> property.name_;
+            if (tokens.fail() || property.type_ == PLYScalarType::Undefined) {
+                return false;
+            }
+            elements_.back().properties_.push_back(property);
+        } else if (keyword == "end_header") {
+            break;
+        } else if (keyword != "comment" && keyword != "obj_info" &&
+                   !keyword.empty()) {
+            return false;
+        }
+    }
+    if (!has_format) {
+        return false;
+    }
+
+    // Locate the records of every element. Fixed size elements are skipped in
+    // one step, list elements are scanned record by record.
+    const uint8_t *begin = file_.GetData();
+    const uint8_t *end = begin + file_size;
+    for (Element &element : elements_) {
+        element.data_offset_ = pos;
+        bool has_list = false;
+        int64_t offset = 0;
+        for (Property &property : element.properties_) {
+            property.offset_ = offset;
+            offset += ScalarByteSize(property.type_);
+            has_list = has_list || property.IsList();
+        }
+        if (has_list) {
+            element.stride_ = 0;
+            const uint8_t *ptr = begin + pos;
+            for (int64_t i = 0; i < element.count_; i++) {
+                int64_t record_size = GetRecordSize(element, ptr, end);
+                if (record_size < 0) {
+                    return false;
+                }
+                ptr += record_size;
+            }
+            element.data_size_ = ptr - (begin + pos);
+        } else {
+            element.stride_ = offset;
+            // The count is read from the header, check it before multiplying.
+            if (element.stride_ > 0 &&
+                element.count_ > (file_size - pos) / element.stride_) {
+                return false;
+            }
+            element.data_size_ = element.count_ * element.stride_;
+        }
+        pos += element.data_size_;
+    }
+    return true;
+}
+
+void BinaryPLYReader::ReadPropertyRaw(const Element &element,
+                                      const Property &property,
+                                      void *dst,
+                                      int64_t dst_stride,
+                                      int64_t begin,
+                                      int64_t count) const {
+    const int64_t src_stride = element.stride_;
+    const uint8_t *src = file_.GetData() + element.data_offset_ +
+                         begin * src_stride + property.offset_;
+    uint8_t *dst_bytes = static_cast<uint8_t *>(dst);
+    const int64_t size = ScalarByteSize(property.type_);
+    if (count < 0) {
+        count = element.count_ - begin;
+    }
+    const bool swap_bytes = swap_bytes_;
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; i++) {
+        const uint8_t *s = src + i * src_stride;
+        uint8_t *d = dst_bytes + i * dst_stride;
+        if (swap_bytes) {
+            for (int64_t k = 0; k < size; k++) {
+                d[k] = s[size - 1 - k];
+            }
+        } else {
+            std::memcpy(d, s, size);
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
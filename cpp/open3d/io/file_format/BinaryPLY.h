@@ -0,0 +1,301 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// Scalar types of PLY properties.
+enum class PLYScalarType {
+    Undefined,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64
+};
+
+/// \class BinaryPLYReader
+///
+/// \brief Reads binary PLY files from a memory map.
+///
+/// Properties of elements with fixed size records are deinterleaved in bulk,
+/// in parallel chunks of records, instead of through one rply callback per
+/// value. Elements with list properties are read with one sequential scan.
+/// ASCII files are not handled and should be read with rply.
+class BinaryPLYReader {
+public:
+    struct Property {
+        std::string name_;
+        PLYScalarType type_ = PLYScalarType::Undefined;
+        /// Type of the length of a list property, Undefined for scalars.
+        PLYScalarType length_type_ = PLYScalarType::Undefined;
+        /// Offset in bytes within a fixed size record.
+        int64_t offset_ = 0;
+
+        bool IsList() const { return length_type_ != PLYScalarType::Undefined; }
+    };
+
+    struct Element {
+        std::string name_;
+        int64_t count_ = 0;
+        std::vector<Property> properties_;
+        /// Record size in bytes, 0 if the element has list properties.
+        int64_t stride_ = 0;
+        /// Offset of the first record from the start of the file.
+        int64_t data_offset_ = 0;
+        /// Size of all records in bytes.
+        int64_t data_size_ = 0;
+
+        const Property *GetProperty(const std::string &name) const;
+    };
+
+public:
+    BinaryPLYReader() {}
+
+    /// Maps \p filename and parses its header. Returns false if the file
+    /// cannot be opened, is ASCII, or its header or size is invalid. Callers
+    /// fall back to rply in that case, which reports the actual error.
+    bool Open(const std::string &filename);
+
+    /// Returns the element called \p name, nullptr if there is none.
+    const Element *GetElement(const std::string &name) const;
+
+    /// \brief Copies a scalar property of \p count records of \p element
+    /// starting at record \p begin to \p dst without conversion. \p dst holds
+    /// \p dst_stride bytes per record. A negative \p count copies all records
+    /// from \p begin. Only valid for elements without list properties.
+    void ReadPropertyRaw(const Element &element,
+                         const Property &property,
+                         void *dst,
+                         int64_t dst_stride,
+                         int64_t begin = 0,
+                         int64_t count = -1) const;
+
+    /// \brief Reads a scalar property of \p count records of \p element
+    /// starting at record \p begin into \p dst, converting to T. \p dst holds
+    /// \p dst_stride values per record, so a property can be written into one
+    /// column of an interleaved array. A negative \p count reads all records
+    /// from \p begin. Only valid for elements without list properties.
+    template <typename T>
+    void ReadProperty(const Element &element,
+                      const Property &property,
+                      T *dst,
+                      int64_t dst_stride,
+                      int64_t begin = 0,
+                      int64_t count = -1) const;
+
+    /// \brief Reads a list property of \p element. The values of record i are
+    /// values[offsets[i]] to values[offsets[i + 1] - 1].
+    template <typename T>
+    bool ReadListProperty(const Element &element,
+                          const Property &property,
+                          std::vector<int64_t> &offsets,
+                          std::vector<T> &values) const;
+
+    /// Byte size of a scalar type.
+    static int64_t ScalarByteSize(PLYScalarType type);
+
+private:
+    /// Reads a scalar of \p type at \p ptr as T, swapping bytes if needed.
+    template <typename T>
+    T ReadScalar(const uint8_t *ptr, PLYScalarType type) const;
+
+    template <typename S, typename T>
+    void ConvertStrided(const Element &element,
+                        const Property &property,
+                        T *dst,
+                        int64_t dst_stride,
+                        int64_t begin,
+                        int64_t count) const;
+
+    /// Size of one record of a list element starting at \p ptr, -1 if it
+    /// exceeds \p end.
+    int64_t GetRecordSize(const Element &element,
+                          const uint8_t *ptr,
+                          const uint8_t *end) const;
+
+private:
+    utility::filesystem::MappedFile file_;
+    std::vector<Element> elements_;
+    /// True if the byte order of the file differs from the host.
+    bool swap_bytes_ = false;
+};
+
+template <typename T>
+T BinaryPLYReader::ReadScalar(const uint8_t *ptr, PLYScalarType type) const {
+    uint8_t bytes[8];
+    const int64_t size = ScalarByteSize(type);
+    if (swap_bytes_) {
+        for (int64_t i = 0; i < size; i++) {
+            bytes[i] = ptr[size - 1 - i];
+        }
+    } else {
+        std::memcpy(bytes, ptr, size);
+    }
+#define OPEN3D_PLY_READ_SCALAR(TYPE, CTYPE) \
+    case PLYScalarType::TYPE: {             \
+        CTYPE value;                        \
+        std::memcpy(&value, bytes, size);   \
+        return static_cast<T>(value);       \
+    }
+    switch (type) {
+        OPEN3D_PLY_READ_SCALAR(Int8, int8_t)
+        OPEN3D_PLY_READ_SCALAR(UInt8, uint8_t)
+        OPEN3D_PLY_READ_SCALAR(Int16, int16_t)
+        OPEN3D_PLY_READ_SCALAR(UInt16, uint16_t)
+        OPEN3D_PLY_READ_SCALAR(Int32, int32_t)
+        OPEN3D_PLY_READ_SCALAR(UInt32, uint32_t)
+        OPEN3D_PLY_READ_SCALAR(Float32, float)
+        OPEN3D_PLY_READ_SCALAR(Float64, double)
+        default:
+            return T(0);
+    }
+#undef OPEN3D_PLY_READ_SCALAR
+}
+
+template <typename S, typename T>
+void BinaryPLYReader::ConvertStrided(const Element &element,
+                                     const Property &property,
+                                     T *dst,
+                                     int64_t dst_stride,
+                                     int64_t begin,
+                                     int64_t count) const {
+    const int64_t src_stride = element.stride_;
+    const uint8_t *src = file_.GetData() + element.data_offset_ +
+                         begin * src_stride + property.offset_;
+    if (swap_bytes_) {
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < count; i++) {
+            dst[i * dst_stride] =
+                    ReadScalar<T>(src + i * src_stride, property.type_);
+        }
+    } else {
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < count; i++) {
+            S value;
+            std::memcpy(&value, src + i * src_stride, sizeof(S));
+            dst[i * dst_stride] = static_cast<T>(value);
+        }
+    }
+}
+
+template <typename T>
+void BinaryPLYReader::ReadProperty(const Element &element,
+                                   const Property &property,
+                                   T *dst,
+                                   int64_t dst_stride,
+                                   int64_t begin,
+                                   int64_t count) const {
+    if (count < 0) {
+        count = element.count_ - begin;
+    }
+    switch (property.type_) {
+        case PLYScalarType::Int8:
+            ConvertStrided<int8_t>(element, property, dst, dst_stride,
+                                   begin, count);
+            break;
+        case PLYScalarType::UInt8:
+            ConvertStrided<uint8_t>(element, property, dst, dst_stride,
+                                    begin, count);
+            break;
+        case PLYScalarType::Int16:
+            ConvertStrided<int16_t>(element, property, dst, dst_stride,
+                                    begin, count);
+            break;
+        case PLYScalarType::UInt16:
+            ConvertStrided<uint16_t>(element, property, dst, dst_stride,
+                                     begin, count);
+            break;
+        case PLYScalarType::Int32:
+            ConvertStrided<int32_t>(element, property, dst, dst_stride,
+                                    begin, count);
+            break;
+        case PLYScalarType::UInt32:
+            ConvertStrided<uint32_t>(element, property, dst, dst_stride,
+                                     begin, count);
+            break;
+        case PLYScalarType::Float32:
+            ConvertStrided<float>(element, property, dst, dst_stride,
+                                  begin, count);
+            break;
+        case PLYScalarType::Float64:
+            ConvertStrided<double>(element, property, dst, dst_stride,
+                                   begin, count);
+            break;
+        default:
+            break;
+    }
+}
+
+template <typename T>
+bool BinaryPLYReader::ReadListProperty(const Element &element,
+                                       const Property &property,
+                                       std::vector<int64_t> &offsets,
+                                       std::vector<T> &values) const {
+    offsets.assign(1, 0);
+    offsets.reserve(element.count_ + 1);
+    values.clear();
+    const uint8_t *ptr = file_.GetData() + element.data_offset_;
+    const uint8_t *end = ptr + element.data_size_;
+    for (int64_t i = 0; i < element.count_; i++) {
+        for (const Property &p : element.properties_) {
+            if (!p.IsList()) {
+                ptr += ScalarByteSize(p.type_);
+                continue;
+            }
+            int64_t length = ReadScalar<int64_t>(ptr, p.length_type_);
+            ptr += ScalarByteSize(p.length_type_);
+            const int64_t value_size = ScalarByteSize(p.type_);
+            if (length < 0 || ptr + length * value_size > end) {
+                return false;
+            }
+            if (&p == &property) {
+                for (int64_t k = 0; k < length; k++) {
+                    values.push_back(
+                            ReadScalar<T>(ptr + k * value_size, p.type_));
+                }
+            }
+            ptr += length * value_size;
+        }
+        offsets.push_back(static_cast<int64_t>(values.size()));
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,309 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Parses the token at \p begin with strtod, for the cases the fast path does
+/// not handle.
+const char *ParseDoubleSlow(const char *begin, const char *end, double &value) {
+    const char *token_end = begin;
+    while (token_end < end && !IsBlank(*token_end) && *token_end != '\n') {
+        token_end++;
+    }
+    std::string token(begin, token_end);
+    char *parse_end = nullptr;
+    value = std::strtod(token.c_str(), &parse_end);
+    if (parse_end == token.c_str()) {
+        return nullptr;
+    }
+    return begin + (parse_end - token.c_str());
+}
+
+/// Parses the lines of [begin, end), which starts at a line and ends after a
+/// newline or at the end of the data.
+void ParseChunk(const char *begin,
+                const char *end,
+                int num_fields,
+                bool keep_invalid_lines,
+                std::vector<double> &values) {
+    std::vector<double> record(num_fields);
+    const char *line = begin;
+    while (line < end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line, '\n', end - line));
+        if (!line_end) {
+            line_end = end;
+        }
+        const char *ptr = line;
+        int field = 0;
+        for (; field < num_fields; field++) {
+            ptr = ParseASCIIDouble(ptr, line_end, record[field]);
+            if (!ptr) {
+                break;
+            }
+        }
+        if (field == num_fields) {
+            values.insert(values.end(), record.begin(), record.end());
+        } else if (keep_invalid_lines) {
+            values.resize(values.size() + num_fields, 0.0);
+        }
+        line = line_end + 1;
+    }
+}
+
+}  // unnamed namespace
+
+const char *ParseASCIIDouble(const char *begin,
+                             const char *end,
+                             double &value) {
+    static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *ptr = begin;
+    while (ptr < end && IsBlank(*ptr)) {
+        ptr++;
+    }
+    const char *start = ptr;
+    if (ptr == end || *ptr == '\n') {
+        return nullptr;
+    }
+
+    bool negative = false;
+    if (*ptr == '-' || *ptr == '+') {
+        negative = *ptr == '-';
+        ptr++;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool truncated = false;
+    while (ptr < end && IsDigit(*ptr)) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*ptr - '0');
+            num_digits += mantissa != 0;
+        } else {
+            exponent++;
+            truncated = true;
+        }
+        ptr++;
+    }
+    if (ptr < end && *ptr == '.') {
+        ptr++;
+        while (ptr < end && IsDigit(*ptr)) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                num_digits += mantissa != 0;
+                exponent--;
+            } else {
+                truncated = true;
+            }
+            ptr++;
+        }
+    }
+    if (!has_digits) {
+        return ParseDoubleSlow(start, end, value);
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        const char *exp_ptr = ptr + 1;
+        bool exp_negative = false;
+        if (exp_ptr < end && (*exp_ptr == '-' || *exp_ptr == '+')) {
+            exp_negative = *exp_ptr == '-';
+            exp_ptr++;
+        }
+        if (exp_ptr < end && IsDigit(*exp_ptr)) {
+            int exp_value = 0;
+            while (exp_ptr < end && IsDigit(*exp_ptr)) {
+                exp_value = std::min(exp_value * 10 + (*exp_ptr - '0'), 10000);
+                exp_ptr++;
+            }
+            exponent += exp_negative ? -exp_value : exp_value;
+            ptr = exp_ptr;
+        }
+    }
+
+    // Both the mantissa and the power of ten are exact doubles, so a single
+    // multiplication or division is correctly rounded.
+    if (truncated || mantissa > (uint64_t(1) << 53) || exponent < -22 ||
+        exponent > 22) {
+        return ParseDoubleSlow(start, end, value);
+    }
+    double result = double(mantissa);
+    result = exponent < 0 ? result / kPow10[-exponent]
+                          : result * kPow10[exponent];
+    value = negative ? -result : result;
+    return ptr;
+}
+
+int64_t SkipASCIILines(const char *data, int64_t size, int64_t num_lines) {
+    int64_t offset = 0;
+    for (int64_t i = 0; i < num_lines && offset < size; i++) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + offset, '\n', size - offset));
+        offset = line_end ? line_end - data + 1 : size;
+    }
+    return offset;
+}
+
+int CountASCIITokens(const char *data, int64_t size) {
+    int num_tokens = 0;
+    bool in_token = false;
+    for (int64_t i = 0; i < size && data[i] != '\n'; i++) {
+        bool blank = IsBlank(data[i]);
+        if (!blank && !in_token) {
+            num_tokens++;
+        }
+        in_token = !blank;
+    }
+    return num_tokens;
+}
+
+std::vector<double> ParseASCIIRecords(
+        const char *data,
+        int64_t size,
+        int num_fields,
+        bool keep_invalid_lines,
+        int64_t max_records,
+        const std::function<bool(const double *)> &filter,
+        const std::function<void(int64_t)> &update_progress) {
+    if (size <= 0 || num_fields <= 0) {
+        return {};
+    }
+
+    // Newline aligned chunks, several per thread to balance uneven lines.
+    const int64_t min_chunk_size = 1 << 20;
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(4 * utility::GetMaxThreads(),
+                                 size / min_chunk_size));
+    std::vector<int64_t> chunk_begins(num_chunks + 1, size);
+    chunk_begins[0] = 0;
+    for (int64_t c = 1; c < num_chunks; c++) {
+        int64_t begin = std::max(chunk_begins[c - 1], size * c / num_chunks);
+        if (begin > 0 && begin < size && data[begin - 1] != '\n') {
+            begin += SkipASCIILines(data + begin, size - begin, 1);
+        }
+        chunk_begins[c] = begin;
+    }
+
+    std::vector<std::vector<double>> chunk_values(num_chunks);
+    std::atomic<int64_t> parsed_bytes(0);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < num_chunks; c++) {
+        ParseChunk(data + chunk_begins[c], data + chunk_begins[c + 1],
+                   num_fields, keep_invalid_lines, chunk_values[c]);
+        parsed_bytes += chunk_begins[c + 1] - chunk_begins[c];
+        if (update_progress && utility::GetThreadNum() == 0) {
+            update_progress(parsed_bytes);
+        }
+    }
+
+    // Apply the record limit in file order, then filter each chunk.
+    int64_t num_records = 0;
+    for (int64_t c = 0; c < num_chunks; c++) {
+        int64_t chunk_records = chunk_values[c].size() / num_fields;
+        if (max_records >= 0) {
+            chunk_records =
+                    std::min(chunk_records,
+                             std::max<int64_t>(0, max_records - num_records));
+            chunk_values[c].resize(chunk_records * num_fields);
+        }
+        num_records += chunk_records;
+    }
+    if (filter) {
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t c = 0; c < num_chunks; c++) {
+            std::vector<double> &values = chunk_values[c];
+            int64_t kept = 0;
+            for (size_t i = 0; i < values.size(); i += num_fields) {
+                if (filter(&values[i])) {
+                    std::copy(values.begin() + i,
+                              values.begin() + i + num_fields,
+                              values.begin() + kept);
+                    kept += num_fields;
+                }
+            }
+            values.resize(kept);
+        }
+    }
+
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    for (int64_t c = 0; c < num_chunks; c++) {
+        chunk_offsets[c + 1] = chunk_offsets[c] + chunk_values[c].size();
+    }
+    std::vector<double> values(chunk_offsets[num_chunks]);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < num_chunks; c++) {
+        std::copy(chunk_values[c].begin(), chunk_values[c].end(),
+                  values.begin() + chunk_offsets[c]);
+        std::vector<double>().swap(chunk_values[c]);
+    }
+    if (update_progress) {
+        update_progress(size);
+    }
+    return values;
+}
+
+std::function<bool(const double *)> CreateFiniteRecordFilter(
+        int num_checked, bool remove_nan, bool remove_infinite) {
+    if (!remove_nan && !remove_infinite) {
+        return nullptr;
+    }
+    return [=](const double *record) {
+        for (int i = 0; i < num_checked; i++) {
+            if ((remove_nan && std::isnan(record[i])) ||
+                (remove_infinite && std::isinf(record[i]))) {
+                return false;
+            }
+        }
+        return true;
+    };
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+/// \brief Parses a decimal floating point number starting at \p begin.
+///
+/// Blanks before the number are skipped. The parser does not depend on the
+/// locale and is exact for numbers with up to 15 significant digits and
+/// exponents up to 22, which covers the output of the Open3D writers. Other
+/// numbers, "nan" and "inf" fall back to strtod.
+///
+/// \return The position after the number, nullptr if there is none before
+/// \p end.
+const char *ParseASCIIDouble(const char *begin, const char *end, double &value);
+
+/// Returns the offset of the start of the line following the first
+/// \p num_lines lines of [data, data + size), or \p size if there are fewer.
+int64_t SkipASCIILines(const char *data, int64_t size, int64_t num_lines);
+
+/// Returns the number of blank separated tokens of the line at \p data.
+int CountASCIITokens(const char *data, int64_t size);
+
+/// \brief Parses a text file with one record of \p num_fields blank separated
+/// numbers per line.
+///
+/// The data is split into newline aligned chunks that are parsed in parallel,
+/// records are concatenated in file order. Extra numbers on a line are
+/// ignored.
+///
+/// \param data Text to parse, usually a memory mapped file.
+/// \param size Size of \p data in bytes.
+/// \param num_fields Number of values of a record.
+/// \param keep_invalid_lines If true, lines with fewer than \p num_fields
+/// numbers produce a record of zeros, for formats with one point per line.
+/// Otherwise they are skipped.
+/// \param max_records Maximum number of records, -1 for no limit.
+/// \param filter If set, records for which it returns false are dropped after
+/// \p max_records is applied.
+/// \param update_progress Called from the calling thread with the number of
+/// bytes parsed so far.
+/// \return The values of all records, record by record.
+std::vector<double> ParseASCIIRecords(
+        const char *data,
+        int64_t size,
+        int num_fields,
+        bool keep_invalid_lines = false,
+        int64_t max_records = -1,
+        const std::function<bool(const double *)> &filter = nullptr,
+        const std::function<void(int64_t)> &update_progress = nullptr);
+
+/// \brief Returns a filter for ParseASCIIRecords that drops records whose
+/// first \p num_checked values contain NaN or infinite values, depending on
+/// \p remove_nan and \p remove_infinite. Returns nullptr if neither is set.
+std::function<bool(const double *)> CreateFiniteRecordFilter(
+        int num_checked, bool remove_nan, bool remove_infinite);
+
+}  // namespace io
+}  // namespace open3d
@@ -30,6 +30,9 @@
 #include <jpeglib.h>  // Include after cstddef to define size_t
 // clang-format on
 
+#include <algorithm>
+#include <vector>
+
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
@@ -37,11 +40,11 @@
 namespace open3d {
 namespace io {
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+bool ReadImageBufferFromJPG(const std::string &filename,
+                            const ImageBufferAllocator &allocate) {
     struct jpeg_decompress_struct cinfo;
     struct jpeg_error_mgr jerr;
     FILE *file_in;
-    JSAMPARRAY buffer;
 
     if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
         utility::LogWarning("Read JPG failed: unable to open file: {}",
@@ -78,16 +81,26 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
             return false;
     }
     jpeg_start_decompress(&cinfo);
-    image.Prepare(cinfo.output_width, cinfo.output_height, num_of_channels,
-                  bytes_per_channel);
-    int row_stride = cinfo.output_width * cinfo.output_components;
-    buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
-                                        row_stride, 1);
-    uint8_t *pdata = image.data_.data();
+    uint8_t *pdata = allocate(cinfo.output_width, cinfo.output_height,
+                              num_of_channels, bytes_per_channel);
+    if (pdata == nullptr) {
+        jpeg_destroy_decompress(&cinfo);
+        fclose(file_in);
+        return false;
+    }
+    // Scanlines are decoded directly into the destination, as many at a time
+    // as the decoder produces per call.
+    const size_t row_stride = size_t(cinfo.output_width) * num_of_channels;
+    std::vector<JSAMPROW> rows(cinfo.rec_outbuf_height);
     while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);
-        memcpy(pdata, buffer[0], row_stride);
-        pdata += row_stride;
+        const JDIMENSION num_rows =
+                std::min<JDIMENSION>(cinfo.rec_outbuf_height,
+                                     cinfo.output_height -
+                                             cinfo.output_scanline);
+        for (JDIMENSION i = 0; i < num_rows; i++) {
+            rows[i] = pdata + (cinfo.output_scanline + i) * row_stride;
+        }
+        jpeg_read_scanlines(&cinfo, rows.data(), num_rows);
     }
     jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
@@ -95,6 +108,16 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+    return ReadImageBufferFromJPG(
+            filename, [&image](int width, int height, int num_of_channels,
+                               int bytes_per_channel) {
+                image.Prepare(width, height, num_of_channels,
+                              bytes_per_channel);
+                return image.data_.data();
+            });
+}
+
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality /* = kOpen3DImageIODefaultQuality*/) {
@@ -139,13 +162,11 @@ bool WriteImageToJPG(const std::string &filename,
     jpeg_set_quality(&cinfo, quality, TRUE);
     jpeg_start_compress(&cinfo, TRUE);
     int row_stride = image.width_ * image.num_of_channels_;
-    const uint8_t *pdata = image.data_.data();
-    std::vector<uint8_t> buffer(row_stride);
+    // libjpeg does not modify the rows passed to jpeg_write_scanlines.
+    uint8_t *pdata = const_cast<uint8_t *>(image.data_.data());
     while (cinfo.next_scanline < cinfo.image_height) {
-        memcpy(buffer.data(), pdata, row_stride);
-        row_pointer[0] = buffer.data();
+        row_pointer[0] = pdata + size_t(cinfo.next_scanline) * row_stride;
         jpeg_write_scanlines(&cinfo, row_pointer, 1);
-        pdata += row_stride;
     }
     jpeg_finish_compress(&cinfo);
     fclose(file_out);
@@ -28,10 +28,11 @@
 
 #include <cstdint>
 #include <cstdio>
-#include <sstream>
+#include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/PCDData.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -47,256 +48,6 @@ namespace open3d {
 namespace {
 using namespace io;
 
-enum PCDDataType {
-    PCD_DATA_ASCII = 0,
-    PCD_DATA_BINARY = 1,
-    PCD_DATA_BINARY_COMPRESSED = 2
-};
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset;
-    int offset;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-    // helper variables
-    int elementnum;
-    int pointsize;
-    bool has_points;
-    bool has_normals;
-    bool has_colors;
-};
-
-bool CheckHeader(PCDHeader &header) {
-    if (header.points <= 0 || header.pointsize <= 0) {
-        utility::LogWarning("[CheckHeader] PCD has no data.");
-        return false;
-    }
-    if (header.fields.size() == 0 || header.pointsize <= 0) {
-        utility::LogWarning("[CheckHeader] PCD has no fields.");
-        return false;
-    }
-    header.has_points = false;
-    header.has_normals = false;
-    header.has_colors = false;
-    bool has_x = false;
-    bool has_y = false;
-    bool has_z = false;
-    bool has_normal_x = false;
-    bool has_normal_y = false;
-    bool has_normal_z = false;
-    bool has_rgb = false;
-    bool has_rgba = false;
-    for (const auto &field : header.fields) {
-        if (field.name == "x") {
-            has_x = true;
-        } else if (field.name == "y") {
-            has_y = true;
-        } else if (field.name == "z") {
-            has_z = true;
-        } else if (field.name == "normal_x") {
-            has_normal_x = true;
-        } else if (field.name == "normal_y") {
-            has_normal_y = true;
-        } else if (field.name == "normal_z") {
-            has_normal_z = true;
-        } else if (field.name == "rgb") {
-            has_rgb = true;
-        } else if (field.name == "rgba") {
-            has_rgba = true;
-        }
-    }
-    header.has_points = (has_x && has_y && has_z);
-    header.has_normals = (has_normal_x && has_normal_y && has_normal_z);
-    header.has_colors = (has_rgb || has_rgba);
-    if (!header.has_points) {
-        utility::LogWarning(
-                "[CheckHeader] Fields for point data are not complete.");
-        return false;
-    }
-    return true;
-}
-
-bool ReadPCDHeader(FILE *file, PCDHeader &header) {
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    size_t specified_channel_count = 0;
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::string line(line_buffer);
-        if (line == "") {
-            continue;
-        }
-        std::vector<std::string> st;
-        utility::SplitString(st, line, "\t\r\n ");
-        std::stringstream sstream(line);
-        sstream.imbue(std::locale::classic());
-        std::string line_type;
-        sstream >> line_type;
-        if (line_type.substr(0, 1) == "#") {
-        } else if (line_type.substr(0, 7) == "VERSION") {
-            if (st.size() >= 2) {
-                header.version = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "FIELDS" ||
-                   line_type.substr(0, 7) == "COLUMNS") {
-            specified_channel_count = st.size() - 1;
-            if (specified_channel_count == 0) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            header.fields.resize(specified_channel_count);
-            int count_offset = 0, offset = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, count_offset += 1, offset += 4) {
-                header.fields[i].name = st[i + 1];
-                header.fields[i].size = 4;
-                header.fields[i].type = 'F';
-                header.fields[i].count = 1;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "SIZE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int offset = 0, col_type = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, offset += col_type) {
-                sstream >> col_type;
-                header.fields[i].size = col_type;
-                header.fields[i].offset = offset;
-            }
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "TYPE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                header.fields[i].type = st[i + 1].c_str()[0];
-            }
-        } else if (line_type.substr(0, 5) == "COUNT") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int count_offset = 0, offset = 0, col_count = 0;
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                sstream >> col_count;
-                header.fields[i].count = col_count;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-                count_offset += col_count;
-                offset += col_count * header.fields[i].size;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 5) == "WIDTH") {
-            sstream >> header.width;
-        } else if (line_type.substr(0, 6) == "HEIGHT") {
-            sstream >> header.height;
-            header.points = header.width * header.height;
-        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
-            if (st.size() >= 2) {
-                header.viewpoint = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "POINTS") {
-            sstream >> header.points;
-        } else if (line_type.substr(0, 4) == "DATA") {
-            header.datatype = PCD_DATA_ASCII;
-            if (st.size() >= 2) {
-                if (st[1].substr(0, 17) == "binary_compressed") {
-                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
-                } else if (st[1].substr(0, 6) == "binary") {
-                    header.datatype = PCD_DATA_BINARY;
-                }
-            }
-            break;
-        }
-    }
-    if (!CheckHeader(header)) {
-        return false;
-    }
-    return true;
-}
-
-double UnpackBinaryPCDElement(const char *data_ptr,
-                              const char type,
-                              const int size) {
-    if (type == 'I') {
-        if (size == 1) {
-            std::int8_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 2) {
-            std::int16_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 4) {
-            std::int32_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else {
-            return 0.0;
-        }
-    } else if (type == 'U') {
-        if (size == 1) {
-            std::uint8_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 2) {
-            std::uint16_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 4) {
-            std::uint32_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else {
-            return 0.0;
-        }
-    } else if (type == 'F') {
-        if (size == 4) {
-            float data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else {
-            return 0.0;
-        }
-    }
-    return 0.0;
-}
-
-Eigen::Vector3d UnpackBinaryPCDColor(const char *data_ptr,
-                                     const char type,
-                                     const int size) {
-    if (size == 4) {
-        std::uint8_t data[4];
-        memcpy(data, data_ptr, 4);
-        // color data is packed in BGR order.
-        return utility::ColorToDouble(data[2], data[1], data[0]);
-    } else {
-        return Eigen::Vector3d::Zero();
-    }
-}
-
 double UnpackASCIIPCDElement(const char *data_ptr,
                              const char type,
                              const int size) {
@@ -402,136 +153,29 @@ bool ReadPCDData(FILE *file,
                 reporter.Update(idx);
             }
         }
-    } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "x") {
-                    pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
-    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double reporter_total = 100.0;
-        reporter.SetTotal(int(reporter_total));
-        reporter.Update(int(reporter_total * 0.01));
-        std::uint32_t compressed_size;
-        std::uint32_t uncompressed_size;
-        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
-            1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        utility::LogDebug(
-                "PCD data with {:d} compressed size, and {:d} uncompressed "
-                "size.",
-                compressed_size, uncompressed_size);
-        std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        reporter.Update(int(reporter_total * .1));
-        if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
-            compressed_size) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
-            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+    } else {
+        // Binary data is read in one block and decoded field by field.
+        PCDBinaryData data;
+        if (!data.Read(file, header)) {
             pointcloud.Clear();
             return false;
         }
+        reporter.Update(header.points / 2);
         for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.points_[0].data() + 0, 3);
             } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.points_[0].data() + 1, 3);
             } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.points_[0].data() + 2, 3);
             } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.normals_[0].data() + 0, 3);
             } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.normals_[0].data() + 1, 3);
             } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeField(field, pointcloud.normals_[0].data() + 2, 3);
             } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+                data.DecodeColorField(field, pointcloud.colors_[0].data(), 3);
             }
         }
     }
@@ -669,77 +313,63 @@ bool WritePCDData(FILE *file,
                 reporter.Update(i);
             }
         }
-    } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
-            }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
-    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double report_total = double(pointcloud.points_.size() * 2);
-        // 0%-50% packing into buffer
-        // 50%-75% compressing buffer
-        // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
+    } else {
+        // Binary data is packed in parallel into one buffer, point by point
+        // for binary and field by field for binary_compressed.
+        const bool field_major = header.datatype == PCD_DATA_BINARY_COMPRESSED;
+        const int64_t num_points = int64_t(pointcloud.points_.size());
+        const int64_t elementnum = header.elementnum;
+        const int64_t point_stride = field_major ? 1 : elementnum;
+        const int64_t field_stride = field_major ? num_points : 1;
         std::uint32_t buffer_size =
                 (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        std::vector<float> buffer(buffer_size);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            float *data = buffer.data() + i * point_stride;
             const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
+            data[0 * field_stride] = (float)point(0);
+            data[1 * field_stride] = (float)point(1);
+            data[2 * field_stride] = (float)point(2);
             int idx = 3;
             if (has_normal) {
                 const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
+                data[(idx + 0) * field_stride] = (float)normal(0);
+                data[(idx + 1) * field_stride] = (float)normal(1);
+                data[(idx + 2) * field_stride] = (float)normal(2);
                 idx += 3;
             }
             if (has_color) {
                 const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+                data[idx * field_stride] = ConvertRGBToFloat(color);
             }
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
-            return false;
+        reporter.Update(pointcloud.points_.size() / 2);
+        if (!field_major) {
+            if (fwrite(buffer.data(), sizeof(float), buffer_size, file) !=
+                buffer_size) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
+            }
+        } else {
+            std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
+            std::vector<float> buffer_compressed(buffer_size * 2);
+            std::uint32_t size_compressed = lzf_compress(
+                    buffer.data(), buffer_size_in_bytes,
+                    buffer_compressed.data(), buffer_size_in_bytes * 2);
+            if (size_compressed == 0) {
+                utility::LogWarning("[WritePCDData] Failed to compress data.");
+                return false;
+            }
+            utility::LogDebug(
+                    "[WritePCDData] {:d} bytes data compressed into {:d} "
+                    "bytes.",
+                    buffer_size_in_bytes, size_compressed);
+            fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+            fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1,
+                   file);
+            fwrite(buffer_compressed.data(), 1, size_compressed, file);
         }
-        utility::LogDebug(
-                "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
     }
     reporter.Finish();
     return true;
@@ -26,11 +26,14 @@
 
 #include <rply.h>
 
+#include <array>
+
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/LineSetIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/BinaryPLY.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/ProgressReporters.h"
 
@@ -357,6 +360,124 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_binary_reader {
+
+/// Reads three scalar properties of \p element into \p dst. Returns false if
+/// any of them is missing.
+bool ReadVector3dProperties(const BinaryPLYReader &reader,
+                            const BinaryPLYReader::Element &element,
+                            const std::array<const char *, 3> &names,
+                            std::vector<Eigen::Vector3d> &dst) {
+    const BinaryPLYReader::Property *properties[3];
+    for (int i = 0; i < 3; i++) {
+        properties[i] = element.GetProperty(names[i]);
+        if (!properties[i] || properties[i]->IsList()) {
+            return false;
+        }
+    }
+    dst.resize(element.count_);
+    for (int i = 0; i < 3; i++) {
+        reader.ReadProperty(element, *properties[i], dst.data()->data() + i,
+                            3);
+    }
+    return true;
+}
+
+/// Reads vertices, normals and colors of the "vertex" element. Returns false
+/// if the element has a layout the fast path does not handle.
+bool ReadVertices(const BinaryPLYReader &reader,
+                  std::vector<Eigen::Vector3d> &points,
+                  std::vector<Eigen::Vector3d> &normals,
+                  std::vector<Eigen::Vector3d> &colors) {
+    const BinaryPLYReader::Element *vertex = reader.GetElement("vertex");
+    if (!vertex || vertex->count_ <= 0 || vertex->stride_ == 0) {
+        return false;
+    }
+    if (!ReadVector3dProperties(reader, *vertex, {"x", "y", "z"}, points)) {
+        return false;
+    }
+    if (vertex->GetProperty("nx") &&
+        !ReadVector3dProperties(reader, *vertex, {"nx", "ny", "nz"},
+                                normals)) {
+        return false;
+    }
+    if (vertex->GetProperty("red")) {
+        if (!ReadVector3dProperties(reader, *vertex, {"red", "green", "blue"},
+                                    colors)) {
+            return false;
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < int64_t(colors.size()); i++) {
+            colors[i] /= 255.0;
+        }
+    }
+    return true;
+}
+
+/// Reads the faces of a binary PLY mesh. Triangles are copied in parallel,
+/// other polygons are triangulated by ear clipping.
+bool ReadTriangleMeshFromBinaryPLY(const BinaryPLYReader &reader,
+                                   geometry::TriangleMesh &mesh,
+                                   bool print_progress) {
+    if (!ReadVertices(reader, mesh.vertices_, mesh.vertex_normals_,
+                      mesh.vertex_colors_)) {
+        return false;
+    }
+    const BinaryPLYReader::Element *face = reader.GetElement("face");
+    const BinaryPLYReader::Property *indices = nullptr;
+    if (face) {
+        indices = face->GetProperty("vertex_indices");
+        if (!indices) {
+            indices = face->GetProperty("vertex_index");
+        }
+    }
+    int64_t face_num = indices ? face->count_ : 0;
+    // The fast path has no intermediate progress, the bar completes at once.
+    utility::ConsoleProgressBar progress_bar(1, "Reading PLY: ",
+                                             print_progress);
+    if (face_num == 0) {
+        ++progress_bar;
+        return true;
+    }
+    if (!indices->IsList()) {
+        return false;
+    }
+
+    std::vector<int64_t> offsets;
+    std::vector<int> values;
+    if (!reader.ReadListProperty(*face, *indices, offsets, values)) {
+        return false;
+    }
+    bool all_triangles = true;
+    for (int64_t i = 0; i < face_num && all_triangles; i++) {
+        all_triangles = offsets[i + 1] - offsets[i] == 3;
+    }
+    if (all_triangles) {
+        mesh.triangles_.resize(face_num);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < face_num; i++) {
+            mesh.triangles_[i] = Eigen::Vector3i(
+                    values[3 * i], values[3 * i + 1], values[3 * i + 2]);
+        }
+    } else {
+        std::vector<unsigned int> polygon;
+        for (int64_t i = 0; i < face_num; i++) {
+            polygon.assign(values.begin() + offsets[i],
+                           values.begin() + offsets[i + 1]);
+            if (!AddTrianglesByEarClipping(mesh, polygon)) {
+                utility::LogWarning(
+                        "Read PLY failed: A polygon in the mesh could not be "
+                        "decomposed into triangles.");
+                return false;
+            }
+        }
+    }
+    ++progress_bar;
+    return true;
+}
+
+}  // namespace ply_binary_reader
+
 }  // unnamed namespace
 /// @endcond
 
@@ -398,6 +519,21 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    // Binary files are deinterleaved directly from a memory map.
+    BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename)) {
+        pointcloud.Clear();
+        if (ply_binary_reader::ReadVertices(binary_reader, pointcloud.points_,
+                                            pointcloud.normals_,
+                                            pointcloud.colors_)) {
+            utility::CountingProgressReporter reporter(params.update_progress);
+            reporter.SetTotal(pointcloud.points_.size());
+            reporter.Finish();
+            return true;
+        }
+        pointcloud.Clear();
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -542,6 +678,16 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                              bool print_progress) {
     using namespace ply_trianglemesh_reader;
 
+    BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename)) {
+        mesh.Clear();
+        if (ply_binary_reader::ReadTriangleMeshFromBinaryPLY(
+                    binary_reader, mesh, print_progress)) {
+            return true;
+        }
+        mesh.Clear();
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
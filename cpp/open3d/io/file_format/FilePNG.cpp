@@ -26,8 +26,12 @@
 
 #include <png.h>
 
+#include <cstring>
+#include <vector>
+
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 
@@ -55,11 +59,76 @@ void SetPNGImageFromImage(const geometry::Image &image,
     }
 }
 
+bool IsHostLittleEndian() {
+    const uint16_t value = 1;
+    uint8_t byte;
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+
+void PNGErrorCallback(png_structp png_ptr, png_const_charp message) {
+    utility::LogDebug("PNG error: {}", message);
+    png_longjmp(png_ptr, 1);
+}
+
+void PNGWarningCallback(png_structp png_ptr, png_const_charp message) {
+    utility::LogDebug("PNG warning: {}", message);
+}
+
+// libpng calls that can fail are wrapped in a function of their own, so no
+// local variables are modified between setjmp and longjmp.
+bool PNGWriteRows(png_structp png_ptr,
+                  png_infop info_ptr,
+                  FILE *file,
+                  const geometry::Image &image,
+                  int quality,
+                  png_bytepp rows) {
+    if (setjmp(png_jmpbuf(png_ptr))) {
+        return false;
+    }
+    const bool is_16bit = image.bytes_per_channel_ == 2;
+    int color_type = PNG_COLOR_TYPE_GRAY;
+    if (image.num_of_channels_ == 3) {
+        color_type = PNG_COLOR_TYPE_RGB;
+    } else if (image.num_of_channels_ == 4) {
+        color_type = PNG_COLOR_TYPE_RGB_ALPHA;
+    }
+    png_init_io(png_ptr, file);
+    png_set_IHDR(png_ptr, info_ptr, image.width_, image.height_,
+                 is_16bit ? 16 : 8, color_type, PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    // Same color space chunks as png_image_write_to_file.
+    if (is_16bit) {
+        png_set_gAMA_fixed(png_ptr, info_ptr, PNG_GAMMA_LINEAR);
+        png_set_cHRM_fixed(png_ptr, info_ptr, 31270, 32900, 64000, 33000,
+                           30000, 60000, 15000, 6000);
+    } else {
+        png_set_sRGB(png_ptr, info_ptr, PNG_sRGB_INTENT_PERCEPTUAL);
+    }
+    png_set_compression_level(png_ptr, quality);
+    if (quality <= 2) {
+        // The sub filter is cheap and compresses depth images well.
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE,
+                       is_16bit ? PNG_FILTER_SUB : PNG_FILTER_NONE);
+    } else if (is_16bit && image.num_of_channels_ == 1) {
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE,
+                       PNG_FILTER_SUB | PNG_FILTER_UP | PNG_FILTER_PAETH);
+    }
+    png_write_info(png_ptr, info_ptr);
+    if (is_16bit && IsHostLittleEndian()) {
+        png_set_swap(png_ptr);
+    }
+    png_write_image(png_ptr, rows);
+    png_write_end(png_ptr, nullptr);
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+bool ReadImageBufferFromPNG(const std::string &filename,
+                            const ImageBufferAllocator &allocate) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
     pngimage.version = PNG_IMAGE_VERSION;
@@ -74,12 +143,16 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
         pngimage.format &= ~PNG_FORMAT_FLAG_COLORMAP;
     }
 
-    image.Prepare(pngimage.width, pngimage.height,
-                  PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
-                  PNG_IMAGE_SAMPLE_COMPONENT_SIZE(pngimage.format));
+    uint8_t *data =
+            allocate(pngimage.width, pngimage.height,
+                     PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
+                     PNG_IMAGE_SAMPLE_COMPONENT_SIZE(pngimage.format));
+    if (data == nullptr) {
+        png_image_free(&pngimage);
+        return false;
+    }
 
-    if (png_image_finish_read(&pngimage, NULL, image.data_.data(), 0, NULL) ==
-        0) {
+    if (png_image_finish_read(&pngimage, NULL, data, 0, NULL) == 0) {
         utility::LogWarning("Read PNG failed: unable to read file: {}",
                             filename);
         utility::LogWarning("PNG error: {}", pngimage.message);
@@ -88,6 +161,16 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+    return ReadImageBufferFromPNG(
+            filename, [&image](int width, int height, int num_of_channels,
+                               int bytes_per_channel) {
+                image.Prepare(width, height, num_of_channels,
+                              bytes_per_channel);
+                return image.data_.data();
+            });
+}
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality) {
@@ -103,17 +186,54 @@ bool WriteImageToPNG(const std::string &filename,
                 quality);
         return false;
     }
-    png_image pngimage;
-    memset(&pngimage, 0, sizeof(pngimage));
-    pngimage.version = PNG_IMAGE_VERSION;
-    SetPNGImageFromImage(image, quality, pngimage);
-    if (png_image_write_to_file(&pngimage, filename.c_str(), 0,
-                                image.data_.data(), 0, NULL) == 0) {
+    // Gray, RGB and RGBA images with 8 bits and gray and RGB images with 16
+    // bits are written with the low level API, which sets the compression
+    // level and filters. The simplified API handles other layouts.
+    const bool is_direct =
+            (image.bytes_per_channel_ == 1 &&
+             (image.num_of_channels_ == 1 || image.num_of_channels_ == 3 ||
+              image.num_of_channels_ == 4)) ||
+            (image.bytes_per_channel_ == 2 &&
+             (image.num_of_channels_ == 1 || image.num_of_channels_ == 3));
+    if (!is_direct) {
+        png_image pngimage;
+        memset(&pngimage, 0, sizeof(pngimage));
+        pngimage.version = PNG_IMAGE_VERSION;
+        SetPNGImageFromImage(image, quality, pngimage);
+        if (png_image_write_to_file(&pngimage, filename.c_str(), 0,
+                                    image.data_.data(), 0, NULL) == 0) {
+            utility::LogWarning("Write PNG failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == nullptr) {
         utility::LogWarning("Write PNG failed: unable to write file: {}",
                             filename);
         return false;
     }
-    return true;
+    png_structp png_ptr = png_create_write_struct(
+            PNG_LIBPNG_VER_STRING, nullptr, PNGErrorCallback,
+            PNGWarningCallback);
+    png_infop info_ptr = png_ptr ? png_create_info_struct(png_ptr) : nullptr;
+    std::vector<png_bytep> rows(image.height_);
+    for (int i = 0; i < image.height_; i++) {
+        rows[i] = const_cast<png_bytep>(image.data_.data()) +
+                  size_t(i) * image.BytesPerLine();
+    }
+    const bool success =
+            info_ptr && PNGWriteRows(png_ptr, info_ptr, file, image, quality,
+                                     rows.data());
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
 }
 
 }  // namespace io
@@ -25,9 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -44,59 +46,54 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
-        if (num_of_pts <= 0) {
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const int64_t size = file.GetSize();
+        double num_of_pts_value = 0;
+        if (!ParseASCIIDouble(data, data + size, num_of_pts_value) ||
+            num_of_pts_value < 1) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
+        const int64_t num_of_pts = int64_t(num_of_pts_value);
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        reporter.SetTotal(size);
+
+        const int64_t data_offset = SkipASCIILines(data, size, 1);
+        const int num_of_fields =
+                CountASCIITokens(data + data_offset, size - data_offset);
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+        // X Y Z, or X Y Z I R G B. Every line is one point, invalid lines
+        // produce zeros.
+        const int num_values = num_of_fields >= 7 ? 7 : 3;
+        std::vector<double> values = ParseASCIIRecords(
+                data + data_offset, size - data_offset, num_values, true,
+                num_of_pts, nullptr, [&](int64_t bytes) {
+                    reporter.Update(data_offset + bytes);
+                });
+        const int64_t num_points = int64_t(values.size()) / num_values;
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st;
-                utility::SplitString(st, line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        pointcloud.points_.resize(num_points);
+        if (num_values == 7) {
+            pointcloud.colors_.resize(num_points);
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *record = &values[num_values * i];
+            pointcloud.points_[i] =
+                    Eigen::Vector3d(record[0], record[1], record[2]);
+            if (num_values == 7) {
+                pointcloud.colors_[i] = utility::ColorToDouble(
+                        int(record[4]), int(record[5]), int(record[6]));
             }
         }
         reporter.Finish();
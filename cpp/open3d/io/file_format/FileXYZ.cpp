@@ -25,9 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,26 +45,29 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
+
+        // Lines are parsed in parallel chunks, lines with fewer than 3
+        // numbers are skipped.
+        std::vector<double> values = ParseASCIIRecords(
+                reinterpret_cast<const char *>(file.GetData()),
+                file.GetSize(), 3, false, -1, nullptr,
+                [&](int64_t bytes) { reporter.Update(bytes); });
+        const int64_t num_points = int64_t(values.size()) / 3;
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        pointcloud.points_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            pointcloud.points_[i] = Eigen::Vector3d(
+                    values[3 * i], values[3 * i + 1], values[3 * i + 2]);
         }
         reporter.Finish();
 
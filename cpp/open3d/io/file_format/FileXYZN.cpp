@@ -25,9 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,28 +45,33 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZN failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
+
+        // Lines are parsed in parallel chunks, lines with fewer than 6
+        // numbers are skipped.
+        std::vector<double> values = ParseASCIIRecords(
+                reinterpret_cast<const char *>(file.GetData()),
+                file.GetSize(), 6, false, -1, nullptr,
+                [&](int64_t bytes) { reporter.Update(bytes); });
+        const int64_t num_points = int64_t(values.size()) / 6;
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *record = &values[6 * i];
+            pointcloud.points_[i] =
+                    Eigen::Vector3d(record[0], record[1], record[2]);
+            pointcloud.normals_[i] =
+                    Eigen::Vector3d(record[3], record[4], record[5]);
         }
         reporter.Finish();
 
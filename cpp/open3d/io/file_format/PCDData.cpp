@@ -0,0 +1,298 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/PCDData.h"
+
+#include <liblzf/lzf.h>
+
+#include <sstream>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace io {
+
+static bool CheckHeader(PCDHeader &header) {
+    if (header.points <= 0 || header.pointsize <= 0) {
+        utility::LogWarning("[CheckHeader] PCD has no data.");
+        return false;
+    }
+    if (header.fields.size() == 0 || header.pointsize <= 0) {
+        utility::LogWarning("[CheckHeader] PCD has no fields.");
+        return false;
+    }
+    header.has_points = false;
+    header.has_normals = false;
+    header.has_colors = false;
+    bool has_x = false;
+    bool has_y = false;
+    bool has_z = false;
+    bool has_normal_x = false;
+    bool has_normal_y = false;
+    bool has_normal_z = false;
+    bool has_rgb = false;
+    bool has_rgba = false;
+    for (const auto &field : header.fields) {
+        if (field.name == "x") {
+            has_x = true;
+        } else if (field.name == "y") {
+            has_y = true;
+        } else if (field.name == "z") {
+            has_z = true;
+        } else if (field.name == "normal_x") {
+            has_normal_x = true;
+        } else if (field.name == "normal_y") {
+            has_normal_y = true;
+        } else if (field.name == "normal_z") {
+            has_normal_z = true;
+        } else if (field.name == "rgb") {
+            has_rgb = true;
+        } else if (field.name == "rgba") {
+            has_rgba = true;
+        }
+    }
+    header.has_points = (has_x && has_y && has_z);
+    header.has_normals = (has_normal_x && has_normal_y && has_normal_z);
+    header.has_colors = (has_rgb || has_rgba);
+    if (!header.has_points) {
+        utility::LogWarning(
+                "[CheckHeader] Fields for point data are not complete.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadPCDHeader(FILE *file, PCDHeader &header) {
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    size_t specified_channel_count = 0;
+
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::string line(line_buffer);
+        if (line == "") {
+            continue;
+        }
+        std::vector<std::string> st;
+        utility::SplitString(st, line, "\t\r\n ");
+        std::stringstream sstream(line);
+        sstream.imbue(std::locale::classic());
+        std::string line_type;
+        sstream >> line_type;
+        if (line_type.substr(0, 1) == "#") {
+        } else if (line_type.substr(0, 7) == "VERSION") {
+            if (st.size() >= 2) {
+                header.version = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "FIELDS" ||
+                   line_type.substr(0, 7) == "COLUMNS") {
+            specified_channel_count = st.size() - 1;
+            if (specified_channel_count == 0) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            header.fields.resize(specified_channel_count);
+            int count_offset = 0, offset = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, count_offset += 1, offset += 4) {
+                header.fields[i].name = st[i + 1];
+                header.fields[i].size = 4;
+                header.fields[i].type = 'F';
+                header.fields[i].count = 1;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "SIZE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int offset = 0, col_type = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, offset += col_type) {
+                sstream >> col_type;
+                header.fields[i].size = col_type;
+                header.fields[i].offset = offset;
+            }
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "TYPE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                header.fields[i].type = st[i + 1].c_str()[0];
+            }
+        } else if (line_type.substr(0, 5) == "COUNT") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int count_offset = 0, offset = 0, col_count = 0;
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                sstream >> col_count;
+                header.fields[i].count = col_count;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+                count_offset += col_count;
+                offset += col_count * header.fields[i].size;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            sstream >> header.width;
+        } else if (line_type.substr(0, 6) == "HEIGHT") {
+            sstream >> header.height;
+            header.points = header.width * header.height;
+        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
+            if (st.size() >= 2) {
+                header.viewpoint = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "POINTS") {
+            sstream >> header.points;
+        } else if (line_type.substr(0, 4) == "DATA") {
+            header.datatype = PCD_DATA_ASCII;
+            if (st.size() >= 2) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.datatype = PCD_DATA_BINARY;
+                }
+            }
+            break;
+        }
+    }
+    if (!CheckHeader(header)) {
+        return false;
+    }
+    return true;
+}
+
+const uint8_t *PCDBinaryData::GetFieldData(const PCLPointField &field) const {
+    return buffer_.data() +
+           (field_major_ ? field.offset * num_points_ : field.offset);
+}
+
+int64_t PCDBinaryData::GetFieldStride(const PCLPointField &field) const {
+    return field_major_ ? field.size * field.count : point_size_;
+}
+
+bool PCDBinaryData::Read(FILE *file, const PCDHeader &header) {
+    num_points_ = header.points;
+    point_size_ = header.pointsize;
+    const size_t data_size = size_t(num_points_) * size_t(point_size_);
+    if (header.datatype == PCD_DATA_BINARY) {
+        field_major_ = false;
+        buffer_.resize(data_size);
+        if (fread(buffer_.data(), 1, data_size, file) != data_size) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
+        field_major_ = true;
+        std::uint32_t compressed_size;
+        std::uint32_t uncompressed_size;
+        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1 ||
+            fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
+                    1) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        utility::LogDebug(
+                "PCD data with {:d} compressed size, and {:d} uncompressed "
+                "size.",
+                compressed_size, uncompressed_size);
+        if (uncompressed_size < data_size) {
+            utility::LogWarning(
+                    "[ReadPCDData] Uncompressed size {:d} is smaller than "
+                    "the data of {:d} points.",
+                    uncompressed_size, num_points_);
+            return false;
+        }
+        std::vector<uint8_t> buffer_compressed(compressed_size);
+        if (fread(buffer_compressed.data(), 1, compressed_size, file) !=
+            compressed_size) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        buffer_.resize(uncompressed_size);
+        if (lzf_decompress(buffer_compressed.data(), compressed_size,
+                           buffer_.data(), uncompressed_size) !=
+            uncompressed_size) {
+            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+            return false;
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool PCDBinaryData::ReadPoints(FILE *file,
+                               const PCDHeader &header,
+                               int64_t num_points) {
+    if (header.datatype != PCD_DATA_BINARY) {
+        return false;
+    }
+    field_major_ = false;
+    num_points_ = num_points;
+    point_size_ = header.pointsize;
+    const size_t data_size = size_t(num_points_) * size_t(point_size_);
+    buffer_.resize(data_size);
+    if (fread(buffer_.data(), 1, data_size, file) != data_size) {
+        utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        return false;
+    }
+    return true;
+}
+
+void PCDBinaryData::DecodeColorField(const PCLPointField &field,
+                                     double *dst,
+                                     int64_t dst_stride,
+                                     int64_t begin,
+                                     int64_t count) const {
+    count = GetRangeSize(begin, count);
+    const int64_t src_stride = GetFieldStride(field);
+    const uint8_t *src = GetFieldData(field) + begin * src_stride;
+    const bool packed = field.size == 4;
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; i++) {
+        double *color = dst + i * dst_stride;
+        if (packed) {
+            // color data is packed in BGR order.
+            const uint8_t *bgr = src + i * src_stride;
+            color[0] = bgr[2] / 255.0;
+            color[1] = bgr[1] / 255.0;
+            color[2] = bgr[0] / 255.0;
+        } else {
+            color[0] = color[1] = color[2] = 0.0;
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset;
+    int offset;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int width;
+    int height;
+    int points;
+    PCDDataType datatype;
+    std::string viewpoint;
+    // helper variables
+    int elementnum;
+    int pointsize;
+    bool has_points;
+    bool has_normals;
+    bool has_colors;
+};
+
+/// Parses the header of a PCD file. On success \p file is positioned at the
+/// start of the data section.
+bool ReadPCDHeader(FILE *file, PCDHeader &header);
+
+/// \class PCDBinaryData
+///
+/// \brief The data section of a binary or binary_compressed PCD file.
+///
+/// The section is read with a single fread, binary_compressed data is
+/// decompressed into a preallocated buffer. Fields are then decoded column by
+/// column with loops specialized on the field type, in parallel over points.
+class PCDBinaryData {
+public:
+    PCDBinaryData() {}
+
+    /// Reads the data section following the header from \p file.
+    bool Read(FILE *file, const PCDHeader &header);
+
+    /// \brief Reads the next \p num_points points of a binary data section
+    /// from \p file, replacing the points read before. Used to stream files
+    /// in chunks, binary_compressed data can only be read as a whole.
+    bool ReadPoints(FILE *file, const PCDHeader &header, int64_t num_points);
+
+    /// \brief Decodes the first value of \p field of \p count points
+    /// starting at point \p begin into \p dst, converting to T. \p dst holds
+    /// \p dst_stride values per point, so a field can be written into one
+    /// column of an interleaved array. A negative \p count decodes all points
+    /// from \p begin. Unsupported field types decode to zero.
+    template <typename T>
+    void DecodeField(const PCLPointField &field,
+                     T *dst,
+                     int64_t dst_stride,
+                     int64_t begin = 0,
+                     int64_t count = -1) const;
+
+    /// Decodes a packed rgb or rgba field into 3 values in [0, 1] per point.
+    void DecodeColorField(const PCLPointField &field,
+                          double *dst,
+                          int64_t dst_stride,
+                          int64_t begin = 0,
+                          int64_t count = -1) const;
+
+    int64_t NumPoints() const { return num_points_; }
+
+private:
+    /// Address of the value of \p field of the first point.
+    const uint8_t *GetFieldData(const PCLPointField &field) const;
+
+    /// Distance in bytes between the values of \p field of two points.
+    int64_t GetFieldStride(const PCLPointField &field) const;
+
+    /// Number of points of a range starting at \p begin, \p count if it is
+    /// non-negative and all remaining points otherwise.
+    int64_t GetRangeSize(int64_t begin, int64_t count) const {
+        return count < 0 ? num_points_ - begin : count;
+    }
+
+    template <typename S, typename T>
+    void DecodeStrided(const PCLPointField &field,
+                       T *dst,
+                       int64_t dst_stride,
+                       int64_t begin,
+                       int64_t count) const;
+
+private:
+    std::vector<uint8_t> buffer_;
+    int64_t num_points_ = 0;
+    int64_t point_size_ = 0;
+    /// binary_compressed data is stored field by field instead of point by
+    /// point.
+    bool field_major_ = false;
+};
+
+template <typename S, typename T>
+void PCDBinaryData::DecodeStrided(const PCLPointField &field,
+                                  T *dst,
+                                  int64_t dst_stride,
+                                  int64_t begin,
+                                  int64_t count) const {
+    const int64_t src_stride = GetFieldStride(field);
+    const uint8_t *src = GetFieldData(field) + begin * src_stride;
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; i++) {
+        S value;
+        std::memcpy(&value, src + i * src_stride, sizeof(S));
+        dst[i * dst_stride] = static_cast<T>(value);
+    }
+}
+
+template <typename T>
+void PCDBinaryData::DecodeField(const PCLPointField &field,
+                                T *dst,
+                                int64_t dst_stride,
+                                int64_t begin,
+                                int64_t count) const {
+    count = GetRangeSize(begin, count);
+    if (field.type == 'I' && field.size == 1) {
+        DecodeStrided<int8_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'I' && field.size == 2) {
+        DecodeStrided<int16_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'I' && field.size == 4) {
+        DecodeStrided<int32_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'U' && field.size == 1) {
+        DecodeStrided<uint8_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'U' && field.size == 2) {
+        DecodeStrided<uint16_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'U' && field.size == 4) {
+        DecodeStrided<uint32_t>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'F' && field.size == 4) {
+        DecodeStrided<float>(field, dst, dst_stride, begin, count);
+    } else if (field.type == 'F' && field.size == 8) {
+        DecodeStrided<double>(field, dst, dst_stride, begin, count);
+    } else {
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < count; i++) {
+            dst[i * dst_stride] = T(0);
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -46,6 +46,10 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Multipart messages cannot be written to a buffer. Throws an exception.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& parts);
+
     std::stringstream& buffer() { return buffer_; }
     const std::stringstream& buffer() const { return buffer_; }
 
@@ -53,12 +53,14 @@ Connection::Connection()
 
 Connection::Connection(const std::string& address,
                        int connect_timeout,
-                       int timeout)
+                       int timeout,
+                       bool multipart)
     : context_(GetZMQContext()),
       socket_(new zmq::socket_t(*GetZMQContext(), ZMQ_REQ)),
       address_(address),
       connect_timeout_(connect_timeout),
-      timeout_(timeout) {
+      timeout_(timeout),
+      multipart_(multipart) {
     socket_->set(zmq::sockopt::linger, timeout_);
     socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
     socket_->set(zmq::sockopt::rcvtimeo, timeout_);
@@ -75,7 +77,28 @@ std::shared_ptr<zmq::message_t> Connection::Send(zmq::message_t& send_msg) {
             LogInfo("Connection::send() send failed with: {}", err.what());
         }
     }
+    return ReceiveReply();
+}
+
+std::shared_ptr<zmq::message_t> Connection::SendMultipart(
+        std::vector<zmq::message_t>& parts) {
+    for (size_t i = 0; i < parts.size(); ++i) {
+        const auto flags = i + 1 < parts.size() ? zmq::send_flags::sndmore
+                                                : zmq::send_flags::none;
+        if (!socket_->send(parts[i], flags)) {
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::SendMultipart() send failed with: {}",
+                        err.what());
+            }
+            // No request was completed, so there is no reply to wait for.
+            return std::shared_ptr<zmq::message_t>(new zmq::message_t());
+        }
+    }
+    return ReceiveReply();
+}
 
+std::shared_ptr<zmq::message_t> Connection::ReceiveReply() {
     std::shared_ptr<zmq::message_t> msg(new zmq::message_t());
     if (socket_->recv(*msg)) {
         LogDebug("Connection::send() received answer with {} bytes",
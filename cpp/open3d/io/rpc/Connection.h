@@ -51,7 +51,14 @@ public:
     ///
     /// \param timeout          The timeout for sending data.
     ///
-    Connection(const std::string& address, int connect_timeout, int timeout);
+    /// \param multipart        If true, tensor data is sent as separate parts
+    /// of multipart messages without copying. The receiver must support
+    /// multipart messages.
+    ///
+    Connection(const std::string& address,
+               int connect_timeout,
+               int timeout,
+               bool multipart = false);
     ~Connection();
 
     /// Function for sending data wrapped in a zmq message object.
@@ -60,14 +67,23 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a multipart message.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& parts);
+
+    bool IsMultipart() const { return multipart_; }
+
     static std::string DefaultAddress();
 
 private:
+    std::shared_ptr<zmq::message_t> ReceiveReply();
+
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     const std::string address_;
     const int connect_timeout_;
     const int timeout_;
+    const bool multipart_;
 };
 }  // namespace rpc
 }  // namespace io
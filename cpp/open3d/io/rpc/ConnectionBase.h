@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -47,6 +48,15 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending a multipart message. The first part stores the
+    /// msgpack encoded messages, the other parts store the data of arrays.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& parts) = 0;
+
+    /// Returns true if array data should be sent as separate parts of
+    /// multipart messages. The receiver must support multipart messages.
+    virtual bool IsMultipart() const { return false; }
 };
 }  // namespace rpc
 }  // namespace io
@@ -46,6 +46,12 @@ public:
             const MsgpackObject& obj) override {
         return CreateStatusOKMsg();
     }
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::UpdateMeshData& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
     std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::GetMeshData& msg,
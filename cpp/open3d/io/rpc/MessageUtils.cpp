@@ -26,8 +26,12 @@
 
 #include "open3d/io/rpc/MessageUtils.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <zmq.hpp>
 
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/utility/Console.h"
 
@@ -107,6 +111,195 @@ std::shared_ptr<zmq::message_t> CreateStatusOKMsg() {
             new zmq::message_t(sbuf.data(), sbuf.size()));
 }
 
+/// Checks that the data of the array of shape [n, 3] has n rows. The shape is
+/// sent by the client, so the row count is computed by dividing the size.
+/// Returns false on mismatch and appends an error description to errstr.
+static bool CheckRowData(const messages::Array& array, std::string& errstr) {
+    const int64_t row_bytes = 3 * array.ItemSize();
+    if (row_bytes > 0 && array.data.size % row_bytes == 0 &&
+        int64_t(array.data.size / row_bytes) == array.shape[0]) {
+        return true;
+    }
+    errstr += " data size " + std::to_string(array.data.size) +
+              " does not match the shape";
+    return false;
+}
+
+/// Resizes \p vectors to \p size and copies the array of shape [n, 3] to the
+/// vectors starting at \p begin.
+static void CopyArrayToVectors(const messages::Array& array,
+                               size_t begin,
+                               size_t size,
+                               std::vector<Eigen::Vector3d>& vectors) {
+    vectors.resize(size, Eigen::Vector3d::Zero());
+    if (array.type == messages::TypeStr<float>()) {
+        const float* ptr = array.Ptr<float>();
+        for (int64_t i = 0; i < array.shape[0]; ++i) {
+            vectors[begin + i] = Eigen::Vector3d(ptr[0], ptr[1], ptr[2]);
+            ptr += 3;
+        }
+    } else if (array.type == messages::TypeStr<double>()) {
+        const double* ptr = array.Ptr<double>();
+        for (int64_t i = 0; i < array.shape[0]; ++i) {
+            vectors[begin + i] = Eigen::Vector3d(ptr[0], ptr[1], ptr[2]);
+            ptr += 3;
+        }
+    }
+}
+
+template <class T>
+static void DequantizeValues(const char* data,
+                             int64_t num_values,
+                             const std::vector<double>& scale,
+                             const std::vector<double>& offset,
+                             float* values) {
+    const int64_t cols = int64_t(scale.size());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_values; ++i) {
+        T stored;
+        std::memcpy(&stored, data + i * sizeof(T), sizeof(T));
+        values[i] = float(offset[i % cols] + scale[i % cols] * stored);
+    }
+}
+
+bool DequantizeArray(messages::Array& array) {
+    if (!array.IsQuantized()) {
+        return true;
+    }
+    if (array.type != messages::TypeStr<uint8_t>() &&
+        array.type != messages::TypeStr<uint16_t>()) {
+        LogDebug("DequantizeArray: unsupported type {}", array.type);
+        return false;
+    }
+    if (array.shape.empty() ||
+        array.scale.size() != size_t(array.shape.back()) ||
+        array.offset.size() != array.scale.size() ||
+        int64_t(array.data.size) != array.NumBytes()) {
+        LogDebug("DequantizeArray: invalid quantized array");
+        return false;
+    }
+
+    const int64_t num_values = array.NumBytes() / array.ItemSize();
+    auto values = std::make_shared<std::vector<float>>(num_values);
+    if (array.type == messages::TypeStr<uint8_t>()) {
+        DequantizeValues<uint8_t>(array.data.ptr, num_values, array.scale,
+                                  array.offset, values->data());
+    } else {
+        DequantizeValues<uint16_t>(array.data.ptr, num_values, array.scale,
+                                   array.offset, values->data());
+    }
+    array.type = messages::TypeStr<float>();
+    array.data = msgpack::type::raw_ref(
+            reinterpret_cast<const char*>(values->data()),
+            uint32_t(num_values * sizeof(float)));
+    array.owner = values;
+    array.scale.clear();
+    array.offset.clear();
+    return true;
+}
+
+core::Tensor ArrayToTensor(const messages::Array& array) {
+    if (array.IsQuantized()) {
+        messages::Array dequantized = array;
+        if (!DequantizeArray(dequantized)) {
+            LogError("ArrayToTensor: invalid quantized array");
+        }
+        return ArrayToTensor(dequantized);
+    }
+    core::Dtype dtype;
+    if (array.type == messages::TypeStr<core::Half>()) {
+        dtype = core::Dtype::Float16;
+    } else if (array.type == messages::TypeStr<float>()) {
+        dtype = core::Dtype::Float32;
+    } else if (array.type == messages::TypeStr<double>()) {
+        dtype = core::Dtype::Float64;
+    } else if (array.type == messages::TypeStr<int8_t>()) {
+        dtype = core::Dtype::Int8;
+    } else if (array.type == messages::TypeStr<int16_t>()) {
+        dtype = core::Dtype::Int16;
+    } else if (array.type == messages::TypeStr<int32_t>()) {
+        dtype = core::Dtype::Int32;
+    } else if (array.type == messages::TypeStr<int64_t>()) {
+        dtype = core::Dtype::Int64;
+    } else if (array.type == messages::TypeStr<uint8_t>()) {
+        dtype = core::Dtype::UInt8;
+    } else if (array.type == messages::TypeStr<uint16_t>()) {
+        dtype = core::Dtype::UInt16;
+    } else {
+        LogError("ArrayToTensor: unsupported array type {}", array.type);
+    }
+    const core::SizeVector shape(array.shape);
+    if (int64_t(array.data.size) != shape.NumElements() * dtype.ByteSize()) {
+        LogError("ArrayToTensor: array data has {} bytes, expected {}",
+                 array.data.size, shape.NumElements() * dtype.ByteSize());
+    }
+
+    if (array.owner) {
+        void* data_ptr = const_cast<char*>(array.data.ptr);
+        std::shared_ptr<void> owner = array.owner;
+        auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"),
+                                                 data_ptr, [owner](void*) {});
+        return core::Tensor(shape, core::Tensor::DefaultStrides(shape),
+                            data_ptr, dtype, blob);
+    }
+    core::Tensor tensor(shape, dtype);
+    if (array.data.size) {
+        std::memcpy(tensor.GetDataPtr(), array.data.ptr, array.data.size);
+    }
+    return tensor;
+}
+
+bool UpdatePointCloud(const messages::UpdateMeshData& msg,
+                      geometry::PointCloud& pcd,
+                      std::string& errstr) {
+    if (!msg.data.CheckVertices(errstr) ||
+        !msg.data.vertices.CheckType(
+                {messages::TypeStr<float>(), messages::TypeStr<double>()},
+                errstr)) {
+        return false;
+    }
+    std::string vertices_errstr = "invalid vertices array:";
+    if (!CheckRowData(msg.data.vertices, vertices_errstr)) {
+        errstr += vertices_errstr;
+        return false;
+    }
+
+    const size_t num_vertices = size_t(msg.data.vertices.shape[0]);
+    const size_t begin =
+            msg.vertex_offset < 0
+                    ? pcd.points_.size()
+                    : std::min(size_t(msg.vertex_offset), pcd.points_.size());
+    const size_t size = std::max(pcd.points_.size(), begin + num_vertices);
+    CopyArrayToVectors(msg.data.vertices, begin, size, pcd.points_);
+
+    std::map<std::string, std::vector<Eigen::Vector3d>*> attributes = {
+            {"normals", &pcd.normals_}, {"colors", &pcd.colors_}};
+    for (auto& attribute : attributes) {
+        std::vector<Eigen::Vector3d>& pcd_attr = *attribute.second;
+        auto attr_itr = msg.data.vertex_attributes.find(attribute.first);
+        std::string attr_errstr;
+        if (attr_itr == msg.data.vertex_attributes.end()) {
+            // Keep the attribute consistent with the number of points.
+            if (!pcd_attr.empty()) {
+                pcd_attr.resize(size, Eigen::Vector3d::Zero());
+            }
+        } else if (!attr_itr->second.CheckType({messages::TypeStr<float>(),
+                                                messages::TypeStr<double>()},
+                                               attr_errstr) ||
+                   !attr_itr->second.CheckShape({int64_t(num_vertices), 3},
+                                                attr_errstr) ||
+                   !CheckRowData(attr_itr->second, attr_errstr)) {
+            LogInfo("Ignoring {}:{}", attribute.first, attr_errstr);
+            if (!pcd_attr.empty()) {
+                pcd_attr.resize(size, Eigen::Vector3d::Zero());
+            }
+        } else {
+            CopyArrayToVectors(attr_itr->second, begin, size, pcd_attr);
+        }
+    }
+    return true;
+}
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
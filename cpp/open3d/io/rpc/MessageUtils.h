@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "open3d/core/Tensor.h"
 #include "open3d/io/rpc/ReceiverBase.h"
 
 namespace zmq {
@@ -33,12 +34,18 @@ class message_t;
 }
 
 namespace open3d {
+namespace geometry {
+class PointCloud;
+}
+
 namespace io {
 namespace rpc {
 
 namespace messages {
+struct Array;
 struct Status;
-}
+struct UpdateMeshData;
+}  // namespace messages
 
 /// Helper function for unpacking the Status message from a reply.
 /// \param msg     The message that contains the Reply and the Status messages.
@@ -74,6 +81,35 @@ std::tuple<int32_t, std::string> GetStatusCodeAndStr(
 
 std::shared_ptr<zmq::message_t> CreateStatusOKMsg();
 
+/// \brief Converts a quantized array to an array of floats stored in a buffer
+/// owned by Array::owner. Arrays that are not quantized are not changed.
+///
+/// \return false if the array is not a valid quantized array.
+bool DequantizeArray(messages::Array& array);
+
+/// \brief Converts an array of a received message to a CPU tensor.
+///
+/// If the array data is kept alive by Array::owner, e.g. the array was
+/// received as a frame of a multipart message, the tensor shares the memory
+/// with the frame. Otherwise the data is copied. Quantized arrays are
+/// converted to Float32 tensors.
+/// Throws an exception if the type of the array is not supported.
+core::Tensor ArrayToTensor(const messages::Array& array);
+
+/// \brief Applies an UpdateMeshData message to a point cloud.
+///
+/// The vertices of the message replace the points starting at
+/// UpdateMeshData::vertex_offset and extend the point cloud past its end. A
+/// negative offset appends the vertices. Normals and colors of the message
+/// are written to the same range. Normals and colors that are not in the
+/// message are padded with zeros.
+///
+/// \return false if the vertices of the message are invalid. The reason is
+/// appended to \p errstr.
+bool UpdatePointCloud(const messages::UpdateMeshData& msg,
+                      geometry::PointCloud& pcd,
+                      std::string& errstr);
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
@@ -28,10 +28,13 @@
 #include <boost/predef/other/endian.h>
 
 #include <map>
+#include <memory>
 #include <msgpack.hpp>
 #include <string>
 #include <vector>
 
+#include "open3d/core/Half.h"
+
 #if BOOST_ENDIAN_LITTLE_BYTE
 #define ENDIANNESS_STR "<"
 #elif BOOST_ENDIAN_BIG_BYTE
@@ -52,6 +55,10 @@ inline std::string TypeStr() {
     return "";
 }
 template <>
+inline std::string TypeStr<core::Half>() {
+    return ENDIANNESS_STR "f2";
+}
+template <>
 inline std::string TypeStr<float>() {
     return ENDIANNESS_STR "f4";
 }
@@ -114,6 +121,13 @@ inline std::string TypeStr<uint64_t>() {
 ///       return np.frombuffer(dic['data'],
 ///       dtype=np.dtype(dic['type'])).reshape(dic['shape'])
 ///
+/// In multipart messages the data of an array can be stored in a separate
+/// frame instead of the 'data' field. The field 'frame' is then the index of
+/// that frame, the msgpack encoded messages are in frame 0.
+///
+/// Quantized arrays store unsigned integers and the fields 'scale' and
+/// 'offset'. Element i of the last dimension has the value
+/// offset[i] + scale[i] * stored value.
 struct Array {
     static std::string MsgId() { return "array"; }
 
@@ -132,12 +146,44 @@ struct Array {
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// Index of the frame of a multipart message that stores the data, or -1
+    /// if the data is stored in \p data.
+    int64_t frame = -1;
+    /// Dequantization scale for each element of the last dimension. Empty if
+    /// the array is not quantized.
+    std::vector<double> scale;
+    /// Dequantization offset for each element of the last dimension.
+    std::vector<double> offset;
+    /// Keeps the memory referenced by \p data alive, e.g. the frame of a
+    /// received multipart message. This member is not serialized.
+    std::shared_ptr<void> owner;
+
+    bool IsQuantized() const { return !scale.empty(); }
 
     template <class T>
     const T* Ptr() const {
         return (T*)data.ptr;
     }
 
+    /// Returns the size of an element in bytes, as given by the type string,
+    /// or 0 if the type string is invalid.
+    int64_t ItemSize() const {
+        if (type.size() < 3) return 0;
+        int64_t size = 0;
+        for (size_t i = 2; i < type.size(); ++i) {
+            if (type[i] < '0' || type[i] > '9') return 0;
+            size = size * 10 + (type[i] - '0');
+        }
+        return size;
+    }
+
+    /// Returns the number of bytes of the data as given by type and shape.
+    int64_t NumBytes() const {
+        int64_t num = 1;
+        for (int64_t n : shape) num *= n;
+        return num * ItemSize();
+    }
+
     /// Checks the rank of the shape.
     /// Returns false on mismatch and appends an error description to errstr.
     bool CheckRank(const std::vector<int>& expected_ranks,
@@ -239,7 +285,7 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(type, shape, data, frame, scale, offset);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -358,6 +404,33 @@ struct SetMeshData {
     MSGPACK_DEFINE_MAP(path, time, layer, data);
 };
 
+/// struct for defining an "update_mesh_data" message, which replaces or
+/// appends a range of vertices of existing mesh data, e.g. to stream a growing
+/// point cloud without sending all points again.
+struct UpdateMeshData {
+    static std::string MsgId() { return "update_mesh_data"; }
+
+    UpdateMeshData() : time(0), vertex_offset(-1) {}
+
+    /// Path defining the location in the scene tree.
+    std::string path;
+    /// The time associated with this data
+    int32_t time;
+    /// The layer for this data
+    std::string layer;
+
+    /// Index of the first vertex replaced by the vertices in \p data.
+    /// Vertices past the end of the existing data are appended. -1 appends
+    /// all vertices.
+    int64_t vertex_offset;
+
+    /// The vertices and vertex attributes of the range. Faces and lines are
+    /// ignored.
+    MeshData data;
+
+    MSGPACK_DEFINE_MAP(path, time, layer, vertex_offset, data);
+};
+
 /// struct for defining a "get_mesh_data" message, which requests mesh data.
 struct GetMeshData {
     static std::string MsgId() { return "get_mesh_data"; }
@@ -28,6 +28,7 @@
 
 #include <zmq.hpp>
 
+#include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -45,6 +46,74 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+typedef std::vector<std::shared_ptr<zmq::message_t>> Frames;
+
+/// Points the data of \p array to its frame, if the array is stored in a
+/// separate frame of a multipart message, and dequantizes quantized arrays.
+/// Returns false if the frame does not exist or its size does not match the
+/// type and shape of the array.
+bool ResolveFrame(open3d::io::rpc::messages::Array& array,
+                  const Frames& frames) {
+    if (array.frame < 0) {
+        return open3d::io::rpc::DequantizeArray(array);
+    }
+    // Frame 0 stores the msgpack encoded messages.
+    if (array.frame == 0 || size_t(array.frame) > frames.size()) {
+        return false;
+    }
+    const std::shared_ptr<zmq::message_t>& frame = frames[array.frame - 1];
+    if (int64_t(frame->size()) != array.NumBytes()) {
+        return false;
+    }
+    array.data = msgpack::type::raw_ref(static_cast<const char*>(frame->data()),
+                                        uint32_t(frame->size()));
+    array.owner = frame;
+    return open3d::io::rpc::DequantizeArray(array);
+}
+
+bool ResolveFrames(std::map<std::string, open3d::io::rpc::messages::Array>& map,
+                   const Frames& frames) {
+    for (auto& item : map) {
+        if (!ResolveFrame(item.second, frames)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Resolves the arrays of messages that contain arrays.
+template <class T>
+bool ResolveFrames(T& msg, const Frames& frames) {
+    return true;
+}
+
+bool ResolveFrames(open3d::io::rpc::messages::MeshData& data,
+                   const Frames& frames) {
+    return ResolveFrame(data.vertices, frames) &&
+           ResolveFrames(data.vertex_attributes, frames) &&
+           ResolveFrame(data.faces, frames) &&
+           ResolveFrames(data.face_attributes, frames) &&
+           ResolveFrame(data.lines, frames) &&
+           ResolveFrames(data.line_attributes, frames) &&
+           ResolveFrames(data.textures, frames);
+}
+
+bool ResolveFrames(open3d::io::rpc::messages::SetMeshData& msg,
+                   const Frames& frames) {
+    return ResolveFrames(msg.data, frames);
+}
+
+bool ResolveFrames(open3d::io::rpc::messages::UpdateMeshData& msg,
+                   const Frames& frames) {
+    return ResolveFrames(msg.data, frames);
+}
+
+bool ResolveFrames(open3d::io::rpc::messages::SetCameraData& msg,
+                   const Frames& frames) {
+    return ResolveFrames(msg.data.images, frames);
+}
+
 }  // namespace
 
 namespace open3d {
@@ -152,6 +221,18 @@ void ReceiverBase::Mainloop() {
             if (!socket_->recv(message)) {
                 continue;
             }
+            // The following frames of a multipart message store array data.
+            // zmq delivers all frames of a message at once.
+            Frames frames;
+            bool more = message.more();
+            while (more) {
+                auto frame = std::make_shared<zmq::message_t>();
+                if (!socket_->recv(*frame)) {
+                    break;
+                }
+                more = frame->more();
+                frames.push_back(frame);
+            }
 
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
@@ -177,6 +258,9 @@ void ReceiverBase::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        if (!ResolveFrames(msg, frames)) {                              \
+            throw std::runtime_error("invalid array frame");            \
+        }                                                               \
         auto reply = ProcessMessage(req, msg, MsgpackObject(obj));      \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -186,6 +270,7 @@ void ReceiverBase::Mainloop() {
         }                                                               \
     }
                     PROCESS_MESSAGE(messages::SetMeshData)
+                    PROCESS_MESSAGE(messages::UpdateMeshData)
                     PROCESS_MESSAGE(messages::GetMeshData)
                     PROCESS_MESSAGE(messages::SetCameraData)
                     PROCESS_MESSAGE(messages::SetProperties)
@@ -242,6 +327,18 @@ std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
     status.str += ": messages with id " + msg.MsgId() + " are not supported";
     return CreateStatusMessage(status);
 }
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::UpdateMeshData& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
 std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
         const messages::Request& req,
         const messages::GetMeshData& msg,
@@ -45,6 +45,7 @@ namespace rpc {
 namespace messages {
 struct Request;
 struct SetMeshData;
+struct UpdateMeshData;
 struct GetMeshData;
 struct SetCameraData;
 struct SetProperties;
@@ -95,6 +96,10 @@ protected:
             const messages::Request& req,
             const messages::SetMeshData& msg,
             const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::UpdateMeshData& msg,
+            const MsgpackObject& obj);
     virtual std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::GetMeshData& msg,
@@ -27,6 +27,9 @@
 #include "open3d/io/rpc/RemoteFunctions.h"
 
 #include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <zmq.hpp>
 
 #include "open3d/core/Dispatch.h"
@@ -37,6 +40,156 @@
 
 using namespace open3d::utility;
 
+namespace {
+
+/// Creates a zmq message referencing the memory of \p tensor. A copy of the
+/// tensor keeps the memory alive until zmq has sent the message. The data is
+/// only read, so the memory of a lazily copied tensor is not detached.
+zmq::message_t CreateTensorMessage(const open3d::core::Tensor& tensor) {
+    const auto* owner = new open3d::core::Tensor(tensor);
+    return zmq::message_t(
+            const_cast<void*>(owner->GetDataPtr()),
+            owner->NumElements() * owner->GetDtype().ByteSize(),
+            [](void*, void* hint) {
+                delete static_cast<const open3d::core::Tensor*>(hint);
+            },
+            const_cast<open3d::core::Tensor*>(owner));
+}
+
+/// Quantizes the columns of a [rows, cols] array to the range of TDst. With
+/// \p unit_range the values are expected in [0, 1], otherwise the range of
+/// each column is used.
+template <class TSrc, class TDst>
+void QuantizeColumns(const TSrc* src,
+                     int64_t rows,
+                     int64_t cols,
+                     bool unit_range,
+                     TDst* dst,
+                     std::vector<double>& scale,
+                     std::vector<double>& offset) {
+    const double max_value = std::numeric_limits<TDst>::max();
+    scale.assign(cols, 1.0 / max_value);
+    offset.assign(cols, 0.0);
+    if (!unit_range && rows > 0) {
+        std::vector<double> min_values(src, src + cols);
+        std::vector<double> max_values(src, src + cols);
+        for (int64_t i = 1; i < rows; ++i) {
+            for (int64_t c = 0; c < cols; ++c) {
+                const double value = src[i * cols + c];
+                min_values[c] = std::min(min_values[c], value);
+                max_values[c] = std::max(max_values[c], value);
+            }
+        }
+        for (int64_t c = 0; c < cols; ++c) {
+            offset[c] = min_values[c];
+            if (max_values[c] > min_values[c]) {
+                scale[c] = (max_values[c] - min_values[c]) / max_value;
+            }
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < rows; ++i) {
+        for (int64_t c = 0; c < cols; ++c) {
+            double q = std::round((src[i * cols + c] - offset[c]) / scale[c]);
+            // Also maps NaN to 0.
+            if (!(q >= 0.0)) q = 0.0;
+            dst[i * cols + c] = TDst(std::min(q, max_value));
+        }
+    }
+}
+
+/// Creates the arrays of a message from tensors and sends the message. The
+/// encoder keeps the tensors alive until the message is sent. With multipart
+/// connections the arrays reference separate frames, which are sent without
+/// copying the tensors.
+class ArrayEncoder {
+public:
+    explicit ArrayEncoder(bool multipart) : multipart_(multipart) {}
+
+    open3d::io::rpc::messages::Array Encode(const open3d::core::Tensor& a) {
+        using namespace open3d;
+        if (a.GetDevice().GetType() != core::Device::DeviceType::CPU) {
+            tensors_.push_back(a.Copy(core::Device("CPU:0")));
+        } else {
+            tensors_.push_back(a.Contiguous());
+        }
+        const core::Tensor& tensor = tensors_.back();
+        io::rpc::messages::Array array =
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(tensor.GetDtype(), [&]() {
+                    return io::rpc::messages::Array::FromPtr(
+                            (scalar_t*)tensor.GetDataPtr(),
+                            static_cast<std::vector<int64_t>>(
+                                    tensor.GetShape()));
+                });
+        if (multipart_) {
+            array.data = msgpack::type::raw_ref(nullptr, 0);
+            frame_tensors_.push_back(tensor);
+            array.frame = int64_t(frame_tensors_.size());
+        }
+        return array;
+    }
+
+    /// Encodes a Float32 or Float64 tensor of shape [rows, cols] as a
+    /// quantized array of type \p dtype, UInt8 or UInt16.
+    open3d::io::rpc::messages::Array EncodeQuantized(
+            const open3d::core::Tensor& a,
+            open3d::core::Dtype dtype,
+            bool unit_range) {
+        using namespace open3d;
+        const core::Tensor src = a.Copy(core::Device("CPU:0"));
+        const int64_t rows = src.GetShape()[0];
+        const int64_t cols = src.GetShape()[1];
+        core::Tensor quantized({rows, cols}, dtype);
+        std::vector<double> scale, offset;
+        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            const scalar_t* src_ptr =
+                    static_cast<const scalar_t*>(src.GetDataPtr());
+            if (dtype == core::Dtype::UInt8) {
+                QuantizeColumns(src_ptr, rows, cols, unit_range,
+                                static_cast<uint8_t*>(quantized.GetDataPtr()),
+                                scale, offset);
+            } else {
+                QuantizeColumns(src_ptr, rows, cols, unit_range,
+                                static_cast<uint16_t*>(quantized.GetDataPtr()),
+                                scale, offset);
+            }
+        });
+        io::rpc::messages::Array array = Encode(quantized);
+        array.scale = scale;
+        array.offset = offset;
+        return array;
+    }
+
+    /// Sends the request and \p msg and returns the reply.
+    template <class T>
+    std::shared_ptr<zmq::message_t> Send(
+            const T& msg, open3d::io::rpc::ConnectionBase& connection) {
+        using namespace open3d::io::rpc;
+        msgpack::sbuffer sbuf;
+        messages::Request request{msg.MsgId()};
+        msgpack::pack(sbuf, request);
+        msgpack::pack(sbuf, msg);
+
+        if (multipart_) {
+            std::vector<zmq::message_t> parts;
+            parts.emplace_back(sbuf.data(), sbuf.size());
+            for (const open3d::core::Tensor& tensor : frame_tensors_) {
+                parts.push_back(CreateTensorMessage(tensor));
+            }
+            return connection.SendMultipart(parts);
+        }
+        zmq::message_t send_msg(sbuf.data(), sbuf.size());
+        return connection.Send(send_msg);
+    }
+
+private:
+    bool multipart_;
+    std::vector<open3d::core::Tensor> tensors_;
+    std::vector<open3d::core::Tensor> frame_tensors_;
+};
+
+}  // namespace
+
 namespace open3d {
 namespace io {
 namespace rpc {
@@ -188,38 +341,23 @@ bool SetMeshData(const core::Tensor& vertices,
                 vertices.GetDtype().ToString());
     }
 
-    auto PrepareTensor = [](const core::Tensor& a) {
-        if (a.GetDevice().GetType() != core::Device::DeviceType::CPU) {
-            return a.Copy(core::Device("CPU:0"));
-        }
-        return a.Contiguous();
-    };
-
-    auto CreateArray = [](const core::Tensor& a) {
-        return DISPATCH_DTYPE_TO_TEMPLATE(a.GetDtype(), [&]() {
-            return messages::Array::FromPtr(
-                    (scalar_t*)a.GetDataPtr(),
-                    static_cast<std::vector<int64_t>>(a.GetShape()));
-        });
-    };
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    ArrayEncoder encoder(connection->IsMultipart());
 
     messages::SetMeshData msg;
     msg.path = path;
     msg.time = time;
     msg.layer = layer;
 
-    const core::Tensor vertices_ok = PrepareTensor(vertices);
-    msg.data.vertices = CreateArray(vertices_ok);
+    msg.data.vertices = encoder.Encode(vertices);
 
-    // store tensors in this vector to make sure the memory blob is alive
-    // for tensors where a deep copy was necessary.
-    std::vector<core::Tensor> tensor_cache;
     for (const auto& item : vertex_attributes) {
-        tensor_cache.push_back(PrepareTensor(item.second));
-        const core::Tensor& tensor = tensor_cache.back();
+        const core::Tensor& tensor = item.second;
         if (tensor.NumDims() >= 1 &&
             tensor.GetShape()[0] == vertices.GetShape()[0]) {
-            msg.data.vertex_attributes[item.first] = CreateArray(tensor);
+            msg.data.vertex_attributes[item.first] = encoder.Encode(tensor);
         } else {
             LogError("SetMeshData: Attribute {} has incompatible shape {}",
                      item.first, tensor.GetShape().ToString());
@@ -240,16 +378,14 @@ bool SetMeshData(const core::Tensor& vertices,
             LogError("SetMeshData: last dim of faces must be >=3 but is {}",
                      faces.GetShape()[1]);
         } else {
-            tensor_cache.push_back(PrepareTensor(faces));
-            const core::Tensor& faces_ok = tensor_cache.back();
-            msg.data.faces = CreateArray(faces_ok);
+            msg.data.faces = encoder.Encode(faces);
 
             for (const auto& item : face_attributes) {
-                tensor_cache.push_back(PrepareTensor(item.second));
-                const core::Tensor& tensor = tensor_cache.back();
+                const core::Tensor& tensor = item.second;
                 if (tensor.NumDims() >= 1 &&
                     tensor.GetShape()[0] == faces.GetShape()[0]) {
-                    msg.data.face_attributes[item.first] = CreateArray(tensor);
+                    msg.data.face_attributes[item.first] =
+                            encoder.Encode(tensor);
                 } else {
                     LogError(
                             "SetMeshData: Attribute {} has incompatible shape "
@@ -274,16 +410,14 @@ bool SetMeshData(const core::Tensor& vertices,
             LogError("SetMeshData: last dim of lines must be >=2 but is {}",
                      lines.GetShape()[1]);
         } else {
-            tensor_cache.push_back(PrepareTensor(lines));
-            const core::Tensor& lines_ok = tensor_cache.back();
-            msg.data.lines = CreateArray(lines_ok);
+            msg.data.lines = encoder.Encode(lines);
 
             for (const auto& item : line_attributes) {
-                tensor_cache.push_back(PrepareTensor(item.second));
-                const core::Tensor& tensor = tensor_cache.back();
+                const core::Tensor& tensor = item.second;
                 if (tensor.NumDims() >= 1 &&
                     tensor.GetShape()[0] == lines.GetShape()[0]) {
-                    msg.data.line_attributes[item.first] = CreateArray(tensor);
+                    msg.data.line_attributes[item.first] =
+                            encoder.Encode(tensor);
                 } else {
                     LogError(
                             "SetMeshData: Attribute {} has incompatible shape "
@@ -295,25 +429,81 @@ bool SetMeshData(const core::Tensor& vertices,
     }
 
     for (const auto& item : textures) {
-        tensor_cache.push_back(PrepareTensor(item.second));
-        const core::Tensor& tensor = tensor_cache.back();
+        const core::Tensor& tensor = item.second;
         if (tensor.NumElements()) {
-            msg.data.textures[item.first] = CreateArray(tensor);
+            msg.data.textures[item.first] = encoder.Encode(tensor);
         } else {
             LogError("SetMeshData: Texture {} is empty", item.first);
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
+    auto reply = encoder.Send(msg, *connection);
+    return ReplyIsOKStatus(*reply);
+}
+
+bool UpdateMeshData(
+        const core::Tensor& vertices,
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        int64_t vertex_offset,
+        bool quantize,
+        std::shared_ptr<ConnectionBase> connection) {
+    if (vertices.NumElements() == 0) {
+        LogInfo("UpdateMeshData: vertices Tensor is empty");
+        return false;
+    }
+    if (vertices.NumDims() != 2 || vertices.GetShape()[1] != 3) {
+        LogInfo("UpdateMeshData: vertices must have shape [N, 3] but have {}",
+                vertices.GetShape().ToString());
+        return false;
+    }
+    if (vertices.GetDtype() != core::Dtype::Float32 &&
+        vertices.GetDtype() != core::Dtype::Float64) {
+        LogError(
+                "UpdateMeshData: vertices must have dtype Float32 or Float64 "
+                "but is {}",
+                vertices.GetDtype().ToString());
+    }
 
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    ArrayEncoder encoder(connection->IsMultipart());
+
+    messages::UpdateMeshData msg;
+    msg.path = path;
+    msg.time = time;
+    msg.layer = layer;
+    msg.vertex_offset = vertex_offset;
+
+    // Positions are quantized relative to their bounding box and colors in
+    // [0, 1] to 8 bits.
+    if (quantize) {
+        msg.data.vertices =
+                encoder.EncodeQuantized(vertices, core::Dtype::UInt16, false);
+    } else {
+        msg.data.vertices = encoder.Encode(vertices);
+    }
+    for (const auto& item : vertex_attributes) {
+        const core::Tensor& tensor = item.second;
+        if (tensor.NumDims() < 1 ||
+            tensor.GetShape()[0] != vertices.GetShape()[0]) {
+            LogError("UpdateMeshData: Attribute {} has incompatible shape {}",
+                     item.first, tensor.GetShape().ToString());
+        }
+        if (quantize && item.first == "colors" && tensor.NumDims() == 2 &&
+            (tensor.GetDtype() == core::Dtype::Float32 ||
+             tensor.GetDtype() == core::Dtype::Float64)) {
+            msg.data.vertex_attributes[item.first] =
+                    encoder.EncodeQuantized(tensor, core::Dtype::UInt8, true);
+        } else {
+            msg.data.vertex_attributes[item.first] = encoder.Encode(tensor);
+        }
+    }
+
+    auto reply = encoder.Send(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -121,6 +121,8 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
 ///
 /// \param connection  The connection object used for sending the data.
 ///                    If nullptr a default connection object will be used.
+///                    If the connection is multipart, the tensors are sent
+///                    as separate message frames without copying.
 ///
 bool SetMeshData(const core::Tensor& vertices,
                  const std::string& path = "",
@@ -141,6 +143,43 @@ bool SetMeshData(const core::Tensor& vertices,
                  std::shared_ptr<ConnectionBase> connection =
                          std::shared_ptr<ConnectionBase>());
 
+/// Function for replacing or appending a range of vertices of the mesh data
+/// at \p path, e.g. to send the new points of a growing point cloud.
+///
+/// \param vertices           Tensor of shape [N,3] with the vertices of the
+/// range.
+///
+/// \param path               Path of the mesh data to update.
+///
+/// \param time               The time point associated with the object.
+///
+/// \param layer              The layer for this object.
+///
+/// \param vertex_attributes  Map with Tensors storing vertex attributes. The
+/// first dim of each attribute must be N.
+///
+/// \param vertex_offset      Index of the first vertex that is replaced.
+/// Vertices past the end of the existing data are appended. -1 appends all
+/// vertices.
+///
+/// \param quantize           If true, vertices are sent as 16 bit integers
+/// relative to their bounding box and float colors as 8 bit integers.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool UpdateMeshData(const core::Tensor& vertices,
+                    const std::string& path = "",
+                    int time = 0,
+                    const std::string& layer = "",
+                    const std::map<std::string, core::Tensor>&
+                            vertex_attributes =
+                                    std::map<std::string, core::Tensor>(),
+                    int64_t vertex_offset = -1,
+                    bool quantize = false,
+                    std::shared_ptr<ConnectionBase> connection =
+                            std::shared_ptr<ConnectionBase>());
+
 /// Function for sending Camera data.
 /// \param camera      The PinholeCameraParameters object.
 ///
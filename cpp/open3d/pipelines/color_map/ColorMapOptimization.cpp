@@ -26,6 +26,8 @@
 
 #include "open3d/pipelines/color_map/ColorMapOptimization.h"
 
+#include <algorithm>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -43,275 +45,452 @@ namespace open3d {
 namespace pipelines {
 namespace color_map {
 
-static void OptimizeImageCoorNonrigid(
-        const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dy,
-        std::vector<ImageWarpingField>& warping_fields,
-        const std::vector<ImageWarpingField>& warping_fields_init,
-        camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        const std::vector<std::vector<int>>& visibility_image_to_vertex,
-        std::vector<double>& proxy_intensity,
-        const ColorMapOptimizationOption& option) {
-    auto n_vertex = mesh.vertices_.size();
-    int n_camera = int(camera.parameters_.size());
-    SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                               visibility_vertex_to_image, proxy_intensity,
-                               option.image_boundary_margin_);
-    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
-        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        double residual_reg = 0.0;
-#pragma omp parallel for schedule(static)
-        for (int c = 0; c < n_camera; c++) {
-            int nonrigidval = warping_fields[c].anchor_w_ *
-                              warping_fields[c].anchor_h_ * 2;
-            double rr_reg = 0.0;
-
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
-
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
-
-            auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
-                                Eigen::Vector14i& pattern) {
-                jac.ComputeJacobianAndResidualNonRigid(
-                        i, J_r, r, pattern, mesh, proxy_intensity,
-                        images_gray[c], images_dx[c], images_dy[c],
-                        warping_fields[c], warping_fields_init[c], intr,
-                        extrinsic, visibility_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::MatrixXd JTJ;
-            Eigen::VectorXd JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            nonrigidval, false);
-
-            double weight = option.non_rigid_anchor_point_weight_ *
-                            visibility_image_to_vertex[c].size() / n_vertex;
-            for (int j = 0; j < nonrigidval; j++) {
-                double r = weight * (warping_fields[c].flow_(j) -
-                                     warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
-                JTr(6 + j) += weight * r;
-                rr_reg += r * r;
-            }
+/// Images derived from one RGBD frame that the optimization reads.
+struct ColorMapFrame {
+    std::shared_ptr<geometry::Image> gray_;
+    std::shared_ptr<geometry::Image> dx_;
+    std::shared_ptr<geometry::Image> dy_;
+    std::shared_ptr<geometry::Image> color_;
+};
 
-            bool success;
-            Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
-            Eigen::Vector6d result_pose;
-            result_pose << result.block(0, 0, 6, 1);
-            auto delta = utility::TransformVector6dToMatrix4d(result_pose);
-            pose = delta * pose;
-
-            for (int j = 0; j < nonrigidval; j++) {
-                warping_fields[c].flow_(j) += result(6 + j);
-            }
-            camera.parameters_[c].extrinsic_ = pose;
+static ColorMapFrame CreateFrame(const geometry::RGBDImage& rgbd) {
+    ColorMapFrame frame;
+    auto gray_image = rgbd.color_.CreateFloatImage();
+    frame.gray_ = gray_image->Filter(geometry::Image::FilterType::Gaussian3);
+    frame.dx_ = frame.gray_->Filter(geometry::Image::FilterType::Sobel3Dx);
+    frame.dy_ = frame.gray_->Filter(geometry::Image::FilterType::Sobel3Dy);
+    frame.color_ = std::make_shared<geometry::Image>(rgbd.color_);
+    return frame;
+}
+
+/// \class ColorMapFrameScheduler
+///
+/// Loads RGBD images in batches of at most maximum_resident_images and keeps
+/// the derived frames of one batch in memory at a time. If all images fit,
+/// the frames are created once and kept for all passes.
+class ColorMapFrameScheduler {
+public:
+    ColorMapFrameScheduler(const RGBDImageLoader& load_rgbd,
+                           int n_image,
+                           int maximum_resident_images)
+        : load_rgbd_(load_rgbd),
+          n_image_(n_image),
+          batch_size_(maximum_resident_images > 0 &&
+                                      maximum_resident_images < n_image
+                              ? maximum_resident_images
+                              : std::max(n_image, 1)),
+          frames_(n_image) {}
 
-#pragma omp critical
-            {
-                residual += r2;
-                residual_reg += rr_reg;
+public:
+    int NumBatches() const {
+        return (n_image_ + batch_size_ - 1) / batch_size_;
+    }
+
+    /// Makes the frames of batch \p batch_id resident and returns the range
+    /// of their image ids. \p on_load is called for every image that is
+    /// loaded, from multiple threads.
+    std::pair<int, int> LoadBatch(
+            int batch_id,
+            const std::function<void(int, const geometry::RGBDImage&)>&
+                    on_load = nullptr) {
+        int begin = batch_id * batch_size_;
+        int end = std::min(begin + batch_size_, n_image_);
+        // The loader is called sequentially, it need not be thread safe.
+        std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd(end -
+                                                                      begin);
+        for (int i = begin; i < end; i++) {
+            if (!frames_[i].gray_) {
+                images_rgbd[i - begin] = load_rgbd_(i);
+                if (!images_rgbd[i - begin]) {
+                    utility::LogError(
+                            "[ColorMapOptimization] Failed to load image {}.",
+                            i);
+                }
             }
         }
-        utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
-                          residual_reg);
-        SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                                   visibility_vertex_to_image, proxy_intensity,
-                                   option.image_boundary_margin_);
+#pragma omp parallel for schedule(dynamic)
+        for (int i = begin; i < end; i++) {
+            const auto& rgbd = images_rgbd[i - begin];
+            if (rgbd) {
+                frames_[i] = CreateFrame(*rgbd);
+                if (on_load) {
+                    on_load(i, *rgbd);
+                }
+            }
+        }
+        return std::make_pair(begin, end);
     }
-}
 
-static void OptimizeImageCoorRigid(
-        const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_dy,
-        camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        const std::vector<std::vector<int>>& visibility_image_to_vertex,
-        std::vector<double>& proxy_intensity,
-        const ColorMapOptimizationOption& option) {
-    int total_num_ = 0;
-    int n_camera = int(camera.parameters_.size());
-    SetProxyIntensityForVertex(mesh, images_gray, camera,
-                               visibility_vertex_to_image, proxy_intensity,
-                               option.image_boundary_margin_);
-    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
-        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        total_num_ = 0;
-#pragma omp parallel for schedule(static)
-        for (int c = 0; c < n_camera; c++) {
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
-
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
-
-            auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r,
-                                double& w) {
-                jac.ComputeJacobianAndResidualRigid(
-                        i, J_r, r, w, mesh, proxy_intensity, images_gray[c],
-                        images_dx[c], images_dy[c], intr, extrinsic,
-                        visibility_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::Matrix6d JTJ;
-            Eigen::Vector6d JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            false);
-
-            bool is_success;
-            Eigen::Matrix4d delta;
-            std::tie(is_success, delta) =
-                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
-                                                                         JTr);
-            pose = delta * pose;
-            camera.parameters_[c].extrinsic_ = pose;
-#pragma omp critical
-            {
-                residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
-            }
+    /// Frees the frames of batch \p batch_id unless all images are resident.
+    void ReleaseBatch(int batch_id) {
+        if (NumBatches() == 1) {
+            return;
+        }
+        int begin = batch_id * batch_size_;
+        int end = std::min(begin + batch_size_, n_image_);
+        for (int i = begin; i < end; i++) {
+            frames_[i] = ColorMapFrame();
+        }
+    }
+
+    const ColorMapFrame& GetFrame(int image_id) const {
+        return frames_[image_id];
+    }
+
+private:
+    const RGBDImageLoader& load_rgbd_;
+    int n_image_;
+    int batch_size_;
+    std::vector<ColorMapFrame> frames_;
+};
+
+/// Per vertex sums for averaging intensities or colors over images.
+template <typename T>
+struct VertexAverage {
+    explicit VertexAverage(size_t n_vertex, const T& zero)
+        : sum_(n_vertex, zero), count_(n_vertex, 0) {}
+    std::vector<T> sum_;
+    std::vector<int> count_;
+};
+
+static std::vector<double> GetProxyIntensity(
+        const VertexAverage<double>& average) {
+    std::vector<double> proxy_intensity(average.sum_.size(), 0.0);
+    for (size_t i = 0; i < proxy_intensity.size(); i++) {
+        if (average.count_[i] > 0) {
+            proxy_intensity[i] = average.sum_[i] / average.count_[i];
         }
-        utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
-                          residual / total_num_);
-        SetProxyIntensityForVertex(mesh, images_gray, camera,
-                                   visibility_vertex_to_image, proxy_intensity,
-                                   option.image_boundary_margin_);
+    }
+    return proxy_intensity;
+}
+
+/// Adds the intensity (or, if \p color is true, the color) of image \p c to
+/// \p average, with or without warping fields.
+static void AccumulateImage(const geometry::TriangleMesh& mesh,
+                            const ColorMapFrame& frame,
+                            const std::vector<ImageWarpingField>* warping_fields,
+                            const camera::PinholeCameraTrajectory& camera,
+                            int c,
+                            const std::vector<int>& visible_vertices,
+                            int image_boundary_margin,
+                            VertexAverage<double>& average) {
+    if (warping_fields) {
+        AccumulateProxyIntensityForImage(
+                mesh, *frame.gray_, (*warping_fields)[c], camera, c,
+                visible_vertices, image_boundary_margin, average.sum_,
+                average.count_);
+    } else {
+        AccumulateProxyIntensityForImage(
+                mesh, *frame.gray_, camera, c, visible_vertices,
+                image_boundary_margin, average.sum_, average.count_);
+    }
+}
+
+static void AccumulateImage(const geometry::TriangleMesh& mesh,
+                            const ColorMapFrame& frame,
+                            const std::vector<ImageWarpingField>* warping_fields,
+                            const camera::PinholeCameraTrajectory& camera,
+                            int c,
+                            const std::vector<int>& visible_vertices,
+                            int image_boundary_margin,
+                            VertexAverage<Eigen::Vector3d>& average) {
+    if (warping_fields) {
+        AccumulateGeometryColorForImage(
+                mesh, *frame.color_, (*warping_fields)[c], camera, c,
+                visible_vertices, image_boundary_margin, average.sum_,
+                average.count_);
+    } else {
+        AccumulateGeometryColorForImage(
+                mesh, *frame.color_, camera, c, visible_vertices,
+                image_boundary_margin, average.sum_, average.count_);
     }
 }
 
-static std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
-                  std::vector<std::shared_ptr<geometry::Image>>,
-                  std::vector<std::shared_ptr<geometry::Image>>,
-                  std::vector<std::shared_ptr<geometry::Image>>,
-                  std::vector<std::shared_ptr<geometry::Image>>>
-CreateGradientImages(
-        const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd) {
-    std::vector<std::shared_ptr<geometry::Image>> images_gray;
-    std::vector<std::shared_ptr<geometry::Image>> images_dx;
-    std::vector<std::shared_ptr<geometry::Image>> images_dy;
-    std::vector<std::shared_ptr<geometry::Image>> images_color;
-    std::vector<std::shared_ptr<geometry::Image>> images_depth;
-    for (size_t i = 0; i < images_rgbd.size(); i++) {
-        auto gray_image = images_rgbd[i]->color_.CreateFloatImage();
-        auto gray_image_filtered =
-                gray_image->Filter(geometry::Image::FilterType::Gaussian3);
-        images_gray.push_back(gray_image_filtered);
-        images_dx.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dx));
-        images_dy.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dy));
-        auto color = std::make_shared<geometry::Image>(images_rgbd[i]->color_);
-        auto depth = std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
-        images_color.push_back(color);
-        images_depth.push_back(depth);
+/// Streams all images once and averages their intensities or colors over the
+/// visible vertices. Images are added one after the other, each in parallel
+/// over its vertices, so no locking is needed and the result does not depend
+/// on the number of threads.
+template <typename T>
+static VertexAverage<T> AverageOverImages(
+        const geometry::TriangleMesh& mesh,
+        ColorMapFrameScheduler& scheduler,
+        const std::vector<VertexVisibility>& visibility,
+        const std::vector<ImageWarpingField>* warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        int image_boundary_margin,
+        const T& zero) {
+    VertexAverage<T> average(mesh.vertices_.size(), zero);
+    for (int b = 0; b < scheduler.NumBatches(); b++) {
+        int begin, end;
+        std::tie(begin, end) = scheduler.LoadBatch(b);
+        for (int c = begin; c < end; c++) {
+            AccumulateImage(mesh, scheduler.GetFrame(c), warping_fields,
+                            camera, c, visibility[c].GetVisibleVertices(),
+                            image_boundary_margin, average);
+        }
+        scheduler.ReleaseBatch(b);
     }
-    return std::make_tuple(images_gray, images_dx, images_dy, images_color,
-                           images_depth);
+    return average;
 }
 
-static std::vector<std::shared_ptr<geometry::Image>> CreateDepthBoundaryMasks(
-        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
+/// One Gauss-Newton step for the pose and warping field of camera \p c.
+/// Returns the residual and the regularization residual.
+static std::tuple<double, double> OptimizeImageNonRigid(
+        const geometry::TriangleMesh& mesh,
+        const ColorMapFrame& frame,
+        ImageWarpingField& warping_field,
+        const ImageWarpingField& warping_field_init,
+        camera::PinholeCameraParameters& parameters,
+        const std::vector<int>& visible_vertices,
+        const std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
-    auto n_images = images_depth.size();
-    std::vector<std::shared_ptr<geometry::Image>> masks;
-    for (size_t i = 0; i < n_images; i++) {
-        utility::LogDebug("[MakeDepthMasks] geometry::Image {:d}/{:d}", i,
-                          n_images);
-        masks.push_back(images_depth[i]->CreateDepthBoundaryMask(
-                option.depth_threshold_for_discontinuity_check_,
-                option.half_dilation_kernel_size_for_discontinuity_map_));
+    auto n_vertex = mesh.vertices_.size();
+    int nonrigidval = warping_field.anchor_w_ * warping_field.anchor_h_ * 2;
+    double rr_reg = 0.0;
+
+    Eigen::Matrix4d pose;
+    pose = parameters.extrinsic_;
+
+    auto intrinsic = parameters.intrinsic_.intrinsic_matrix_;
+    auto extrinsic = parameters.extrinsic_;
+    ColorMapOptimizationJacobian jac;
+    Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+    intr.block<3, 3>(0, 0) = intrinsic;
+    intr(3, 3) = 1.0;
+
+    auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
+                        Eigen::Vector14i& pattern) {
+        jac.ComputeJacobianAndResidualNonRigid(
+                i, J_r, r, pattern, mesh, proxy_intensity, frame.gray_,
+                frame.dx_, frame.dy_, warping_field, warping_field_init, intr,
+                extrinsic, visible_vertices, option.image_boundary_margin_);
+    };
+    Eigen::MatrixXd JTJ;
+    Eigen::VectorXd JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
+                                     Eigen::MatrixXd, Eigen::VectorXd>(
+                    f_lambda, int(visible_vertices.size()), nonrigidval,
+                    false);
+
+    double weight = option.non_rigid_anchor_point_weight_ *
+                    visible_vertices.size() / n_vertex;
+    for (int j = 0; j < nonrigidval; j++) {
+        double r = weight *
+                   (warping_field.flow_(j) - warping_field_init.flow_(j));
+        JTJ(6 + j, 6 + j) += weight * weight;
+        JTr(6 + j) += weight * r;
+        rr_reg += r * r;
+    }
+
+    bool success;
+    Eigen::VectorXd result;
+    std::tie(success, result) = utility::SolveLinearSystemPSD(
+            JTJ, -JTr, /*prefer_sparse=*/false,
+            /*check_symmetric=*/false,
+            /*check_det=*/false, /*check_psd=*/false);
+    Eigen::Vector6d result_pose;
+    result_pose << result.block(0, 0, 6, 1);
+    auto delta = utility::TransformVector6dToMatrix4d(result_pose);
+    pose = delta * pose;
+
+    for (int j = 0; j < nonrigidval; j++) {
+        warping_field.flow_(j) += result(6 + j);
     }
-    return masks;
+    parameters.extrinsic_ = pose;
+    return std::make_tuple(r2, rr_reg);
 }
 
-static std::vector<ImageWarpingField> CreateWarpingFields(
-        const std::vector<std::shared_ptr<geometry::Image>>& images,
+/// One Gauss-Newton step for the pose of camera \p c. Returns the residual.
+static double OptimizeImageRigid(const geometry::TriangleMesh& mesh,
+                                 const ColorMapFrame& frame,
+                                 camera::PinholeCameraParameters& parameters,
+                                 const std::vector<int>& visible_vertices,
+                                 const std::vector<double>& proxy_intensity,
+                                 const ColorMapOptimizationOption& option) {
+    Eigen::Matrix4d pose;
+    pose = parameters.extrinsic_;
+
+    auto intrinsic = parameters.intrinsic_.intrinsic_matrix_;
+    auto extrinsic = parameters.extrinsic_;
+    ColorMapOptimizationJacobian jac;
+    Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+    intr.block<3, 3>(0, 0) = intrinsic;
+    intr(3, 3) = 1.0;
+
+    auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r, double& w) {
+        jac.ComputeJacobianAndResidualRigid(
+                i, J_r, r, w, mesh, proxy_intensity, frame.gray_, frame.dx_,
+                frame.dy_, intr, extrinsic, visible_vertices,
+                option.image_boundary_margin_);
+    };
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                    f_lambda, int(visible_vertices.size()), false);
+
+    bool is_success;
+    Eigen::Matrix4d delta;
+    std::tie(is_success, delta) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    pose = delta * pose;
+    parameters.extrinsic_ = pose;
+    return r2;
+}
+
+/// Alternates between optimizing the cameras against the proxy intensity and
+/// recomputing the proxy intensity. Every iteration streams the images once:
+/// the cameras of a batch are optimized in parallel (one job per image), then
+/// their images are added to the proxy intensity of the next iteration with
+/// the updated poses. \p warping_fields is null for rigid optimization.
+static void OptimizeImageCoor(
+        const geometry::TriangleMesh& mesh,
+        ColorMapFrameScheduler& scheduler,
+        std::vector<ImageWarpingField>* warping_fields,
+        const std::vector<ImageWarpingField>* warping_fields_init,
+        camera::PinholeCameraTrajectory& camera,
+        const std::vector<VertexVisibility>& visibility,
         const ColorMapOptimizationOption& option) {
-    std::vector<ImageWarpingField> fields;
-    for (size_t i = 0; i < images.size(); i++) {
-        int width = images[i]->width_;
-        int height = images[i]->height_;
-        fields.push_back(ImageWarpingField(width, height,
-                                           option.number_of_vertical_anchors_));
+    int n_camera = int(camera.parameters_.size());
+    std::vector<double> proxy_intensity = GetProxyIntensity(AverageOverImages(
+            mesh, scheduler, visibility, warping_fields, camera,
+            option.image_boundary_margin_, 0.0));
+    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
+        const bool is_last = itr + 1 == option.maximum_iteration_;
+        // Residuals are stored per camera and summed in camera order.
+        std::vector<double> residuals(n_camera, 0.0);
+        std::vector<double> residuals_reg(n_camera, 0.0);
+        std::vector<int> n_visible(n_camera, 0);
+        VertexAverage<double> next_proxy(mesh.vertices_.size(), 0.0);
+        for (int b = 0; b < scheduler.NumBatches(); b++) {
+            int begin, end;
+            std::tie(begin, end) = scheduler.LoadBatch(b);
+            std::vector<std::vector<int>> visible_vertices(end - begin);
+#pragma omp parallel for schedule(dynamic)
+            for (int c = begin; c < end; c++) {
+                visible_vertices[c - begin] =
+                        visibility[c].GetVisibleVertices();
+                n_visible[c] = int(visible_vertices[c - begin].size());
+                if (warping_fields) {
+                    std::tie(residuals[c], residuals_reg[c]) =
+                            OptimizeImageNonRigid(
+                                    mesh, scheduler.GetFrame(c),
+                                    (*warping_fields)[c],
+                                    (*warping_fields_init)[c],
+                                    camera.parameters_[c],
+                                    visible_vertices[c - begin],
+                                    proxy_intensity, option);
+                } else {
+                    residuals[c] = OptimizeImageRigid(
+                            mesh, scheduler.GetFrame(c), camera.parameters_[c],
+                            visible_vertices[c - begin], proxy_intensity,
+                            option);
+                }
+            }
+            // The proxy intensity after the last iteration is not used.
+            if (!is_last) {
+                for (int c = begin; c < end; c++) {
+                    AccumulateImage(mesh, scheduler.GetFrame(c),
+                                    warping_fields, camera, c,
+                                    visible_vertices[c - begin],
+                                    option.image_boundary_margin_, next_proxy);
+                }
+            }
+            scheduler.ReleaseBatch(b);
+        }
+        double residual = 0.0;
+        double residual_reg = 0.0;
+        int total_num = 0;
+        for (int c = 0; c < n_camera; c++) {
+            residual += residuals[c];
+            residual_reg += residuals_reg[c];
+            total_num += n_visible[c];
+        }
+        if (warping_fields) {
+            utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}",
+                              residual, residual_reg);
+        } else {
+            utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})",
+                              residual, residual / total_num);
+        }
+        if (!is_last) {
+            proxy_intensity = GetProxyIntensity(next_proxy);
+        }
     }
-    return fields;
 }
 
 void ColorMapOptimization(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd,
+        const RGBDImageLoader& load_rgbd,
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option
         /* = ColorMapOptimizationOption()*/) {
     utility::LogDebug("[ColorMapOptimization]");
-    std::vector<std::shared_ptr<geometry::Image>> images_gray, images_dx,
-            images_dy, images_color, images_depth;
-    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
-            CreateGradientImages(images_rgbd);
-
-    utility::LogDebug("[ColorMapOptimization] :: MakingMasks");
-    auto images_mask = CreateDepthBoundaryMasks(images_depth, option);
+    int n_camera = int(camera.parameters_.size());
+    ColorMapFrameScheduler scheduler(load_rgbd, n_camera,
+                                     option.maximum_resident_images_);
 
+    // Depth images and their boundary masks are only needed for the
+    // visibility check, which runs while the first pass loads the images.
     utility::LogDebug("[ColorMapOptimization] :: VisibilityCheck");
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    std::vector<std::vector<int>> visibility_image_to_vertex;
-    std::tie(visibility_vertex_to_image, visibility_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    mesh, images_depth, images_mask, camera,
+    std::vector<VertexVisibility> visibility(n_camera);
+    std::vector<ImageWarpingField> warping_uv(n_camera);
+    for (int b = 0; b < scheduler.NumBatches(); b++) {
+        scheduler.LoadBatch(b, [&](int c, const geometry::RGBDImage& rgbd) {
+            if (option.non_rigid_camera_coordinate_) {
+                warping_uv[c] = ImageWarpingField(
+                        rgbd.color_.width_, rgbd.color_.height_,
+                        option.number_of_vertical_anchors_);
+            }
+            auto mask = rgbd.depth_.CreateDepthBoundaryMask(
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+            visibility[c] = CreateVertexVisibility(
+                    mesh, rgbd.depth_, *mask, camera, c,
                     option.maximum_allowable_depth_,
                     option.depth_threshold_for_visibility_check_);
+            utility::LogDebug("[cam {:d}]: {:d}/{:d} vertices are visible", c,
+                              visibility[c].Count(), mesh.vertices_.size());
+        });
+        scheduler.ReleaseBatch(b);
+    }
 
-    std::vector<double> proxy_intensity;
+    std::vector<ImageWarpingField> warping_uv_init = warping_uv;
+    std::vector<ImageWarpingField>* warping_fields = nullptr;
     if (option.non_rigid_camera_coordinate_) {
         utility::LogDebug("[ColorMapOptimization] :: Non-Rigid Optimization");
-        auto warping_uv_ = CreateWarpingFields(images_gray, option);
-        auto warping_uv_init_ = CreateWarpingFields(images_gray, option);
-        OptimizeImageCoorNonrigid(
-                mesh, images_gray, images_dx, images_dy, warping_uv_,
-                warping_uv_init_, camera, visibility_vertex_to_image,
-                visibility_image_to_vertex, proxy_intensity, option);
-        SetGeometryColorAverage(mesh, images_color, warping_uv_, camera,
-                                visibility_vertex_to_image,
-                                option.image_boundary_margin_,
-                                option.invisible_vertex_color_knn_);
+        warping_fields = &warping_uv;
     } else {
         utility::LogDebug("[ColorMapOptimization] :: Rigid Optimization");
-        OptimizeImageCoorRigid(mesh, images_gray, images_dx, images_dy, camera,
-                               visibility_vertex_to_image,
-                               visibility_image_to_vertex, proxy_intensity,
-                               option);
-        SetGeometryColorAverage(mesh, images_color, camera,
-                                visibility_vertex_to_image,
-                                option.image_boundary_margin_,
-                                option.invisible_vertex_color_knn_);
     }
+    OptimizeImageCoor(mesh, scheduler, warping_fields, &warping_uv_init,
+                      camera, visibility, option);
+
+    VertexAverage<Eigen::Vector3d> color = AverageOverImages(
+            mesh, scheduler, visibility, warping_fields, camera,
+            option.image_boundary_margin_, Eigen::Vector3d::Zero().eval());
+    SetGeometryColorFromSum(mesh, color.sum_, color.count_,
+                            option.invisible_vertex_color_knn_);
+}
+
+void ColorMapOptimization(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd,
+        camera::PinholeCameraTrajectory& camera,
+        const ColorMapOptimizationOption& option
+        /* = ColorMapOptimizationOption()*/) {
+    if (images_rgbd.size() != camera.parameters_.size()) {
+        utility::LogError(
+                "[ColorMapOptimization] {} images, but {} camera parameters.",
+                images_rgbd.size(), camera.parameters_.size());
+    }
+    ColorMapOptimization(
+            mesh, [&images_rgbd](int i) { return images_rgbd[i]; }, camera,
+            option);
 }
 
 }  // namespace color_map
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -55,7 +56,8 @@ public:
             double depth_threshold_for_discontinuity_check = 0.1,
             int half_dilation_kernel_size_for_discontinuity_map = 3,
             int image_boundary_margin = 10,
-            int invisible_vertex_color_knn = 3)
+            int invisible_vertex_color_knn = 3,
+            int maximum_resident_images = 0)
         : non_rigid_camera_coordinate_(non_rigid_camera_coordinate),
           number_of_vertical_anchors_(number_of_vertical_anchors),
           non_rigid_anchor_point_weight_(non_rigid_anchor_point_weight),
@@ -68,7 +70,8 @@ public:
           half_dilation_kernel_size_for_discontinuity_map_(
                   half_dilation_kernel_size_for_discontinuity_map),
           image_boundary_margin_(image_boundary_margin),
-          invisible_vertex_color_knn_(invisible_vertex_color_knn) {}
+          invisible_vertex_color_knn_(invisible_vertex_color_knn),
+          maximum_resident_images_(maximum_resident_images) {}
     ~ColorMapOptimizationOption() {}
 
 public:
@@ -123,8 +126,18 @@ public:
     ///  of the k nearest visible vertices to fill the invisible vertex. Set to
     ///  0 to disable this feature and all invisible vertices will be black.
     int invisible_vertex_color_knn_;
+    /// Maximum number of images kept in memory at a time. Images are loaded
+    /// and processed in batches of this size, and are loaded again in every
+    /// iteration if they do not all fit. Set to 0 to keep all images in
+    /// memory.
+    int maximum_resident_images_;
 };
 
+/// Returns the RGBD image seen by camera \p i. It is called from one thread at
+/// a time.
+using RGBDImageLoader =
+        std::function<std::shared_ptr<geometry::RGBDImage>(int i)>;
+
 /// \brief Function for color mapping of reconstructed scenes via optimization.
 ///
 /// This is implementation of following paper
@@ -144,6 +157,22 @@ void ColorMapOptimization(
         const ColorMapOptimizationOption& option =
                 ColorMapOptimizationOption());
 
+/// \brief Function for color mapping of reconstructed scenes via optimization,
+/// loading the RGBD images on demand.
+///
+/// Only option.maximum_resident_images_ images are kept in memory at a time,
+/// so sequences that do not fit into memory can be processed.
+///
+/// \param mesh The input geometry mesh.
+/// \param load_rgbd Loads the RGBD image of a camera.
+/// \param camera Cameras' parameters.
+/// \param option Color map optimization options.
+void ColorMapOptimization(geometry::TriangleMesh& mesh,
+                          const RGBDImageLoader& load_rgbd,
+                          camera::PinholeCameraTrajectory& camera,
+                          const ColorMapOptimizationOption& option =
+                                  ColorMapOptimizationOption());
+
 }  // namespace color_map
 }  // namespace pipelines
 }  // namespace open3d
@@ -26,7 +26,10 @@
 
 #include "open3d/pipelines/color_map/EigenHelperForNonRigidOptimization.h"
 
+#include <vector>
+
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -41,18 +44,22 @@ std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
         int iteration_num,
         int nonrigidval,
         bool verbose /*=true*/) {
-    MatOutType JTJ(6 + nonrigidval, 6 + nonrigidval);
-    VecOutType JTr(6 + nonrigidval);
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#pragma omp parallel
+    // Per-thread slots, reduced in thread order after the parallel region.
+    // Called from the parallel loop over cameras, the region runs single
+    // threaded and one (6 + nonrigidval)^2 slot per camera job is enough.
+    const int num_threads =
+            utility::InParallel() ? 1 : utility::GetMaxThreads();
+    std::vector<MatOutType> JTJ_private(
+            num_threads, MatOutType::Zero(6 + nonrigidval, 6 + nonrigidval));
+    std::vector<VecOutType> JTr_private(num_threads,
+                                        VecOutType::Zero(6 + nonrigidval));
+    std::vector<double> r2_sum_private(num_threads, 0.0);
+#pragma omp parallel num_threads(num_threads)
     {
-        MatOutType JTJ_private(6 + nonrigidval, 6 + nonrigidval);
-        VecOutType JTr_private(6 + nonrigidval);
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
+        const int thread_id = utility::GetThreadNum();
+        MatOutType &JTJ_thread = JTJ_private[thread_id];
+        VecOutType &JTr_thread = JTr_private[thread_id];
+        double r2_sum_thread = 0.0;
         VecInTypeDouble J_r;
         VecInTypeInt pattern;
         double r;
@@ -62,20 +69,23 @@ std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
             f(i, J_r, r, pattern);
             for (auto x = 0; x < J_r.size(); x++) {
                 for (auto y = 0; y < J_r.size(); y++) {
-                    JTJ_private(pattern(x), pattern(y)) += J_r(x) * J_r(y);
+                    JTJ_thread(pattern(x), pattern(y)) += J_r(x) * J_r(y);
                 }
             }
             for (auto x = 0; x < J_r.size(); x++) {
-                JTr_private(pattern(x)) += r * J_r(x);
+                JTr_thread(pattern(x)) += r * J_r(x);
             }
-            r2_sum_private += r * r;
-        }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
+            r2_sum_thread += r * r;
         }
+        r2_sum_private[thread_id] = r2_sum_thread;
+    }
+    MatOutType JTJ = MatOutType::Zero(6 + nonrigidval, 6 + nonrigidval);
+    VecOutType JTr = VecOutType::Zero(6 + nonrigidval);
+    double r2_sum = 0.0;
+    for (int i = 0; i < num_threads; i++) {
+        JTJ += JTJ_private[i];
+        JTr += JTr_private[i];
+        r2_sum += r2_sum_private[i];
     }
     if (verbose) {
         utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
@@ -26,6 +26,8 @@
 
 #include "open3d/pipelines/color_map/TriangleMeshAndImageUtilities.h"
 
+#include <bitset>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -53,6 +55,67 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
     return std::make_tuple(u, v, z);
 }
 
+size_t VertexVisibility::Count() const {
+    size_t count = 0;
+    for (const uint64_t& word : words_) {
+        count += std::bitset<64>(word).count();
+    }
+    return count;
+}
+
+std::vector<int> VertexVisibility::GetVisibleVertices() const {
+    std::vector<int> vertices;
+    vertices.reserve(Count());
+    for (size_t w = 0; w < words_.size(); w++) {
+        uint64_t word = words_[w];
+        for (int b = 0; word != 0; b++, word >>= 1) {
+            if (word & 1) {
+                vertices.push_back(int(w * 64 + b));
+            }
+        }
+    }
+    return vertices;
+}
+
+VertexVisibility CreateVertexVisibility(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    size_t n_vertex = mesh.vertices_.size();
+    VertexVisibility visibility(n_vertex);
+    for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+        Eigen::Vector3d X = mesh.vertices_[vertex_id];
+        float u, v, d;
+        std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera, camid);
+        int u_d = int(round(u)), v_d = int(round(v));
+        // Skip if vertex in image boundary.
+        if (d < 0.0 || !image_depth.TestImageBoundary(u_d, v_d)) {
+            continue;
+        }
+        // Skip if vertex's depth is too large (e.g. background).
+        float d_sensor = *image_depth.PointerAt<float>(u_d, v_d);
+        if (d_sensor > maximum_allowable_depth) {
+            continue;
+        }
+        // Check depth boundary mask. If a vertex is located at the boundary
+        // of an object, its color will be highly diverse from different
+        // viewing angles.
+        if (*image_mask.PointerAt<unsigned char>(u_d, v_d) == 255) {
+            continue;
+        }
+        // Check depth errors.
+        if (std::fabs(d - d_sensor) >= depth_threshold_for_visibility_check) {
+            continue;
+        }
+        visibility.Set(vertex_id);
+    }
+    return visibility;
+}
+
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -70,40 +133,19 @@ CreateVertexAndImageVisibility(
     std::vector<std::vector<int>> visibility_vertex_to_image;
     visibility_vertex_to_image.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(dynamic)
     for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
-            float u, v, d;
-            std::tie(u, v, d) =
-                    Project3DPointAndGetUVDepth(X, camera, camera_id);
-            int u_d = int(round(u)), v_d = int(round(v));
-            // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id]->TestImageBoundary(u_d, v_d)) {
-                continue;
-            }
-            // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id]->PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) {
-                continue;
-            }
-            // Check depth boundary mask. If a vertex is located at the boundary
-            // of an object, its color will be highly diverse from different
-            // viewing angles.
-            if (*images_mask[camera_id]->PointerAt<unsigned char>(u_d, v_d) ==
-                255) {
-                continue;
-            }
-            // Check depth errors.
-            if (std::fabs(d - d_sensor) >=
-                depth_threshold_for_visibility_check) {
-                continue;
-            }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+        visibility_image_to_vertex[camera_id] =
+                CreateVertexVisibility(mesh, *images_depth[camera_id],
+                                       *images_mask[camera_id], camera,
+                                       camera_id, maximum_allowable_depth,
+                                       depth_threshold_for_visibility_check)
+                        .GetVisibleVertices();
+    }
+    // Inverting in camera order keeps every list sorted without locking.
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
         }
     }
 
@@ -239,52 +281,132 @@ void SetProxyIntensityForVertex(
     }
 }
 
-void SetGeometryColorAverage(
-        geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+void AccumulateProxyIntensityForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_gray,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        int image_boundary_margin /*= 10*/,
-        int invisible_vertex_color_knn /*= 3*/) {
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<double>& intensity_sum,
+        std::vector<int>& count) {
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(visible_vertices.size()); k++) {
+        int i = visible_vertices[k];
+        float gray;
+        bool valid = false;
+        std::tie(valid, gray) = QueryImageIntensity<float>(
+                image_gray, mesh.vertices_[i], camera, camid, -1,
+                image_boundary_margin);
+        if (valid) {
+            intensity_sum[i] += gray;
+            count[i]++;
+        }
+    }
+}
+
+void AccumulateProxyIntensityForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_gray,
+        const ImageWarpingField& warping_field,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<double>& intensity_sum,
+        std::vector<int>& count) {
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(visible_vertices.size()); k++) {
+        int i = visible_vertices[k];
+        float gray;
+        bool valid = false;
+        std::tie(valid, gray) = QueryImageIntensity<float>(
+                image_gray, warping_field, mesh.vertices_[i], camera, camid,
+                -1, image_boundary_margin);
+        if (valid) {
+            intensity_sum[i] += gray;
+            count[i]++;
+        }
+    }
+}
+
+void AccumulateGeometryColorForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_color,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<Eigen::Vector3d>& color_sum,
+        std::vector<int>& count) {
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(visible_vertices.size()); k++) {
+        int i = visible_vertices[k];
+        unsigned char r_temp, g_temp, b_temp;
+        bool valid = false;
+        std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
+                image_color, mesh.vertices_[i], camera, camid, 0,
+                image_boundary_margin);
+        std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
+                image_color, mesh.vertices_[i], camera, camid, 1,
+                image_boundary_margin);
+        std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
+                image_color, mesh.vertices_[i], camera, camid, 2,
+                image_boundary_margin);
+        if (valid) {
+            color_sum[i] += Eigen::Vector3d(r_temp, g_temp, b_temp) / 255.0;
+            count[i]++;
+        }
+    }
+}
+
+void AccumulateGeometryColorForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_color,
+        const ImageWarpingField& warping_field,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<Eigen::Vector3d>& color_sum,
+        std::vector<int>& count) {
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(visible_vertices.size()); k++) {
+        int i = visible_vertices[k];
+        unsigned char r_temp, g_temp, b_temp;
+        bool valid = false;
+        std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
+                image_color, warping_field, mesh.vertices_[i], camera, camid,
+                0, image_boundary_margin);
+        std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
+                image_color, warping_field, mesh.vertices_[i], camera, camid,
+                1, image_boundary_margin);
+        std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
+                image_color, warping_field, mesh.vertices_[i], camera, camid,
+                2, image_boundary_margin);
+        if (valid) {
+            color_sum[i] += Eigen::Vector3d(r_temp, g_temp, b_temp) / 255.0;
+            count[i]++;
+        }
+    }
+}
+
+void SetGeometryColorFromSum(geometry::TriangleMesh& mesh,
+                             const std::vector<Eigen::Vector3d>& color_sum,
+                             const std::vector<int>& count,
+                             int invisible_vertex_color_knn /*= 3*/) {
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
     mesh.vertex_colors_.resize(n_vertex);
     std::vector<size_t> valid_vertices;
     std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 0,
-                    image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 1,
-                    image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 2,
-                    image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (count[i] > 0) {
+            mesh.vertex_colors_[i] = color_sum[i] / double(count[i]);
+            valid_vertices.push_back(i);
+        } else {
+            mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
@@ -310,76 +432,62 @@ void SetGeometryColorAverage(
     }
 }
 
+/// Inverts the per vertex visibility lists into per image lists.
+static std::vector<std::vector<int>> InvertVisibility(
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        size_t n_image) {
+    std::vector<std::vector<int>> visibility_image_to_vertex(n_image);
+    for (size_t i = 0; i < visibility_vertex_to_image.size(); i++) {
+        for (int j : visibility_vertex_to_image[i]) {
+            visibility_image_to_vertex[j].push_back(int(i));
+        }
+    }
+    return visibility_image_to_vertex;
+}
+
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_color,
-        const std::vector<ImageWarpingField>& warping_fields,
         const camera::PinholeCameraTrajectory& camera,
         const std::vector<std::vector<int>>& visibility_vertex_to_image,
         int image_boundary_margin /*= 10*/,
         int invisible_vertex_color_knn /*= 3*/) {
     size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 0, image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 1, image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 2, image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
-        }
+    std::vector<std::vector<int>> visibility_image_to_vertex =
+            InvertVisibility(visibility_vertex_to_image, images_color.size());
+    std::vector<Eigen::Vector3d> color_sum(n_vertex, Eigen::Vector3d::Zero());
+    std::vector<int> count(n_vertex, 0);
+    for (size_t j = 0; j < images_color.size(); j++) {
+        AccumulateGeometryColorForImage(mesh, *images_color[j], camera, int(j),
+                                        visibility_image_to_vertex[j],
+                                        image_boundary_margin, color_sum,
+                                        count);
     }
-    if (invisible_vertex_color_knn > 0) {
-        std::shared_ptr<geometry::TriangleMesh> valid_mesh =
-                mesh.SelectByIndex(valid_vertices);
-        geometry::KDTreeFlann kd_tree(*valid_mesh);
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
-            size_t invalid_vertex = invalid_vertices[i];
-            std::vector<int> indices;  // indices to valid_mesh
-            std::vector<double> dists;
-            kd_tree.SearchKNN(mesh.vertices_[invalid_vertex],
-                              invisible_vertex_color_knn, indices, dists);
-            Eigen::Vector3d new_color(0, 0, 0);
-            for (const int& index : indices) {
-                new_color += valid_mesh->vertex_colors_[index];
-            }
-            if (indices.size() > 0) {
-                new_color /= static_cast<double>(indices.size());
-            }
-            mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
+    SetGeometryColorFromSum(mesh, color_sum, count,
+                            invisible_vertex_color_knn);
+}
+
+void SetGeometryColorAverage(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const std::vector<ImageWarpingField>& warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int image_boundary_margin /*= 10*/,
+        int invisible_vertex_color_knn /*= 3*/) {
+    size_t n_vertex = mesh.vertices_.size();
+    std::vector<std::vector<int>> visibility_image_to_vertex =
+            InvertVisibility(visibility_vertex_to_image, images_color.size());
+    std::vector<Eigen::Vector3d> color_sum(n_vertex, Eigen::Vector3d::Zero());
+    std::vector<int> count(n_vertex, 0);
+    for (size_t j = 0; j < images_color.size(); j++) {
+        AccumulateGeometryColorForImage(
+                mesh, *images_color[j], warping_fields[j], camera, int(j),
+                visibility_image_to_vertex[j], image_boundary_margin,
+                color_sum, count);
     }
+    SetGeometryColorFromSum(mesh, color_sum, count,
+                            invisible_vertex_color_knn);
 }
 
 }  // namespace color_map
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -42,6 +43,33 @@ namespace color_map {
 class ImageWarpingField;
 class ColorMapOptimizationOption;
 
+/// \class VertexVisibility
+///
+/// \brief Compact set of the mesh vertices visible in one image, one bit per
+/// vertex.
+class VertexVisibility {
+public:
+    VertexVisibility(size_t n_vertex = 0)
+        : words_((n_vertex + 63) / 64, 0), n_vertex_(n_vertex) {}
+
+public:
+    void Set(size_t vertex_id) {
+        words_[vertex_id / 64] |= uint64_t(1) << (vertex_id % 64);
+    }
+    bool Test(size_t vertex_id) const {
+        return (words_[vertex_id / 64] >> (vertex_id % 64)) & 1;
+    }
+    size_t NumVertices() const { return n_vertex_; }
+    /// Number of visible vertices.
+    size_t Count() const;
+    /// Ids of the visible vertices in increasing order.
+    std::vector<int> GetVisibleVertices() const;
+
+private:
+    std::vector<uint64_t> words_;
+    size_t n_vertex_;
+};
+
 inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
         const Eigen::Vector3d X,
         const camera::PinholeCameraTrajectory& camera,
@@ -56,6 +84,16 @@ CreateVertexAndImageVisibility(
         double maximum_allowable_depth,
         double depth_threshold_for_visibility_check);
 
+/// Vertices of \p mesh visible in the depth image of camera \p camid.
+VertexVisibility CreateVertexVisibility(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check);
+
 template <typename T>
 std::tuple<bool, T> QueryImageIntensity(
         const geometry::Image& img,
@@ -92,6 +130,62 @@ void SetProxyIntensityForVertex(
         std::vector<double>& proxy_intensity,
         int image_boundary_margin);
 
+/// Adds the intensities of image \p camid to \p intensity_sum and increments
+/// \p count for the vertices in \p visible_vertices that project inside the
+/// image. Every vertex is touched at most once, so the vertices are processed
+/// in parallel without locking.
+void AccumulateProxyIntensityForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_gray,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<double>& intensity_sum,
+        std::vector<int>& count);
+
+void AccumulateProxyIntensityForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_gray,
+        const ImageWarpingField& warping_field,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<double>& intensity_sum,
+        std::vector<int>& count);
+
+/// Adds the colors of image \p camid to \p color_sum, like
+/// AccumulateProxyIntensityForImage.
+void AccumulateGeometryColorForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_color,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<Eigen::Vector3d>& color_sum,
+        std::vector<int>& count);
+
+void AccumulateGeometryColorForImage(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_color,
+        const ImageWarpingField& warping_field,
+        const camera::PinholeCameraTrajectory& camera,
+        int camid,
+        const std::vector<int>& visible_vertices,
+        int image_boundary_margin,
+        std::vector<Eigen::Vector3d>& color_sum,
+        std::vector<int>& count);
+
+/// Sets the vertex colors of \p mesh to the accumulated averages. Vertices
+/// that are not visible in any image get the average color of their
+/// \p invisible_vertex_color_knn nearest visible vertices.
+void SetGeometryColorFromSum(geometry::TriangleMesh& mesh,
+                             const std::vector<Eigen::Vector3d>& color_sum,
+                             const std::vector<int>& count,
+                             int invisible_vertex_color_knn = 3);
+
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
@@ -33,90 +33,13 @@
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<std::shared_ptr<geometry::Image>,
-                  std::shared_ptr<geometry::Image>>
-InitializeCorrespondenceMap(int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    auto correspondence_map = std::make_shared<geometry::Image>();
-    auto depth_buffer = std::make_shared<geometry::Image>();
-    correspondence_map->Prepare(width, height, 2, 4);
-    depth_buffer->Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map->height_; v++) {
-        for (int u = 0; u < correspondence_map->width_; u++) {
-            *correspondence_map->PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map->PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer->PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
-
 static std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
         const Eigen::Matrix3d intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
@@ -129,63 +52,55 @@ static std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    std::shared_ptr<geometry::Image> correspondence_map;
-    std::shared_ptr<geometry::Image> depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        std::shared_ptr<geometry::Image> correspondence_map_private;
-        std::shared_ptr<geometry::Image> depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    *correspondence_map_private,
-                                    *depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
+    // Every source pixel has at most one correspondence, so the rows can be
+    // matched independently. The correspondences of each row are counted
+    // first and then written to their offset in the output, which keeps the
+    // row-major order without any synchronization between threads.
+    const int width = depth_s.width_;
+    const int height = depth_s.height_;
+    std::vector<int> target_index(size_t(width) * height, -1);
+    std::vector<int> row_offset(height + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (int v_s = 0; v_s < height; v_s++) {
+        int row_count = 0;
+        for (int u_s = 0; u_s < width; u_s++) {
+            double d_s = *depth_s.PointerAt<float>(u_s, v_s);
+            if (!std::isnan(d_s)) {
+                Eigen::Vector3d uv_in_s =
+                        d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
+                double transformed_d_s = uv_in_s(2);
+                int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+                int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+                if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                    v_t < depth_t.height_) {
+                    double d_t = *depth_t.PointerAt<float>(u_t, v_t);
+                    if (!std::isnan(d_t) &&
+                        std::abs(transformed_d_s - d_t) <=
+                                option.max_depth_diff_) {
+                        target_index[size_t(v_s) * width + u_s] =
+                                v_t * depth_t.width_ + u_t;
+                        row_count++;
                     }
                 }
             }
         }
-#pragma omp critical
-        {
-            MergeCorrespondenceMaps(*correspondence_map, *depth_buffer,
-                                    *correspondence_map_private,
-                                    *depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
+        row_offset[v_s + 1] = row_count;
+    }
+    for (int v_s = 0; v_s < height; v_s++) {
+        row_offset[v_s + 1] += row_offset[v_s];
+    }
 
     auto correspondence = std::make_shared<CorrespondenceSetPixelWise>();
-    int correspondence_count = CountCorrespondence(*correspondence_map);
-    correspondence->resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map->height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map->width_; u_s++) {
-            int u_t = *correspondence_map->PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map->PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                (*correspondence)[cnt] = pixel_correspondence;
-                cnt++;
+    correspondence->resize(row_offset[height]);
+#pragma omp parallel for schedule(static)
+    for (int v_s = 0; v_s < height; v_s++) {
+        int cnt = row_offset[v_s];
+        for (int u_s = 0; u_s < width; u_s++) {
+            int idx_t = target_index[size_t(v_s) * width + u_s];
+            if (idx_t != -1) {
+                (*correspondence)[cnt++] =
+                        Eigen::Vector4i(u_s, v_s, idx_t % depth_t.width_,
+                                        idx_t / depth_t.width_);
             }
         }
     }
@@ -205,6 +120,7 @@ static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
     const double oy = intrinsic_matrix(1, 2);
     image_xyz->Prepare(depth.width_, depth.height_, 3, 4);
 
+#pragma omp parallel for schedule(static)
     for (int y = 0; y < image_xyz->height_; y++) {
         for (int x = 0; x < image_xyz->width_; x++) {
             float *px = image_xyz->PointerAt<float>(x, y, 0);
@@ -238,63 +154,65 @@ static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
 
 static Eigen::Matrix6d CreateInformationMatrix(
         const Eigen::Matrix4d &extrinsic,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix3d &intrinsic_matrix,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
-    auto correspondence =
-            ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
-
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    auto correspondence = ComputeCorrespondence(intrinsic_matrix, extrinsic,
+                                                depth_s, depth_t, option);
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
-#pragma omp parallel
+    const int num_threads = utility::GetMaxThreads();
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> GTG_private(
+            num_threads, Eigen::Matrix6d::Zero());
+#pragma omp parallel num_threads(num_threads)
     {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
+        Eigen::Matrix6d &GTG_thread = GTG_private[utility::GetThreadNum()];
         Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
 #pragma omp for nowait
         for (int row = 0; row < int(correspondence->size()); row++) {
             int u_t = (*correspondence)[row](2);
             int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
             G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            GTG_thread.noalias() += G_r_private * G_r_private.transpose();
             G_r_private.setZero();
             G_r_private(0) = -z;
             G_r_private(2) = x;
             G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            GTG_thread.noalias() += G_r_private * G_r_private.transpose();
             G_r_private.setZero();
             G_r_private(0) = y;
             G_r_private(1) = -x;
             G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            GTG_thread.noalias() += G_r_private * G_r_private.transpose();
         }
-#pragma omp critical
-        { GTG += GTG_private; }
+    }
+    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
+    for (const Eigen::Matrix6d &GTG_thread : GTG_private) {
+        GTG += GTG_thread;
     }
     return GTG;
 }
 
-static void NormalizeIntensity(geometry::Image &image_s,
-                               geometry::Image &image_t,
-                               CorrespondenceSetPixelWise &correspondence) {
-    if (image_s.width_ != image_t.width_ ||
-        image_s.height_ != image_t.height_) {
-        utility::LogError(
-                "[NormalizeIntensity] Size of two input images should be "
-                "same");
+static void NormalizeIntensity(
+        RGBDOdometryFrame &source,
+        RGBDOdometryFrame &target,
+        const CorrespondenceSetPixelWise &correspondence) {
+    if (correspondence.empty()) {
+        utility::LogDebug("[NormalizeIntensity] No correspondence.");
+        return;
     }
+    const geometry::Image &image_s = source.pyramid_[0]->color_;
+    const geometry::Image &image_t = target.pyramid_[0]->color_;
     double mean_s = 0.0, mean_t = 0.0;
     for (size_t row = 0; row < correspondence.size(); row++) {
         int u_s = correspondence[row](0);
@@ -304,16 +222,11 @@ static void NormalizeIntensity(geometry::Image &image_s,
         mean_s += *image_s.PointerAt<float>(u_s, v_s);
         mean_t += *image_t.PointerAt<float>(u_t, v_t);
     }
-    mean_s /= (double)correspondence.size();
-    mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
-}
-
-static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
-        const geometry::Image &color, const geometry::Image &depth) {
-    return std::make_shared<geometry::RGBDImage>(
-            geometry::RGBDImage(color, depth));
+    // Means of the unscaled intensities.
+    mean_s /= (double)correspondence.size() * source.intensity_scale_;
+    mean_t /= (double)correspondence.size() * target.intensity_scale_;
+    source.SetIntensityScale(0.5 / mean_s);
+    target.SetIntensityScale(0.5 / mean_t);
 }
 
 static std::shared_ptr<geometry::Image> PreprocessDepth(
@@ -321,6 +234,7 @@ static std::shared_ptr<geometry::Image> PreprocessDepth(
     std::shared_ptr<geometry::Image> depth_processed =
             std::make_shared<geometry::Image>();
     *depth_processed = depth_orig;
+#pragma omp parallel for schedule(static)
     for (int y = 0; y < depth_processed->height_; y++) {
         for (int x = 0; x < depth_processed->width_; x++) {
             float *p = depth_processed->PointerAt<float>(x, y);
@@ -341,77 +255,80 @@ static inline bool IsColorImageRGB(const geometry::Image &image) {
     return (image.num_of_channels_ == 3);
 }
 
+static inline bool CheckRGBDImage(const geometry::RGBDImage &image) {
+    return CheckImagePair(image.color_, image.depth_) &&
+           image.depth_.num_of_channels_ == 1 &&
+           image.depth_.bytes_per_channel_ == 4 &&
+           ((image.color_.num_of_channels_ == 3 &&
+             image.color_.bytes_per_channel_ == 1) ||
+            (image.color_.num_of_channels_ == 1 &&
+             image.color_.bytes_per_channel_ == 4));
+}
+
 static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
                                       const geometry::RGBDImage &target) {
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 3 &&
-                target.color_.num_of_channels_ == 3 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 1 &&
-                target.color_.bytes_per_channel_ == 1 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
-    }
-    if (!IsColorImageRGB(source.color_) && !IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 1 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.color_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 4 &&
-                target.color_.bytes_per_channel_ == 4 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
-    }
-    return false;
+    return CheckRGBDImage(source) && CheckRGBDImage(target) &&
+           CheckImagePair(source.color_, target.color_) &&
+           IsColorImageRGB(source.color_) == IsColorImageRGB(target.color_);
 }
 
-static std::tuple<std::shared_ptr<geometry::RGBDImage>,
-                  std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
+static inline bool CheckRGBDOdometryFramePair(
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
         const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
+    const int num_levels =
+            (int)option.iteration_number_per_pyramid_level_.size();
+    return !source.IsEmpty() && !target.IsEmpty() &&
+           source.NumLevels() == num_levels &&
+           target.NumLevels() == num_levels &&
+           CheckImagePair(source.pyramid_[0]->depth_,
+                          target.pyramid_[0]->depth_);
+}
+
+RGBDOdometryFrame::RGBDOdometryFrame(
+        const geometry::RGBDImage &rgbd_image,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (!CheckRGBDImage(rgbd_image)) {
+        utility::LogError("[RGBDOdometryFrame] Unsupported image format.");
+    }
+    std::shared_ptr<geometry::Image> color;
+    if (IsColorImageRGB(rgbd_image.color_)) {
+        color = rgbd_image.color_.CreateFloatImage();
     } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
+        color = std::make_shared<geometry::Image>(rgbd_image.color_);
     }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth = PreprocessDepth(rgbd_image.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+
+    const int num_levels =
+            (int)option.iteration_number_per_pyramid_level_.size();
+    pyramid_ = geometry::RGBDImage(*gray, *depth).CreatePyramid(num_levels);
+    pyramid_dx_ = geometry::RGBDImage::FilterPyramid(
+            pyramid_, geometry::Image::FilterType::Sobel3Dx);
+    pyramid_dy_ = geometry::RGBDImage::FilterPyramid(
+            pyramid_, geometry::Image::FilterType::Sobel3Dy);
+    camera_matrix_pyramid_ =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+    xyz_pyramid_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        xyz_pyramid_[level] = ConvertDepthImageToXYZImage(
+                pyramid_[level]->depth_, camera_matrix_pyramid_[level]);
+    }
+    intensity_scale_ = 1.0;
+}
 
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
+void RGBDOdometryFrame::SetIntensityScale(double scale) {
+    // Filtering and downsampling are linear in the intensity, so the
+    // pyramids can be rescaled instead of being rebuilt.
+    const double factor = scale / intensity_scale_;
+    for (int level = 0; level < NumLevels(); level++) {
+        pyramid_[level]->color_.LinearTransform(factor, 0.0);
+        pyramid_dx_[level]->color_.LinearTransform(factor, 0.0);
+        pyramid_dy_[level]->color_.LinearTransform(factor, 0.0);
+    }
+    intensity_scale_ = scale;
 }
 
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -460,51 +377,32 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        RGBDOdometryTiming *timing) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
+        utility::Timer timer;
+        timer.Start();
         const Eigen::Matrix3d level_camera_matrix =
-                pyramid_camera_matrix[level];
-
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
+                source.camera_matrix_pyramid_[level];
 
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
+                    iter, level, *source.pyramid_[level],
+                    *target.pyramid_[level], *source.xyz_pyramid_[level],
+                    *target.pyramid_dx_[level], *target.pyramid_dy_[level],
                     level_camera_matrix, result_odo, jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
@@ -513,41 +411,65 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
                 return std::make_tuple(false, Eigen::Matrix4d::Identity());
             }
         }
+        timer.Stop();
+        utility::LogDebug("Level {:d} took {:.2f} ms", level,
+                          timer.GetDuration());
+        if (timing != nullptr) {
+            timing->level_ms_[level] = timer.GetDuration();
+        }
     }
     return std::make_tuple(true, result_odo);
 }
 
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
-        /*= camera::PinholeCameraIntrinsic()*/,
+        RGBDOdometryFrame &source,
+        RGBDOdometryFrame &target,
         const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
-        const OdometryOption &option /*= OdometryOption()*/) {
-    if (!CheckRGBDImagePair(source, target)) {
+        const OdometryOption &option /*= OdometryOption()*/,
+        RGBDOdometryTiming *timing /*= nullptr*/) {
+    if (!CheckRGBDOdometryFramePair(source, target, option)) {
         utility::LogWarning(
-                "[RGBDOdometry] Two RGBD pairs should be same in size.");
+                "[RGBDOdometry] Two RGBD frames should be same in size and "
+                "have as many levels as option.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
                                Eigen::Matrix6d::Zero());
     }
+    if (timing != nullptr) {
+        timing->preprocessing_ms_ = 0.0;
+        timing->normalization_ms_ = 0.0;
+        timing->level_ms_.assign(source.NumLevels(), 0.0);
+        timing->information_ms_ = 0.0;
+    }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+    utility::Timer timer;
+    timer.Start();
+    auto correspondence = ComputeCorrespondence(
+            source.camera_matrix_pyramid_[0], odo_init,
+            source.pyramid_[0]->depth_, target.pyramid_[0]->depth_, option);
+    NormalizeIntensity(source, target, *correspondence);
+    timer.Stop();
+    if (timing != nullptr) {
+        timing->normalization_ms_ = timer.GetDuration();
+    }
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
     std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+            source, target, odo_init, jacobian_method, option, timing);
 
     if (is_success) {
+        timer.Start();
         Eigen::Matrix4d trans_output = extrinsic;
         Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                extrinsic, source.camera_matrix_pyramid_[0],
+                source.pyramid_[0]->depth_, target.pyramid_[0]->depth_,
+                *target.xyz_pyramid_[0], option);
+        timer.Stop();
+        if (timing != nullptr) {
+            timing->information_ms_ = timer.GetDuration();
+        }
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -555,6 +477,37 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/,
+        RGBDOdometryTiming *timing /*= nullptr*/) {
+    if (!CheckRGBDImagePair(source, target)) {
+        utility::LogWarning(
+                "[RGBDOdometry] Two RGBD pairs should be same in size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    utility::Timer timer;
+    timer.Start();
+    RGBDOdometryFrame source_frame(source, pinhole_camera_intrinsic, option);
+    RGBDOdometryFrame target_frame(target, pinhole_camera_intrinsic, option);
+    timer.Stop();
+
+    auto result = ComputeRGBDOdometry(source_frame, target_frame, odo_init,
+                                      jacobian_method, option, timing);
+    if (timing != nullptr) {
+        timing->preprocessing_ms_ = timer.GetDuration();
+    }
+    return result;
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
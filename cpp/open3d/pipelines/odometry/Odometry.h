@@ -28,24 +28,87 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/OdometryOption.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
 
 namespace open3d {
-
-namespace geometry {
-class RGBDImage;
-}
-
 namespace pipelines {
 namespace odometry {
 
+/// \class RGBDOdometryFrame
+///
+/// \brief RGBD image preprocessed for odometry.
+///
+/// Holds the pyramids of the filtered intensity and depth, of their gradients
+/// and of the XYZ images of every level. A frame can be reused for several
+/// odometry computations, e.g. in sequential odometry every frame is the
+/// target of one pair and the source of the next one, so that it only needs
+/// to be preprocessed once.
+class RGBDOdometryFrame {
+public:
+    /// \brief Default Constructor.
+    RGBDOdometryFrame() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param rgbd_image RGBD image with either a 3 channel uint8 color
+    /// image or a 1 channel float intensity image, and a float depth image.
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameters. The depth range and the number
+    /// of pyramid levels have to match the ones used for the odometry.
+    RGBDOdometryFrame(
+            const geometry::RGBDImage &rgbd_image,
+            const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+            const OdometryOption &option = OdometryOption());
+
+public:
+    /// Returns `true` if the frame has not been initialized from an image.
+    bool IsEmpty() const { return pyramid_.empty(); }
+    /// Returns the number of pyramid levels.
+    int NumLevels() const { return static_cast<int>(pyramid_.size()); }
+    /// \brief Scales the intensity of all levels to \p scale times the
+    /// intensity of the input image.
+    void SetIntensityScale(double scale);
+
+public:
+    /// Intensity and depth pyramid, level 0 is the finest.
+    geometry::RGBDImagePyramid pyramid_;
+    /// Horizontal gradients of pyramid_.
+    geometry::RGBDImagePyramid pyramid_dx_;
+    /// Vertical gradients of pyramid_.
+    geometry::RGBDImagePyramid pyramid_dy_;
+    /// 3 channel float images with the back-projected depth of every level.
+    std::vector<std::shared_ptr<geometry::Image>> xyz_pyramid_;
+    /// Camera matrix of every level.
+    std::vector<Eigen::Matrix3d> camera_matrix_pyramid_;
+    /// Factor the intensity of the input image is currently scaled by.
+    double intensity_scale_ = 1.0;
+};
+
+/// \class RGBDOdometryTiming
+///
+/// \brief Wall clock time in milliseconds spent in the stages of an odometry
+/// computation.
+class RGBDOdometryTiming {
+public:
+    /// Building the RGBDOdometryFrame of the source and target images. Zero if
+    /// the frames were passed in.
+    double preprocessing_ms_ = 0.0;
+    /// Finding the initial correspondences and normalizing the intensities.
+    double normalization_ms_ = 0.0;
+    /// Iterations of every pyramid level, indexed by level (0 is the finest).
+    std::vector<double> level_ms_;
+    /// Computing the information matrix of the result.
+    double information_ms_ = 0.0;
+};
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -54,6 +117,7 @@ namespace odometry {
 /// \param odo_init Initial 4x4 motion matrix estimation.
 /// \param jacobian_method The odometry Jacobian method to use.
 /// \param option Odometry hyper parameteres.
+/// \param timing If not nullptr, receives the time spent per stage.
 /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const geometry::RGBDImage &source,
@@ -63,7 +127,30 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
         const RGBDOdometryJacobian &jacobian_method =
                 RGBDOdometryJacobianFromHybridTerm(),
-        const OdometryOption &option = OdometryOption());
+        const OdometryOption &option = OdometryOption(),
+        RGBDOdometryTiming *timing = nullptr);
+
+/// \brief Function to estimate 6D rigid motion from two preprocessed RGBD
+/// frames.
+///
+/// The intensities of both frames are rescaled in place, the frames can be
+/// reused for further calls.
+///
+/// \param source Source frame.
+/// \param target Target frame.
+/// \param odo_init Initial 4x4 motion matrix estimation.
+/// \param jacobian_method The odometry Jacobian method to use.
+/// \param option Odometry hyper parameteres.
+/// \param timing If not nullptr, receives the time spent per stage.
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        RGBDOdometryFrame &source,
+        RGBDOdometryFrame &target,
+        const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption(),
+        RGBDOdometryTiming *timing = nullptr);
 
 }  // namespace odometry
 }  // namespace pipelines
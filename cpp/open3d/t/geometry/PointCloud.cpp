@@ -76,7 +76,11 @@ core::Tensor PointCloud::GetCenter() const { return GetPoints().Mean({0}); }
 PointCloud PointCloud::Copy(const core::Device device) const {
     PointCloud pcd(device);
     for (auto &value : point_attr_) {
-        pcd.SetPointAttr(value.first, value.second.Copy(device));
+        // On the same device, attributes share memory copy-on-write until
+        // either point cloud writes them.
+        pcd.SetPointAttr(value.first, device == GetDevice()
+                                              ? value.second.LazyCopy()
+                                              : value.second.Copy(device));
     }
     return pcd;
 }
@@ -233,10 +233,12 @@ public:
     /// Returns the center for point coordinates.
     core::Tensor GetCenter() const;
 
-    /// Returns deep copy of the pointcloud
+    /// Returns deep copy of the pointcloud. On the same device, the attributes
+    /// are copied copy-on-write, see core::Tensor::LazyCopy().
     PointCloud Copy(const core::Device device) const;
 
-    /// Returns deep copy of the pointcloud on the same device
+    /// Returns deep copy of the pointcloud on the same device, the attributes
+    /// are copied copy-on-write, see core::Tensor::LazyCopy().
     PointCloud Copy() const;
 
     /// \brief Transforms the points and normals (if exist)
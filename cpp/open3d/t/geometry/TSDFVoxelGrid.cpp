@@ -58,7 +58,7 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     int64_t total_bytes = 0;
     if (attr_dtype_map_.count("tsdf") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float16) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected TSDF dtype, please "
                     "implement your own Voxel structure in "
@@ -91,6 +91,18 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     }
     // Users can add other key/dtype checkers here for potential extensions.
 
+    // A Float16 tsdf with other dtypes could match the size of an unrelated
+    // voxel structure, e.g. a Float32 weight with UInt16 colors takes 12 bytes
+    // as ColoredVoxel16i.
+    if (attr_dtype_map_.at("tsdf") == core::Dtype::Float16 &&
+        (attr_dtype_map_.at("weight") != core::Dtype::UInt16 ||
+         (attr_dtype_map_.count("color") != 0 &&
+          attr_dtype_map_.at("color") != core::Dtype::UInt16))) {
+        utility::LogError(
+                "[TSDFVoxelGrid] a Float16 tsdf requires a UInt16 weight and "
+                "a UInt16 color if colors are stored.");
+    }
+
     // SDF trunc check, critical for TSDF touch operation that allocates TSDF
     // volumes.
     if (sdf_trunc > block_resolution_ * voxel_size_ * 0.499) {
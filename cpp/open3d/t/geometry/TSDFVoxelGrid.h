@@ -52,6 +52,13 @@ namespace geometry {
 /// (resolution, resolution, resolution, channel).
 /// For pure geometric TSDF voxels, channel = 2 (TSDF + weight).
 /// For colored TSDF voxels, channel = 5 (TSDF + weight + color).
+/// Voxels are dispatched by their size, the supported dtypes are:
+/// - Float32 tsdf, Float32 weight (8 bytes per voxel);
+/// - Float32 tsdf, UInt16 weight, UInt16 color (12 bytes);
+/// - Float32 tsdf, Float32 weight, Float32 color (20 bytes);
+/// - Float16 tsdf, UInt16 weight (4 bytes);
+/// - Float16 tsdf, UInt16 weight, UInt16 color (10 bytes).
+/// A Float16 tsdf with other weight or color dtypes is rejected.
 /// Users may specialize their own channels that can be reinterpreted from the
 /// internal Tensor.
 class TSDFVoxelGrid {
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadImage(const std::string &filename, geometry::Image &image) {
+    return open3d::io::ReadImageBuffer(
+            filename, [&image](int width, int height, int num_of_channels,
+                               int bytes_per_channel) -> uint8_t * {
+                core::Dtype dtype;
+                if (bytes_per_channel == 1) {
+                    dtype = core::Dtype::UInt8;
+                } else if (bytes_per_channel == 2) {
+                    dtype = core::Dtype::UInt16;
+                } else {
+                    utility::LogWarning(
+                            "Read image failed: unsupported bytes per channel "
+                            "({}).",
+                            bytes_per_channel);
+                    return nullptr;
+                }
+                const core::Tensor &data = image.AsTensor();
+                const core::SizeVector shape{height, width, num_of_channels};
+                if (data.GetDevice() != core::Device("CPU:0") ||
+                    !data.IsContiguous() || data.GetShape() != shape ||
+                    data.GetDtype() != dtype) {
+                    image = geometry::Image(height, width, num_of_channels,
+                                            dtype);
+                }
+                return static_cast<uint8_t *>(image.GetDataPtr());
+            });
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images) {
+    images.resize(filenames.size());
+    std::vector<uint8_t> success(filenames.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < int64_t(filenames.size()); i++) {
+        success[i] = ReadImage(filenames[i], images[i]);
+    }
+    return std::all_of(success.begin(), success.end(),
+                       [](uint8_t s) { return s != 0; });
+}
+
+bool WriteImage(const std::string &filename,
+                const geometry::Image &image,
+                int quality) {
+    return open3d::io::WriteImage(filename, image.ToLegacyImage(), quality);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
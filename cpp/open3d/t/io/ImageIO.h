@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Reads a PNG or JPG file into \p image.
+///
+/// 8 bit images are read as UInt8 and 16 bit images as UInt16. If \p image
+/// is a contiguous CPU image with the size, number of channels and dtype of
+/// the file, the file is decoded into its memory without an allocation, so
+/// tensors sharing that memory see the new content. Otherwise a new image is
+/// allocated.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadImage(const std::string &filename, geometry::Image &image);
+
+/// \brief Reads the files \p filenames into \p images in parallel. The
+/// memory of \p images is reused as in ReadImage.
+/// \return true if all files are read successfully.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images);
+
+/// \brief Writes \p image to a PNG or JPG file. See open3d::io::WriteImage for
+/// \p quality.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteImage(const std::string &filename,
+                const geometry::Image &image,
+                int quality = open3d::io::kOpen3DImageIODefaultQuality);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudChunkReader.h"
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool PointCloudChunkReader::Open(const std::string &filename,
+                                 int64_t chunk_size,
+                                 size_t read_ahead,
+                                 const ReadPointCloudOption &params) {
+    Close();
+    if (chunk_size <= 0) {
+        utility::LogWarning("Read point cloud failed: invalid chunk size {}.",
+                            chunk_size);
+        return false;
+    }
+    const std::string format =
+            params.format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : params.format;
+    const bool remove_nan = params.remove_nan_points;
+    const bool remove_infinite = params.remove_infinite_points;
+
+    std::function<bool(geometry::PointCloud &)> produce;
+    if (format == "tpc") {
+        if (!utility::filesystem::FileExists(filename)) {
+            utility::LogWarning("Read TPC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        int64_t begin = 0;
+        produce = [filename, chunk_size, remove_nan, remove_infinite,
+                   begin](geometry::PointCloud &chunk) mutable {
+            while (ReadPointCloudSubsetFromTPC(filename, chunk, {}, begin,
+                                               begin + chunk_size) &&
+                   chunk.HasPoints()) {
+                begin += chunk.GetPoints().GetLength();
+                RemoveNonFinitePoints(chunk, remove_nan, remove_infinite);
+                // Chunks without finite points are skipped.
+                if (chunk.HasPoints()) {
+                    return true;
+                }
+            }
+            return false;
+        };
+    } else {
+        legacy_reader_ = std::make_shared<open3d::io::PointCloudChunkReader>();
+        ReadPointCloudOption legacy_params = params;
+        legacy_params.format = format;
+        if (!legacy_reader_->Open(filename, chunk_size, read_ahead,
+                                  legacy_params)) {
+            legacy_reader_.reset();
+            return false;
+        }
+        num_points_ = legacy_reader_->NumPoints();
+        std::shared_ptr<open3d::io::PointCloudChunkReader> legacy_reader =
+                legacy_reader_;
+        produce = [legacy_reader](geometry::PointCloud &chunk) {
+            open3d::geometry::PointCloud legacy_chunk;
+            if (!legacy_reader->ReadNext(legacy_chunk)) {
+                return false;
+            }
+            chunk = geometry::PointCloud::FromLegacyPointCloud(
+                    legacy_chunk, core::Dtype::Float64);
+            return true;
+        };
+    }
+    prefetcher_.reset(
+            new utility::Prefetcher<geometry::PointCloud>(produce, read_ahead));
+    return true;
+}
+
+bool PointCloudChunkReader::ReadNext(geometry::PointCloud &chunk) {
+    if (!prefetcher_) {
+        return false;
+    }
+    try {
+        return prefetcher_->Next(chunk);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read point cloud chunk failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+void PointCloudChunkReader::Close() {
+    // The prefetcher reads from the legacy reader and is stopped first.
+    prefetcher_.reset();
+    legacy_reader_.reset();
+    num_points_ = -1;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/io/PointCloudChunkReader.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Prefetcher.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudChunkReader
+///
+/// \brief Reads a point cloud file as a sequence of chunks of points stored
+/// as tensors on the CPU.
+///
+/// Chunks are read on a background thread, at most \p read_ahead chunks ahead
+/// of ReadNext(). .tpc files are read natively, chunks of uncompressed
+/// attributes are backed by a memory map of the file. The formats of
+/// open3d::io::PointCloudChunkReader are read with it and converted to Float64
+/// tensors.
+class PointCloudChunkReader {
+public:
+    PointCloudChunkReader() {}
+    ~PointCloudChunkReader() { Close(); }
+
+    /// \brief Opens \p filename and starts reading chunks in the background.
+    ///
+    /// \param chunk_size Number of points per chunk. All chunks but the last
+    /// have this size, unless non-finite points are removed.
+    /// \param read_ahead Maximum number of chunks read ahead of ReadNext().
+    /// \param params Format and removal of non-finite points, progress
+    /// options are ignored.
+    bool Open(const std::string &filename,
+              int64_t chunk_size = 1 << 20,
+              size_t read_ahead = 2,
+              const ReadPointCloudOption &params = {});
+
+    /// Returns the next chunk in \p chunk, false once all points are read or
+    /// if reading the file fails.
+    bool ReadNext(geometry::PointCloud &chunk);
+
+    /// Total number of points, -1 if unknown before reading the file.
+    int64_t NumPoints() const { return num_points_; }
+
+    /// Stops reading and closes the file.
+    void Close();
+
+private:
+    std::unique_ptr<utility::Prefetcher<geometry::PointCloud>> prefetcher_;
+    std::shared_ptr<open3d::io::PointCloudChunkReader> legacy_reader_;
+    int64_t num_points_ = -1;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,8 +26,11 @@
 
 #include "open3d/t/io/PointCloudIO.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
@@ -45,10 +48,22 @@ static const std::unordered_map<
                            geometry::PointCloud &,
                            const open3d::io::ReadPointCloudOption &)>>
         file_extension_to_pointcloud_read_function{
+                {"xyz", ReadPointCloudFromXYZ},
+                {"xyzn", ReadPointCloudFromXYZN},
+                {"xyzrgb", ReadPointCloudFromXYZRGB},
+                {"pts", ReadPointCloudFromPTS},
+                {"pcd", ReadPointCloudFromPCD},
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"tpc", ReadPointCloudFromTPC},
         };
 
+/// Readers of these formats drop non-finite points while parsing, so
+/// ReadPointCloud does not scan the points again.
+static const std::unordered_set<std::string>
+        file_extensions_removing_non_finite_points{"xyz", "xyzn", "xyzrgb",
+                                                   "pts", "xyzi"};
+
 static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &,
@@ -57,8 +72,76 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"tpc", WritePointCloudToTPC},
         };
 
+template <typename scalar_t>
+static std::vector<int64_t> GetFinitePointIndices(const core::Tensor &points,
+                                                  bool remove_nan,
+                                                  bool remove_infinite) {
+    const int64_t num_points = points.GetLength();
+    const int64_t num_values = points.NumElements() / std::max<int64_t>(
+                                                              num_points, 1);
+    const scalar_t *points_ptr =
+            static_cast<const scalar_t *>(points.GetDataPtr());
+    std::vector<uint8_t> keep(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        bool finite = true;
+        for (int64_t k = 0; k < num_values; k++) {
+            scalar_t value = points_ptr[i * num_values + k];
+            finite = finite && !(remove_nan && std::isnan(value)) &&
+                     !(remove_infinite && std::isinf(value));
+        }
+        keep[i] = finite;
+    }
+    std::vector<int64_t> indices;
+    for (int64_t i = 0; i < num_points; i++) {
+        if (keep[i]) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+void RemoveNonFinitePoints(geometry::PointCloud &pointcloud,
+                           bool remove_nan,
+                           bool remove_infinite) {
+    if ((!remove_nan && !remove_infinite) || !pointcloud.HasPoints()) {
+        return;
+    }
+    const core::Device host("CPU:0");
+    core::Tensor points = pointcloud.GetPoints();
+    points = points.GetDevice() == host ? points.Contiguous()
+                                        : points.Copy(host);
+    std::vector<int64_t> indices;
+    if (points.GetDtype() == core::Dtype::Float32) {
+        indices = GetFinitePointIndices<float>(points, remove_nan,
+                                               remove_infinite);
+    } else if (points.GetDtype() == core::Dtype::Float64) {
+        indices = GetFinitePointIndices<double>(points, remove_nan,
+                                                remove_infinite);
+    } else {
+        return;
+    }
+    if (int64_t(indices.size()) == points.GetLength()) {
+        return;
+    }
+    utility::LogDebug("Removed {} non-finite points.",
+                      points.GetLength() - int64_t(indices.size()));
+    core::Tensor index_tensor(indices, {int64_t(indices.size())},
+                              core::Dtype::Int64);
+    std::vector<std::string> keys;
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        keys.push_back(kv.first);
+    }
+    for (const std::string &key : keys) {
+        const core::Tensor &attr = pointcloud.GetPointAttr(key);
+        pointcloud.SetPointAttr(
+                key, attr.IndexGet({index_tensor.Copy(attr.GetDevice())}));
+    }
+}
+
 std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
         const std::string &filename,
         const std::string &format,
@@ -91,11 +174,10 @@ bool ReadPointCloud(const std::string &filename,
         success = map_itr->second(filename, pointcloud, params);
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                           (int)pointcloud.GetPoints().GetLength());
-        if (params.remove_nan_points || params.remove_infinite_points) {
-            utility::LogError(
-                    "remove_nan_points and remove_infinite_points options are "
-                    "unimplemented.");
-            return false;
+        if (success && file_extensions_removing_non_finite_points.count(
+                               format) == 0) {
+            RemoveNonFinitePoints(pointcloud, params.remove_nan_points,
+                                  params.remove_infinite_points);
         }
     }
     return success;
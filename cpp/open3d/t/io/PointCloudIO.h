@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -61,6 +62,64 @@ bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params = {});
 
+/// \brief Removes points with NaN or infinite coordinates from all point
+/// attributes, as open3d::geometry::PointCloud::RemoveNonFinitePoints does.
+/// Attributes are left untouched if all points are finite, so tensors backed
+/// by a file mapping are not copied.
+void RemoveNonFinitePoints(geometry::PointCloud &pointcloud,
+                           bool remove_nan,
+                           bool remove_infinite);
+
+bool ReadPointCloudFromXYZ(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromXYZN(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromXYZRGB(const std::string &filename,
+                              geometry::PointCloud &pointcloud,
+                              const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromPTS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// \brief Reads a point cloud from the native tensor point cloud format
+/// (.tpc).
+///
+/// Uncompressed attributes are returned as tensors backed by a copy-on-write
+/// memory map of the file, so no data is read until it is accessed and
+/// modifications do not change the file. Compressed attributes are
+/// decompressed in parallel, chunk by chunk.
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// \brief Reads a subset of the attributes and points of a .tpc file.
+///
+/// \param attributes Names of the attributes to read, all if empty.
+/// \param begin First point to read.
+/// \param end One past the last point to read, -1 for the end of the file.
+/// Only the compressed chunks overlapping [begin, end) are decompressed.
+bool ReadPointCloudSubsetFromTPC(const std::string &filename,
+                                 geometry::PointCloud &pointcloud,
+                                 const std::vector<std::string> &attributes,
+                                 int64_t begin = 0,
+                                 int64_t end = -1);
+
+/// \brief Writes all point attributes to a .tpc file, as aligned contiguous
+/// blocks with their dtype and shape. With WritePointCloudOption::compressed,
+/// attributes are split into chunks compressed independently with LZF.
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params);
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/PCDData.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    using open3d::io::PCDHeader;
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    PCDHeader header;
+    if (!open3d::io::ReadPCDHeader(file, header)) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        fclose(file);
+        return false;
+    }
+
+    // ASCII data goes through the legacy reader.
+    if (header.datatype == open3d::io::PCD_DATA_ASCII) {
+        fclose(file);
+        open3d::geometry::PointCloud legacy_pointcloud;
+        if (!open3d::io::ReadPointCloudFromPCD(filename, legacy_pointcloud,
+                                               params)) {
+            return false;
+        }
+        pointcloud = geometry::PointCloud::FromLegacyPointCloud(
+                legacy_pointcloud, core::Dtype::Float64);
+        return true;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.points);
+    open3d::io::PCDBinaryData data;
+    if (!data.Read(file, header)) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    reporter.Update(header.points / 2);
+
+    // Fields are decoded straight into the columns of the tensors.
+    const int64_t num_points = header.points;
+    core::Tensor points({num_points, 3}, core::Dtype::Float64);
+    core::Tensor normals, colors;
+    if (header.has_normals) {
+        normals = core::Tensor({num_points, 3}, core::Dtype::Float64);
+    }
+    if (header.has_colors) {
+        colors = core::Tensor({num_points, 3}, core::Dtype::Float64);
+    }
+    auto column = [](core::Tensor &tensor, int k) {
+        return static_cast<double *>(tensor.GetDataPtr()) + k;
+    };
+    for (const auto &field : header.fields) {
+        if (field.name == "x") {
+            data.DecodeField(field, column(points, 0), 3);
+        } else if (field.name == "y") {
+            data.DecodeField(field, column(points, 1), 3);
+        } else if (field.name == "z") {
+            data.DecodeField(field, column(points, 2), 3);
+        } else if (field.name == "normal_x" && header.has_normals) {
+            data.DecodeField(field, column(normals, 0), 3);
+        } else if (field.name == "normal_y" && header.has_normals) {
+            data.DecodeField(field, column(normals, 1), 3);
+        } else if (field.name == "normal_z" && header.has_normals) {
+            data.DecodeField(field, column(normals, 2), 3);
+        } else if (field.name == "rgb" || field.name == "rgba") {
+            data.DecodeColorField(field, column(colors, 0), 3);
+        }
+    }
+
+    pointcloud.Clear();
+    pointcloud.SetPoints(points);
+    if (header.has_normals) {
+        pointcloud.SetPointNormals(normals);
+    }
+    if (header.has_colors) {
+        pointcloud.SetPointColors(colors);
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,9 +26,13 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <array>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/BinaryPLY.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
@@ -148,8 +152,12 @@ static core::Dtype GetDtype(e_ply_type type) {
     // Currently, we are not doing datatype conversions, so some of the ply
     // datatypes are not included.
 
-    if (type == PLY_UINT8) {
+    if (type == PLY_INT8) {
+        return core::Dtype::Int8;
+    } else if (type == PLY_UINT8) {
         return core::Dtype::UInt8;
+    } else if (type == PLY_INT16) {
+        return core::Dtype::Int16;
     } else if (type == PLY_UINT16) {
         return core::Dtype::UInt16;
     } else if (type == PLY_INT32) {
@@ -158,8 +166,14 @@ static core::Dtype GetDtype(e_ply_type type) {
         return core::Dtype::Float32;
     } else if (type == PLY_FLOAT64) {
         return core::Dtype::Float64;
+    } else if (type == PLY_CHAR) {
+        return core::Dtype::Int8;
     } else if (type == PLY_UCHAR) {
         return core::Dtype::UInt8;
+    } else if (type == PLY_SHORT) {
+        return core::Dtype::Int16;
+    } else if (type == PLY_USHORT) {
+        return core::Dtype::UInt16;
     } else if (type == PLY_INT) {
         return core::Dtype::Int32;
     } else if (type == PLY_FLOAT) {
@@ -171,9 +185,137 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+static core::Dtype GetDtype(open3d::io::PLYScalarType type) {
+    using open3d::io::PLYScalarType;
+    // Same set of datatypes as the rply path.
+    if (type == PLYScalarType::Int8) {
+        return core::Dtype::Int8;
+    } else if (type == PLYScalarType::UInt8) {
+        return core::Dtype::UInt8;
+    } else if (type == PLYScalarType::Int16) {
+        return core::Dtype::Int16;
+    } else if (type == PLYScalarType::UInt16) {
+        return core::Dtype::UInt16;
+    } else if (type == PLYScalarType::Int32) {
+        return core::Dtype::Int32;
+    } else if (type == PLYScalarType::Float32) {
+        return core::Dtype::Float32;
+    } else if (type == PLYScalarType::Float64) {
+        return core::Dtype::Float64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+/// Reads the "vertex" element of a binary PLY file directly from a memory
+/// map. Base attributes are copied straight into the columns of {N, 3}
+/// tensors. Returns false for layouts handled by the rply path only.
+static bool ReadPointCloudFromBinaryPLY(
+        const open3d::io::BinaryPLYReader &reader,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    using Element = open3d::io::BinaryPLYReader::Element;
+    using Property = open3d::io::BinaryPLYReader::Property;
+    const Element *element = reader.GetElement("vertex");
+    if (!element || element->stride_ == 0) {
+        return false;
+    }
+    const int64_t element_size = element->count_;
+
+    std::vector<const Property *> properties;
+    for (const Property &property : element->properties_) {
+        if (GetDtype(property.type_) == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype.",
+                    property.name_);
+        } else {
+            properties.push_back(&property);
+        }
+    }
+    auto find_property = [&](const std::string &name) -> const Property * {
+        for (const Property *property : properties) {
+            if (property->name_ == name) {
+                return property;
+            }
+        }
+        return nullptr;
+    };
+
+    // Returns the {N, 3} tensor of a base attribute, undefined if one of the
+    // columns is missing. Mixed datatypes are left to the rply path.
+    bool mixed_dtypes = false;
+    auto read_columns = [&](const std::array<std::string, 3> &names) {
+        const Property *columns[3];
+        for (int i = 0; i < 3; i++) {
+            columns[i] = find_property(names[i]);
+            if (!columns[i]) {
+                return core::Tensor();
+            }
+        }
+        core::Dtype dtype = GetDtype(columns[0]->type_);
+        if (GetDtype(columns[1]->type_) != dtype ||
+            GetDtype(columns[2]->type_) != dtype) {
+            mixed_dtypes = true;
+            return core::Tensor();
+        }
+        core::Tensor combined =
+                core::Tensor::Empty({element_size, 3}, dtype);
+        const int64_t byte_size = dtype.ByteSize();
+        for (int i = 0; i < 3; i++) {
+            reader.ReadPropertyRaw(
+                    *element, *columns[i],
+                    static_cast<uint8_t *>(combined.GetDataPtr()) +
+                            i * byte_size,
+                    3 * byte_size);
+            properties.erase(std::find(properties.begin(), properties.end(),
+                                       columns[i]));
+        }
+        return combined;
+    };
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(element_size);
+
+    core::Tensor points = read_columns({"x", "y", "z"});
+    core::Tensor normals = read_columns({"nx", "ny", "nz"});
+    core::Tensor colors = read_columns({"red", "green", "blue"});
+    if (mixed_dtypes) {
+        return false;
+    }
+
+    pointcloud.Clear();
+    if (points.NumElements() > 0) {
+        pointcloud.SetPoints(points);
+    }
+    if (normals.NumElements() > 0) {
+        pointcloud.SetPointNormals(normals);
+    }
+    if (colors.NumElements() > 0) {
+        pointcloud.SetPointColors(colors);
+    }
+    // Add rest of the attributes.
+    for (const Property *property : properties) {
+        core::Tensor data = core::Tensor::Empty({element_size, 1},
+                                                GetDtype(property->type_));
+        reader.ReadPropertyRaw(*element, *property, data.GetDataPtr(),
+                               data.GetDtype().ByteSize());
+        pointcloud.SetPointAttr(property->name_, data);
+    }
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Binary files bypass the per-value rply callbacks.
+    open3d::io::BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename) &&
+        ReadPointCloudFromBinaryPLY(binary_reader, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -308,14 +450,21 @@ bool ReadPointCloudFromPLY(const std::string &filename,
 }
 
 static e_ply_type GetPlyType(const core::Dtype &dtype) {
-    if (dtype == core::Dtype::UInt8) {
+    if (dtype == core::Dtype::Int8) {
+        return PLY_INT8;
+    } else if (dtype == core::Dtype::UInt8) {
         return PLY_UINT8;
+    } else if (dtype == core::Dtype::Int16) {
+        return PLY_INT16;
     } else if (dtype == core::Dtype::UInt16) {
         return PLY_UINT16;
     } else if (dtype == core::Dtype::Int32) {
         return PLY_INT32;
     } else if (dtype == core::Dtype::Float32) {
         return PLY_FLOAT32;
+    } else if (dtype == core::Dtype::Float16) {
+        // PLY has no half-precision type, Float16 is widened on write.
+        return PLY_FLOAT32;
     } else if (dtype == core::Dtype::Float64) {
         return PLY_FLOAT64;
     } else if (dtype == core::Dtype::UInt8) {
@@ -418,15 +567,16 @@ bool WritePointCloudToPLY(const std::string &filename,
     reporter.SetTotal(num_points);
 
     for (int64_t i = 0; i < num_points; i++) {
-        DISPATCH_DTYPE_TO_TEMPLATE(pointcloud.GetPoints().GetDtype(), [&]() {
-            const scalar_t *data_ptr =
-                    GetValue<scalar_t>(pointcloud.GetPoints()[i], 0);
-            ply_write(ply_file, double(data_ptr[0]));
-            ply_write(ply_file, double(data_ptr[1]));
-            ply_write(ply_file, double(data_ptr[2]));
-        });
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(
+                pointcloud.GetPoints().GetDtype(), [&]() {
+                    const scalar_t *data_ptr =
+                            GetValue<scalar_t>(pointcloud.GetPoints()[i], 0);
+                    ply_write(ply_file, double(data_ptr[0]));
+                    ply_write(ply_file, double(data_ptr[1]));
+                    ply_write(ply_file, double(data_ptr[2]));
+                });
         if (pointcloud.HasPointNormals()) {
-            DISPATCH_DTYPE_TO_TEMPLATE(
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(
                     pointcloud.GetPointNormals().GetDtype(), [&]() {
                         const scalar_t *data_ptr = GetValue<scalar_t>(
                                 pointcloud.GetPointNormals()[i], 0);
@@ -436,7 +586,7 @@ bool WritePointCloudToPLY(const std::string &filename,
                     });
         }
         if (pointcloud.HasPointColors()) {
-            DISPATCH_DTYPE_TO_TEMPLATE(
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(
                     pointcloud.GetPointColors().GetDtype(), [&]() {
                         const scalar_t *data_ptr = GetValue<scalar_t>(
                                 pointcloud.GetPointColors()[i], 0);
@@ -449,11 +599,12 @@ bool WritePointCloudToPLY(const std::string &filename,
         for (auto const &it : t_map) {
             if (it.first != "points" && it.first != "colors" &&
                 it.first != "normals") {
-                DISPATCH_DTYPE_TO_TEMPLATE(it.second.GetDtype(), [&]() {
-                    const scalar_t *data_ptr =
-                            GetValue<scalar_t>(it.second[i], 0);
-                    ply_write(ply_file, double(data_ptr[0]));
-                });
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(
+                        it.second.GetDtype(), [&]() {
+                            const scalar_t *data_ptr =
+                                    GetValue<scalar_t>(it.second[i], 0);
+                            ply_write(ply_file, double(data_ptr[0]));
+                        });
             }
         }
 
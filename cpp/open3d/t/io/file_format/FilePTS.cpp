@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPointCloudFromPTS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
+            utility::LogWarning("Read PTS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const int64_t size = file.GetSize();
+        double num_of_pts_value = 0;
+        if (!open3d::io::ParseASCIIDouble(data, data + size,
+                                          num_of_pts_value) ||
+            num_of_pts_value < 1) {
+            utility::LogWarning("Read PTS failed: unable to read header.");
+            return false;
+        }
+        const int64_t num_of_pts = int64_t(num_of_pts_value);
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(size);
+
+        const int64_t data_offset = open3d::io::SkipASCIILines(data, size, 1);
+        const int num_of_fields = open3d::io::CountASCIITokens(
+                data + data_offset, size - data_offset);
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+        // X Y Z, or X Y Z I R G B.
+        const int num_values = num_of_fields >= 7 ? 7 : 3;
+        std::vector<double> values = open3d::io::ParseASCIIRecords(
+                data + data_offset, size - data_offset, num_values, true,
+                num_of_pts,
+                open3d::io::CreateFiniteRecordFilter(
+                        3, params.remove_nan_points,
+                        params.remove_infinite_points),
+                [&](int64_t bytes) { reporter.Update(data_offset + bytes); });
+        const int64_t num_points = int64_t(values.size()) / num_values;
+
+        pointcloud.Clear();
+        core::Tensor points({num_points, 3}, core::Dtype::Float64);
+        double *points_ptr = static_cast<double *>(points.GetDataPtr());
+        core::Tensor colors;
+        double *colors_ptr = nullptr;
+        if (num_values == 7) {
+            colors = core::Tensor({num_points, 3}, core::Dtype::Float64);
+            colors_ptr = static_cast<double *>(colors.GetDataPtr());
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *record = &values[num_values * i];
+            for (int k = 0; k < 3; k++) {
+                points_ptr[3 * i + k] = record[k];
+                if (colors_ptr) {
+                    colors_ptr[3 * i + k] =
+                            double(uint8_t(int(record[4 + k]))) / 255.0;
+                }
+            }
+        }
+        pointcloud.SetPoints(points);
+        if (colors_ptr) {
+            pointcloud.SetPointColors(colors);
+        }
+        reporter.Finish();
+
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PTS failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
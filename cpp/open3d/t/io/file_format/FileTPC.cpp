@@ -0,0 +1,583 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Native tensor point cloud container (.tpc).
+//
+// All values are stored in the byte order of the writer, which is recorded in
+// the header and checked by the reader.
+//
+//   char[8]  magic "O3DTPC"
+//   uint32   version
+//   uint32   byte order mark 0x01020304
+//   int64    number of points N
+//   uint32   number of attributes
+//   per attribute:
+//     uint32   name size, followed by the name
+//     uint8    Dtype::DtypeCode, uint8 byte size, uint8 compression, uint8 0
+//     uint32   number of dimensions per point, followed by int64 dimensions
+//     int64    points per chunk
+//     uint32   number of chunks, followed by int64 offset and int64 size of
+//              each chunk
+//   data blocks, each aligned to kTPCAlignment bytes
+//
+// Uncompressed attributes are a single contiguous {N, ...} block. Compressed
+// attributes are split into chunks of points compressed independently with
+// LZF. A chunk whose stored size equals its raw size is stored uncompressed.
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+const char kTPCMagic[8] = {'O', '3', 'D', 'T', 'P', 'C', '\0', '\0'};
+const uint32_t kTPCVersion = 1;
+const uint32_t kTPCByteOrderMark = 0x01020304;
+const int64_t kTPCAlignment = 64;
+/// Target size of a compressed chunk before compression.
+const int64_t kTPCChunkBytes = 1 << 20;
+
+enum class TPCCompression : uint8_t { None = 0, LZF = 1 };
+
+struct TPCChunk {
+    int64_t offset_ = 0;
+    int64_t size_ = 0;
+};
+
+struct TPCAttribute {
+    std::string name_;
+    core::Dtype dtype_;
+    TPCCompression compression_ = TPCCompression::None;
+    /// Shape of one point, e.g. {3} for points.
+    core::SizeVector point_shape_;
+    int64_t chunk_points_ = 0;
+    std::vector<TPCChunk> chunks_;
+
+    int64_t RowBytes() const {
+        return point_shape_.NumElements() * dtype_.ByteSize();
+    }
+};
+
+/// Dtypes that can be stored. The file records the dtype code and byte size.
+const std::vector<core::Dtype> &GetTPCDtypes() {
+    static const std::vector<core::Dtype> dtypes = {
+            core::Dtype::Float16, core::Dtype::Float32, core::Dtype::Float64,
+            core::Dtype::Int8,    core::Dtype::Int16,   core::Dtype::Int32,
+            core::Dtype::Int64,   core::Dtype::UInt8,   core::Dtype::UInt16,
+            core::Dtype::Bool};
+    return dtypes;
+}
+
+core::Dtype GetTPCDtype(uint8_t code, uint8_t byte_size) {
+    for (const core::Dtype &dtype : GetTPCDtypes()) {
+        if (uint8_t(dtype.GetDtypeCode()) == code &&
+            dtype.ByteSize() == byte_size) {
+            return dtype;
+        }
+    }
+    return core::Dtype::Undefined;
+}
+
+int64_t AlignTPCOffset(int64_t offset) {
+    return (offset + kTPCAlignment - 1) / kTPCAlignment * kTPCAlignment;
+}
+
+/// Bounds checked reader of the header.
+class TPCHeaderReader {
+public:
+    TPCHeaderReader(const uint8_t *data, int64_t size)
+        : data_(data), size_(size) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        return ReadBytes(&value, sizeof(T));
+    }
+
+    bool ReadBytes(void *dst, int64_t size) {
+        if (size < 0 || offset_ + size > size_) {
+            return false;
+        }
+        std::memcpy(dst, data_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    int64_t Remaining() const { return size_ - offset_; }
+
+private:
+    const uint8_t *data_;
+    int64_t size_;
+    int64_t offset_ = 0;
+};
+
+bool ReadTPCHeader(const utility::filesystem::MappedFile &file,
+                   int64_t &num_points,
+                   std::vector<TPCAttribute> &attributes) {
+    TPCHeaderReader reader(file.GetData(), file.GetSize());
+    char magic[8];
+    uint32_t version, byte_order, num_attributes;
+    if (!reader.ReadBytes(magic, 8) ||
+        std::memcmp(magic, kTPCMagic, 8) != 0 || !reader.Read(version) ||
+        !reader.Read(byte_order) || !reader.Read(num_points) ||
+        !reader.Read(num_attributes)) {
+        utility::LogWarning("Read TPC failed: invalid header.");
+        return false;
+    }
+    if (version != kTPCVersion) {
+        utility::LogWarning("Read TPC failed: unsupported version {}.",
+                            version);
+        return false;
+    }
+    if (byte_order != kTPCByteOrderMark) {
+        utility::LogWarning("Read TPC failed: unsupported byte order.");
+        return false;
+    }
+    // Counts and sizes read from the file are checked against the file size
+    // before they are used in allocations or multiplications. An attribute
+    // takes at least 24 bytes of the header, a chunk 16 bytes.
+    if (num_points < 0 || num_attributes > reader.Remaining() / 24) {
+        utility::LogWarning("Read TPC failed: invalid header.");
+        return false;
+    }
+    attributes.resize(num_attributes);
+    for (TPCAttribute &attr : attributes) {
+        uint32_t name_size, ndim, num_chunks;
+        uint8_t dtype_code, byte_size, compression, reserved;
+        if (!reader.Read(name_size) || name_size > 4096) {
+            return false;
+        }
+        attr.name_.resize(name_size);
+        if (!reader.ReadBytes(&attr.name_[0], name_size) ||
+            !reader.Read(dtype_code) || !reader.Read(byte_size) ||
+            !reader.Read(compression) || !reader.Read(reserved) ||
+            !reader.Read(ndim) || ndim > 16) {
+            return false;
+        }
+        attr.dtype_ = GetTPCDtype(dtype_code, byte_size);
+        attr.compression_ = static_cast<TPCCompression>(compression);
+        attr.point_shape_.resize(ndim);
+        for (int64_t &dim : attr.point_shape_) {
+            if (!reader.Read(dim) || dim < 0) {
+                return false;
+            }
+        }
+        if (!reader.Read(attr.chunk_points_) || !reader.Read(num_chunks) ||
+            num_chunks > reader.Remaining() / 16) {
+            return false;
+        }
+        attr.chunks_.resize(num_chunks);
+        for (TPCChunk &chunk : attr.chunks_) {
+            if (!reader.Read(chunk.offset_) || !reader.Read(chunk.size_) ||
+                chunk.offset_ < 0 || chunk.size_ < 0 ||
+                chunk.offset_ > file.GetSize() ||
+                chunk.size_ > file.GetSize() - chunk.offset_) {
+                return false;
+            }
+        }
+        if (attr.dtype_ == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read TPC warning: skipping attribute \"{}\", unsupported "
+                    "dtype.",
+                    attr.name_);
+            continue;
+        }
+        // The size of all points must fit into int64_t, so that the readers
+        // can compute sizes and offsets of any range of points.
+        const int64_t max_size = std::numeric_limits<int64_t>::max();
+        int64_t row_bytes = attr.dtype_.ByteSize();
+        for (int64_t dim : attr.point_shape_) {
+            if (dim > 0 && row_bytes > max_size / dim) {
+                return false;
+            }
+            row_bytes *= dim;
+        }
+        if (row_bytes > 0 && num_points > max_size / row_bytes) {
+            return false;
+        }
+        // Uncompressed data must be one block covering all points.
+        if (attr.compression_ == TPCCompression::None &&
+            (attr.chunks_.size() != 1 ||
+             (row_bytes == 0 ? attr.chunks_[0].size_ != 0
+                             : attr.chunks_[0].size_ % row_bytes != 0 ||
+                                       attr.chunks_[0].size_ / row_bytes !=
+                                               num_points))) {
+            return false;
+        }
+        if (attr.compression_ == TPCCompression::LZF &&
+            (attr.chunk_points_ <= 0 ||
+             int64_t(attr.chunks_.size()) !=
+                     num_points / attr.chunk_points_ +
+                             (num_points % attr.chunk_points_ != 0))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Reads points [begin, end) of a compressed attribute. Only the chunks
+/// overlapping the range are decompressed, in parallel.
+bool ReadCompressedTPCAttribute(const utility::filesystem::MappedFile &file,
+                                const TPCAttribute &attr,
+                                int64_t num_points,
+                                int64_t begin,
+                                int64_t end,
+                                core::Tensor &tensor) {
+    const int64_t row_bytes = attr.RowBytes();
+    core::SizeVector shape = attr.point_shape_;
+    shape.insert(shape.begin(), end - begin);
+    tensor = core::Tensor(shape, attr.dtype_);
+    if (end == begin) {
+        return true;
+    }
+    uint8_t *dst = static_cast<uint8_t *>(tensor.GetDataPtr());
+    const int64_t first_chunk = begin / attr.chunk_points_;
+    const int64_t last_chunk = (end - 1) / attr.chunk_points_;
+    bool success = true;
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = first_chunk; c <= last_chunk; c++) {
+        const TPCChunk &chunk = attr.chunks_[c];
+        const int64_t chunk_begin = c * attr.chunk_points_;
+        const int64_t chunk_end =
+                std::min(chunk_begin + attr.chunk_points_, num_points);
+        const int64_t raw_size = (chunk_end - chunk_begin) * row_bytes;
+        const uint8_t *raw = file.GetData() + chunk.offset_;
+        std::vector<uint8_t> buffer;
+        if (chunk.size_ != raw_size) {
+            buffer.resize(raw_size);
+            if (lzf_decompress(raw, (unsigned int)chunk.size_, buffer.data(),
+                               (unsigned int)raw_size) != raw_size) {
+                success = false;
+                continue;
+            }
+            raw = buffer.data();
+        }
+        // Points of this chunk that fall into [begin, end).
+        const int64_t copy_begin = std::max(begin, chunk_begin);
+        const int64_t copy_end = std::min(end, chunk_end);
+        std::memcpy(dst + (copy_begin - begin) * row_bytes,
+                    raw + (copy_begin - chunk_begin) * row_bytes,
+                    (copy_end - copy_begin) * row_bytes);
+    }
+    return success;
+}
+
+}  // unnamed namespace
+
+bool ReadPointCloudSubsetFromTPC(const std::string &filename,
+                                 geometry::PointCloud &pointcloud,
+                                 const std::vector<std::string> &attributes,
+                                 int64_t begin,
+                                 int64_t end) {
+    auto file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!file->Open(filename, /*copy_on_write=*/true)) {
+        utility::LogWarning("Read TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    int64_t num_points = 0;
+    std::vector<TPCAttribute> file_attributes;
+    if (!ReadTPCHeader(*file, num_points, file_attributes)) {
+        utility::LogWarning("Read TPC failed: corrupted file: {}", filename);
+        return false;
+    }
+    if (end < 0 || end > num_points) {
+        end = num_points;
+    }
+    if (begin < 0 || begin > end) {
+        utility::LogWarning("Read TPC failed: invalid range [{}, {}).", begin,
+                            end);
+        return false;
+    }
+
+    // The blob keeps the mapping alive as long as a tensor refers to it.
+    auto blob = std::make_shared<core::Blob>(
+            core::Device("CPU:0"), file->GetMutableData(),
+            [file](void *) {});
+
+    pointcloud.Clear();
+    for (const TPCAttribute &attr : file_attributes) {
+        if (attr.dtype_ == core::Dtype::Undefined ||
+            (!attributes.empty() &&
+             std::find(attributes.begin(), attributes.end(), attr.name_) ==
+                     attributes.end())) {
+            continue;
+        }
+        core::Tensor tensor;
+        if (attr.compression_ == TPCCompression::None) {
+            core::SizeVector shape = attr.point_shape_;
+            shape.insert(shape.begin(), end - begin);
+            core::SizeVector strides(shape.size(), 1);
+            for (int64_t i = int64_t(shape.size()) - 2; i >= 0; i--) {
+                strides[i] = strides[i + 1] * shape[i + 1];
+            }
+            uint8_t *data_ptr = file->GetMutableData() +
+                                attr.chunks_[0].offset_ +
+                                begin * attr.RowBytes();
+            tensor = core::Tensor(shape, strides, data_ptr, attr.dtype_, blob);
+        } else if (attr.compression_ == TPCCompression::LZF) {
+            if (!ReadCompressedTPCAttribute(*file, attr, num_points, begin,
+                                            end, tensor)) {
+                utility::LogWarning(
+                        "Read TPC failed: unable to decompress attribute "
+                        "\"{}\".",
+                        attr.name_);
+                return false;
+            }
+        } else {
+            utility::LogWarning(
+                    "Read TPC warning: skipping attribute \"{}\", unsupported "
+                    "compression.",
+                    attr.name_);
+            continue;
+        }
+        pointcloud.SetPointAttr(attr.name_, tensor);
+    }
+    return true;
+}
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(1);
+    bool success = ReadPointCloudSubsetFromTPC(filename, pointcloud, {});
+    reporter.Finish();
+    return success;
+}
+
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    const int64_t num_points =
+            pointcloud.HasPoints() ? pointcloud.GetPoints().GetLength() : 0;
+    const bool compressed = bool(params.compressed);
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.GetPointAttr().size());
+
+    // Contiguous host copies of the attributes and their compressed chunks.
+    std::vector<TPCAttribute> attributes;
+    std::vector<core::Tensor> tensors;
+    std::vector<std::vector<std::vector<uint8_t>>> compressed_chunks;
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        const core::Tensor &tensor = kv.second;
+        if (tensor.NumDims() < 1 || tensor.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write TPC failed: attribute \"{}\" has {} instead of {} "
+                    "points.",
+                    kv.first, tensor.NumDims() ? tensor.GetLength() : 0,
+                    num_points);
+            return false;
+        }
+        if (GetTPCDtype(uint8_t(tensor.GetDtype().GetDtypeCode()),
+                        uint8_t(tensor.GetDtype().ByteSize())) ==
+            core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Write TPC failed: unsupported dtype {} of attribute "
+                    "\"{}\".",
+                    tensor.GetDtype().ToString(), kv.first);
+            return false;
+        }
+        TPCAttribute attr;
+        attr.name_ = kv.first;
+        attr.dtype_ = tensor.GetDtype();
+        const core::SizeVector shape = tensor.GetShape();
+        attr.point_shape_ = core::SizeVector(shape.begin() + 1, shape.end());
+        attr.compression_ =
+                compressed ? TPCCompression::LZF : TPCCompression::None;
+        const int64_t row_bytes = std::max<int64_t>(attr.RowBytes(), 1);
+        attr.chunk_points_ =
+                compressed ? std::max<int64_t>(1, kTPCChunkBytes / row_bytes)
+                           : num_points;
+        const core::Device host("CPU:0");
+        tensors.push_back(tensor.GetDevice() == host ? tensor.Contiguous()
+                                                     : tensor.Copy(host));
+
+        std::vector<std::vector<uint8_t>> chunks;
+        if (compressed) {
+            const int64_t num_chunks =
+                    (num_points + attr.chunk_points_ - 1) / attr.chunk_points_;
+            chunks.resize(num_chunks);
+            const uint8_t *src =
+                    static_cast<const uint8_t *>(tensors.back().GetDataPtr());
+#pragma omp parallel for schedule(dynamic)
+            for (int64_t c = 0; c < num_chunks; c++) {
+                const int64_t chunk_begin = c * attr.chunk_points_;
+                const int64_t raw_size =
+                        (std::min(num_points, chunk_begin + attr.chunk_points_) -
+                         chunk_begin) *
+                        attr.RowBytes();
+                const uint8_t *raw = src + chunk_begin * attr.RowBytes();
+                // Only keep the compressed data if it is smaller.
+                chunks[c].resize(raw_size);
+                unsigned int size =
+                        raw_size > 1 ? lzf_compress(raw, (unsigned int)raw_size,
+                                                    chunks[c].data(),
+                                                    (unsigned int)raw_size - 1)
+                                     : 0;
+                if (size == 0) {
+                    std::memcpy(chunks[c].data(), raw, raw_size);
+                } else {
+                    chunks[c].resize(size);
+                }
+            }
+        }
+        attributes.push_back(attr);
+        compressed_chunks.push_back(std::move(chunks));
+    }
+
+    // Lay out the data blocks after the header.
+    int64_t header_size = 8 + 4 + 4 + 8 + 4;
+    for (size_t a = 0; a < attributes.size(); a++) {
+        const TPCAttribute &attr = attributes[a];
+        const int64_t num_chunks =
+                compressed ? int64_t(compressed_chunks[a].size()) : 1;
+        header_size += 4 + attr.name_.size() + 4 + 4 +
+                       8 * attr.point_shape_.size() + 8 + 4 + 16 * num_chunks;
+    }
+    int64_t offset = AlignTPCOffset(header_size);
+    for (size_t a = 0; a < attributes.size(); a++) {
+        TPCAttribute &attr = attributes[a];
+        if (compressed) {
+            for (const std::vector<uint8_t> &chunk : compressed_chunks[a]) {
+                attr.chunks_.push_back({offset, int64_t(chunk.size())});
+                offset += chunk.size();
+            }
+        } else {
+            attr.chunks_.push_back({offset, num_points * attr.RowBytes()});
+            offset += num_points * attr.RowBytes();
+        }
+        offset = AlignTPCOffset(offset);
+    }
+
+    // Tensors read from a .tpc file are backed by its mapping, which must not
+    // be truncated while it is in use. The data is written to a temporary
+    // file that replaces the target at the end.
+    const std::string temp_filename = filename + ".tmp";
+    FILE *file = utility::filesystem::FOpen(temp_filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    std::vector<uint8_t> header;
+    auto append = [&header](const void *data, size_t size) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        header.insert(header.end(), bytes, bytes + size);
+    };
+    const uint32_t num_attributes = uint32_t(attributes.size());
+    append(kTPCMagic, 8);
+    append(&kTPCVersion, 4);
+    append(&kTPCByteOrderMark, 4);
+    append(&num_points, 8);
+    append(&num_attributes, 4);
+    for (const TPCAttribute &attr : attributes) {
+        const uint32_t name_size = uint32_t(attr.name_.size());
+        const uint8_t dtype_info[4] = {uint8_t(attr.dtype_.GetDtypeCode()),
+                                       uint8_t(attr.dtype_.ByteSize()),
+                                       uint8_t(attr.compression_), 0};
+        const uint32_t ndim = uint32_t(attr.point_shape_.size());
+        const uint32_t num_chunks = uint32_t(attr.chunks_.size());
+        append(&name_size, 4);
+        append(attr.name_.data(), name_size);
+        append(dtype_info, 4);
+        append(&ndim, 4);
+        for (int64_t dim : attr.point_shape_) {
+            append(&dim, 8);
+        }
+        append(&attr.chunk_points_, 8);
+        append(&num_chunks, 4);
+        for (const TPCChunk &chunk : attr.chunks_) {
+            append(&chunk.offset_, 8);
+            append(&chunk.size_, 8);
+        }
+    }
+
+    bool success = fwrite(header.data(), 1, header.size(), file) ==
+                   header.size();
+    int64_t position = int64_t(header.size());
+    auto write_at = [&](int64_t target, const void *data, int64_t size) {
+        static const uint8_t zeros[kTPCAlignment] = {};
+        if (target > position) {
+            success = success && fwrite(zeros, 1, target - position, file) ==
+                                         size_t(target - position);
+        }
+        success = success &&
+                  fwrite(data, 1, size, file) == size_t(size);
+        position = target + size;
+    };
+    for (size_t a = 0; a < attributes.size() && success; a++) {
+        const TPCAttribute &attr = attributes[a];
+        if (compressed) {
+            for (size_t c = 0; c < attr.chunks_.size(); c++) {
+                write_at(attr.chunks_[c].offset_,
+                         compressed_chunks[a][c].data(),
+                         attr.chunks_[c].size_);
+            }
+        } else {
+            write_at(attr.chunks_[0].offset_, tensors[a].GetDataPtr(),
+                     attr.chunks_[0].size_);
+        }
+        reporter.Update(a + 1);
+    }
+    success = fclose(file) == 0 && success;
+    if (success) {
+#ifdef _WIN32
+        // rename() does not replace an existing file on Windows.
+        std::remove(filename.c_str());
+#endif
+        success = std::rename(temp_filename.c_str(), filename.c_str()) == 0;
+    }
+    if (!success) {
+        std::remove(temp_filename.c_str());
+        utility::LogWarning("Write TPC failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Copies 3 values starting at \p column of each record into a {N, 3}
+/// Float64 tensor.
+static core::Tensor ColumnsToTensor(const std::vector<double> &values,
+                                    int num_fields,
+                                    int column) {
+    const int64_t num_points = int64_t(values.size()) / num_fields;
+    core::Tensor tensor({num_points, 3}, core::Dtype::Float64);
+    double *tensor_ptr = static_cast<double *>(tensor.GetDataPtr());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        const double *record = &values[num_fields * i + column];
+        tensor_ptr[3 * i + 0] = record[0];
+        tensor_ptr[3 * i + 1] = record[1];
+        tensor_ptr[3 * i + 2] = record[2];
+    }
+    return tensor;
+}
+
+/// Reads a file with \p num_fields numbers per line into \p pointcloud. The
+/// first three numbers are the point, the next three are stored as the
+/// attribute \p attr_name if it is not empty. Non-finite points are dropped
+/// while parsing, as requested by \p params.
+static bool ReadPointCloudFromASCII(
+        const std::string &filename,
+        const std::string &format_name,
+        int num_fields,
+        const std::string &attr_name,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
+            utility::LogWarning("Read {} failed: unable to open file: {}",
+                                format_name, filename);
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(file.GetSize());
+
+        std::vector<double> values = open3d::io::ParseASCIIRecords(
+                reinterpret_cast<const char *>(file.GetData()),
+                file.GetSize(), num_fields, false, -1,
+                open3d::io::CreateFiniteRecordFilter(
+                        3, params.remove_nan_points,
+                        params.remove_infinite_points),
+                [&](int64_t bytes) { reporter.Update(bytes); });
+
+        pointcloud.Clear();
+        pointcloud.SetPoints(ColumnsToTensor(values, num_fields, 0));
+        if (!attr_name.empty()) {
+            pointcloud.SetPointAttr(attr_name,
+                                    ColumnsToTensor(values, num_fields, 3));
+        }
+        reporter.Finish();
+
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read {} failed with exception: {}", format_name,
+                            e.what());
+        return false;
+    }
+}
+
+bool ReadPointCloudFromXYZ(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    return ReadPointCloudFromASCII(filename, "XYZ", 3, "", pointcloud, params);
+}
+
+bool ReadPointCloudFromXYZN(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const open3d::io::ReadPointCloudOption &params) {
+    return ReadPointCloudFromASCII(filename, "XYZN", 6, "normals", pointcloud,
+                                   params);
+}
+
+bool ReadPointCloudFromXYZRGB(const std::string &filename,
+                              geometry::PointCloud &pointcloud,
+                              const open3d::io::ReadPointCloudOption &params) {
+    return ReadPointCloudFromASCII(filename, "XYZRGB", 6, "colors",
+                                   pointcloud, params);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
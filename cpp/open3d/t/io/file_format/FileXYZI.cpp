@@ -25,10 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
@@ -46,15 +48,23 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(file.GetSize());
+
+        std::vector<double> values = open3d::io::ParseASCIIRecords(
+                reinterpret_cast<const char *>(file.GetData()),
+                file.GetSize(), 4, false, -1,
+                open3d::io::CreateFiniteRecordFilter(
+                        3, params.remove_nan_points,
+                        params.remove_infinite_points),
+                [&](int64_t bytes) { reporter.Update(bytes); });
+        const int64_t num_points = int64_t(values.size()) / 4;
 
         pointcloud.Clear();
         core::Tensor points({num_points, 3}, core::Dtype::Float64);
@@ -62,20 +72,12 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
         double *points_ptr = static_cast<double *>(points.GetDataPtr());
         double *intensities_ptr =
                 static_cast<double *>(intensities.GetDataPtr());
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            points_ptr[3 * i + 0] = values[4 * i + 0];
+            points_ptr[3 * i + 1] = values[4 * i + 1];
+            points_ptr[3 * i + 2] = values[4 * i + 2];
+            intensities_ptr[i] = values[4 * i + 3];
         }
         pointcloud.SetPoints(points);
         pointcloud.SetPointAttr("intensities", intensities);
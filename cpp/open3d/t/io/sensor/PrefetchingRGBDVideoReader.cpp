@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/PrefetchingRGBDVideoReader.h"
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+PrefetchingRGBDVideoReader::PrefetchingRGBDVideoReader(
+        const std::shared_ptr<RGBDVideoReader> &reader, size_t buffer_size)
+    : reader_(reader), buffer_size_(buffer_size) {
+    if (!reader_) {
+        utility::LogError("Null reader.");
+    }
+    if (reader_->IsOpened()) {
+        StartPrefetch();
+    }
+}
+
+PrefetchingRGBDVideoReader::~PrefetchingRGBDVideoReader() {
+    prefetcher_.reset();
+}
+
+void PrefetchingRGBDVideoReader::StartPrefetch() {
+    prefetcher_.reset();
+    std::shared_ptr<RGBDVideoReader> reader = reader_;
+    prefetcher_.reset(new utility::Prefetcher<Frame>(
+            [reader](Frame &frame) {
+                if (reader->IsEOF()) {
+                    return false;
+                }
+                frame.image_ = reader->NextFrame();
+                frame.timestamp_ = reader->GetTimestamp();
+                return !frame.image_.IsEmpty();
+            },
+            buffer_size_));
+}
+
+bool PrefetchingRGBDVideoReader::IsEOF() const {
+    return !prefetcher_ || !prefetcher_->HasNext();
+}
+
+bool PrefetchingRGBDVideoReader::Open(const std::string &filename) {
+    prefetcher_.reset();
+    timestamp_ = 0;
+    if (!reader_->Open(filename)) {
+        return false;
+    }
+    StartPrefetch();
+    return true;
+}
+
+void PrefetchingRGBDVideoReader::Close() {
+    prefetcher_.reset();
+    timestamp_ = 0;
+    reader_->Close();
+}
+
+bool PrefetchingRGBDVideoReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    // The background thread must not read while the wrapped reader seeks.
+    prefetcher_.reset();
+    const bool success = reader_->SeekTimestamp(timestamp);
+    StartPrefetch();
+    return success;
+}
+
+t::geometry::RGBDImage PrefetchingRGBDVideoReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    Frame frame;
+    if (!prefetcher_ || !prefetcher_->Next(frame)) {
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    timestamp_ = frame.timestamp_;
+    return frame.image_;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+#include "open3d/utility/Prefetcher.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PrefetchingRGBDVideoReader
+///
+/// Reads frames of another RGBD video reader on a background thread, so
+/// decoding the next frames overlaps with processing the current one, e.g.
+/// TSDF integration. At most \p buffer_size decoded frames are kept in memory.
+///
+/// \code
+/// t::io::PrefetchingRGBDVideoReader reader(
+///         t::io::RGBDVideoReader::Create(filename));
+/// while (!reader.IsEOF()) {
+///     t::geometry::RGBDImage frame = reader.NextFrame();
+///     // Integrate frame.
+/// }
+/// \endcode
+class PrefetchingRGBDVideoReader : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 8;
+
+    /// Constructor
+    ///
+    /// \param reader Reader to prefetch from. If it is already opened, frames
+    /// are read from its current position.
+    /// \param buffer_size (optional) Max number of frames read ahead.
+    explicit PrefetchingRGBDVideoReader(
+            const std::shared_ptr<RGBDVideoReader> &reader,
+            size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+    PrefetchingRGBDVideoReader(const PrefetchingRGBDVideoReader &) = delete;
+    PrefetchingRGBDVideoReader &operator=(const PrefetchingRGBDVideoReader &) =
+            delete;
+    virtual ~PrefetchingRGBDVideoReader();
+
+    /// Check If the RGBD video file is opened.
+    virtual bool IsOpened() const override { return reader_->IsOpened(); }
+
+    /// Check if the RGBD video file is all read. Waits until the next frame is
+    /// decoded if necessary.
+    virtual bool IsEOF() const override;
+
+    /// Open an RGBD video playback with the wrapped reader.
+    ///
+    /// \param filename Path to the RGBD video file.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Close the opened RGBD video playback.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the playback.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return reader_->GetMetadata();
+    }
+
+    /// Get reference to the metadata of the RGBD video playback.
+    virtual RGBDVideoMetadata &GetMetadata() override {
+        return reader_->GetMetadata();
+    }
+
+    /// Seek to the timestamp (in us). Frames read ahead are discarded.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get timestamp of the last frame returned by NextFrame() (in us).
+    virtual uint64_t GetTimestamp() const override { return timestamp_; }
+
+    /// Return the next prefetched frame, an empty RGBDImage at the end of the
+    /// video.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return filename being read.
+    virtual std::string GetFilename() const override {
+        return reader_->GetFilename();
+    }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    struct Frame {
+        t::geometry::RGBDImage image_;
+        uint64_t timestamp_ = 0;
+    };
+
+    /// Starts reading frames from the current position of reader_.
+    void StartPrefetch();
+
+    std::shared_ptr<RGBDVideoReader> reader_;
+    size_t buffer_size_;
+    std::unique_ptr<utility::Prefetcher<Frame>> prefetcher_;
+    uint64_t timestamp_ = 0;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
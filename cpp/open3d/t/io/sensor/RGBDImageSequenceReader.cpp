@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
+
+#include <algorithm>
+
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static std::vector<std::string> ListImageFiles(const std::string &directory) {
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(directory, filenames);
+    std::vector<std::string> images;
+    for (const std::string &filename : filenames) {
+        const std::string ext =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+        if (ext == "png" || ext == "jpg" || ext == "jpeg") {
+            images.push_back(filename);
+        }
+    }
+    std::sort(images.begin(), images.end());
+    return images;
+}
+
+/// Reads the color and depth images of a frame in parallel.
+static bool ReadRGBDImage(const std::string &color_file,
+                          const std::string &depth_file,
+                          t::geometry::RGBDImage &rgbd) {
+    t::geometry::Image color, depth;
+    bool color_success = false, depth_success = false;
+#pragma omp parallel sections
+    {
+#pragma omp section
+        { color_success = ReadImage(color_file, color); }
+#pragma omp section
+        { depth_success = ReadImage(depth_file, depth); }
+    }
+    if (!color_success || !depth_success) {
+        utility::LogWarning("Read frame failed: unable to read {} or {}.",
+                            color_file, depth_file);
+        return false;
+    }
+    rgbd = t::geometry::RGBDImage(color, depth);
+    return true;
+}
+
+bool RGBDImageSequenceReader::Open(const std::string &filename) {
+    Close();
+    const std::string color_dir = filename + "/color";
+    const std::string depth_dir = filename + "/depth";
+    if (!utility::filesystem::DirectoryExists(color_dir) ||
+        !utility::filesystem::DirectoryExists(depth_dir)) {
+        utility::LogWarning(
+                "Open image sequence failed: {} has no color and depth "
+                "subdirectories.",
+                filename);
+        return false;
+    }
+    color_files_ = ListImageFiles(color_dir);
+    depth_files_ = ListImageFiles(depth_dir);
+    if (color_files_.size() != depth_files_.size()) {
+        utility::LogWarning(
+                "{} color and {} depth images, extra images are ignored.",
+                color_files_.size(), depth_files_.size());
+        const size_t num_frames =
+                std::min(color_files_.size(), depth_files_.size());
+        color_files_.resize(num_frames);
+        depth_files_.resize(num_frames);
+    }
+    t::geometry::RGBDImage first_frame;
+    if (color_files_.empty() ||
+        !ReadRGBDImage(color_files_[0], depth_files_[0], first_frame)) {
+        utility::LogWarning("Open image sequence failed: no frames in {}.",
+                            filename);
+        Close();
+        return false;
+    }
+
+    metadata_ = RGBDVideoMetadata();
+    metadata_.fps_ = 0.0;
+    metadata_.depth_scale_ = 1000.0;
+    const std::string metadata_file = filename + "/intrinsic.json";
+    if (utility::filesystem::FileExists(metadata_file) &&
+        !open3d::io::ReadIJsonConvertible(metadata_file, metadata_)) {
+        utility::LogWarning("Unable to read metadata from {}.", metadata_file);
+    }
+    if (metadata_.fps_ <= 0.0) {
+        metadata_.fps_ = 30.0;
+    }
+    metadata_.width_ = int(first_frame.color_.GetCols());
+    metadata_.height_ = int(first_frame.color_.GetRows());
+    metadata_.color_dt_ = first_frame.color_.GetDtype();
+    metadata_.depth_dt_ = first_frame.depth_.GetDtype();
+    metadata_.color_channels_ = uint8_t(first_frame.color_.GetChannels());
+    metadata_.stream_length_usec_ = GetFrameTimestamp(color_files_.size());
+
+    directory_ = filename;
+    next_frame_ = 0;
+    is_opened_ = true;
+    return true;
+}
+
+void RGBDImageSequenceReader::Close() {
+    is_opened_ = false;
+    directory_.clear();
+    color_files_.clear();
+    depth_files_.clear();
+    next_frame_ = 0;
+}
+
+uint64_t RGBDImageSequenceReader::GetFrameTimestamp(size_t index) const {
+    return uint64_t(double(index) * 1e6 / metadata_.fps_);
+}
+
+bool RGBDImageSequenceReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    if (timestamp >= metadata_.stream_length_usec_) {
+        utility::LogWarning("Timestamp {} exceeds maximum {} (us).", timestamp,
+                            metadata_.stream_length_usec_);
+        return false;
+    }
+    next_frame_ = std::min(size_t(double(timestamp) * metadata_.fps_ / 1e6),
+                           color_files_.size() - 1);
+    return true;
+}
+
+uint64_t RGBDImageSequenceReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    return next_frame_ == 0 ? 0 : GetFrameTimestamp(next_frame_ - 1);
+}
+
+t::geometry::RGBDImage RGBDImageSequenceReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (IsEOF()) {
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    t::geometry::RGBDImage frame;
+    const size_t index = next_frame_++;
+    ReadRGBDImage(color_files_[index], depth_files_[index], frame);
+    return frame;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDImageSequenceReader
+///
+/// Reads a directory of color and depth images as an RGBD video, in the layout
+/// written by RGBDVideoReader::SaveFrames():
+///  - color/: PNG or JPG color images,
+///  - depth/: PNG depth images,
+///  - intrinsic.json (optional): RGBDVideoMetadata of the sequence.
+/// Images are paired in the order of their file names. The color and depth
+/// images of a frame are decoded in parallel. Frame timestamps are derived
+/// from the frame rate of the metadata, 30 fps if there is none.
+class RGBDImageSequenceReader : public RGBDVideoReader {
+public:
+    RGBDImageSequenceReader() {}
+    virtual ~RGBDImageSequenceReader() {}
+
+    /// Check If the image directory is opened.
+    virtual bool IsOpened() const override { return is_opened_; }
+
+    /// Check if all frames are read.
+    virtual bool IsEOF() const override {
+        return next_frame_ >= color_files_.size();
+    }
+
+    /// Open an image sequence.
+    ///
+    /// \param filename Path to the directory with the color and depth
+    /// subdirectories.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Close the opened image sequence.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the image sequence.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+
+    /// Get reference to the metadata of the image sequence.
+    virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+
+    /// Seek to the frame at the timestamp (in us).
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get timestamp of the last frame read (in us).
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Read the next frame and return the RGBDImage object, an empty RGBDImage
+    /// after the last frame.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return the directory being read.
+    virtual std::string GetFilename() const override { return directory_; }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    /// Timestamp of frame \p index (in us).
+    uint64_t GetFrameTimestamp(size_t index) const;
+
+    std::string directory_;
+    RGBDVideoMetadata metadata_;
+    std::vector<std::string> color_files_;
+    std::vector<std::string> depth_files_;
+    size_t next_frame_ = 0;
+    bool is_opened_ = false;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -89,6 +89,7 @@ public:
     virtual std::string ToString() const;
 
     /// Factory function to create object based on RGBD video file type.
+    /// Directories are read as image sequences, see RGBDImageSequenceReader.
     static std::shared_ptr<RGBDVideoReader> Create(const std::string &filename);
 };
 
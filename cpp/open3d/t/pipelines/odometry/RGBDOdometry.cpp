@@ -0,0 +1,301 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <Eigen/Core>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/kernel/GeneralEW.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+static core::Tensor ScalarTensor(float value, const core::Device &device) {
+    return core::Tensor(std::vector<float>{value}, {}, core::Dtype::Float32,
+                        device);
+}
+
+/// Solves the 6x6 system reduced by the odometry kernels and returns the
+/// update as a 4x4 transformation on \p device. Returns false and the
+/// identity if the system is degenerate, as the legacy odometry does.
+static std::tuple<bool, core::Tensor> SolveReduction(
+        const core::Tensor &reduction, const core::Device &device) {
+    core::Tensor reduction_cpu = reduction.Copy(core::Device("CPU:0"));
+    const float *reduction_ptr =
+            static_cast<const float *>(reduction_cpu.GetDataPtr());
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int offset = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            JTJ(i, j) = JTJ(j, i) = reduction_ptr[offset++];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        JTr(i) = reduction_ptr[21 + i];
+    }
+    const double residual = reduction_ptr[27];
+    const int64_t count = static_cast<int64_t>(reduction_ptr[28]);
+    if (count < 6) {
+        utility::LogDebug(
+                "[RGBDOdometry] only {} correspondences, at least 6 are "
+                "required.",
+                count);
+        return std::make_tuple(
+                false, core::Tensor::Eye(4, core::Dtype::Float32, device));
+    }
+    utility::LogDebug("[RGBDOdometry] {} correspondences, residual {}.", count,
+                      residual / count);
+
+    bool is_success;
+    Eigen::Matrix4d update;
+    std::tie(is_success, update) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    if (!is_success) {
+        utility::LogDebug("[RGBDOdometry] no solution.");
+        return std::make_tuple(
+                false, core::Tensor::Eye(4, core::Dtype::Float32, device));
+    }
+    return std::make_tuple(true,
+                           core::eigen_converter::EigenMatrixToTensor(update)
+                                   .To(core::Dtype::Float32)
+                                   .Copy(device));
+}
+
+core::Tensor CreateVertexMap(const core::Tensor &depth,
+                             const core::Tensor &intrinsics,
+                             float depth_max) {
+    core::Device device = depth.GetDevice();
+    std::unordered_map<std::string, core::Tensor> srcs = {
+            {"depth", depth.Contiguous()},
+            {"intrinsics", intrinsics.To(core::Dtype::Float32).Copy(device)},
+            {"depth_max", ScalarTensor(depth_max, device)}};
+    std::unordered_map<std::string, core::Tensor> dsts;
+    core::kernel::GeneralEW(srcs, dsts,
+                            core::kernel::GeneralEWOpCode::VertexMap);
+    return dsts.at("vertex_map");
+}
+
+core::Tensor CreateNormalMap(const core::Tensor &vertex_map) {
+    std::unordered_map<std::string, core::Tensor> srcs = {
+            {"vertex_map", vertex_map.Contiguous()}};
+    std::unordered_map<std::string, core::Tensor> dsts;
+    core::kernel::GeneralEW(srcs, dsts,
+                            core::kernel::GeneralEWOpCode::NormalMap);
+    return dsts.at("normal_map");
+}
+
+std::tuple<bool, core::Tensor> ComputePosePointToPlane(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        float depth_diff) {
+    core::Device device = source_vertex_map.GetDevice();
+    std::unordered_map<std::string, core::Tensor> srcs = {
+            {"source_vertex_map", source_vertex_map.Contiguous()},
+            {"target_vertex_map", target_vertex_map.Contiguous()},
+            {"target_normal_map", target_normal_map.Contiguous()},
+            {"intrinsics", intrinsics.To(core::Dtype::Float32).Copy(device)},
+            {"extrinsics",
+             init_source_to_target.To(core::Dtype::Float32).Copy(device)},
+            {"depth_diff", ScalarTensor(depth_diff, device)}};
+    std::unordered_map<std::string, core::Tensor> dsts;
+    core::kernel::GeneralEW(
+            srcs, dsts, core::kernel::GeneralEWOpCode::OdometryPointToPlane);
+    return SolveReduction(dsts.at("reduction"), device);
+}
+
+std::tuple<bool, core::Tensor> ComputePoseHybrid(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        float depth_diff) {
+    core::Device device = source_vertex_map.GetDevice();
+    std::unordered_map<std::string, core::Tensor> srcs = {
+            {"source_vertex_map", source_vertex_map.Contiguous()},
+            {"source_intensity", source_intensity.Contiguous()},
+            {"target_vertex_map", target_vertex_map.Contiguous()},
+            {"target_intensity", target_intensity.Contiguous()},
+            {"intrinsics", intrinsics.To(core::Dtype::Float32).Copy(device)},
+            {"extrinsics",
+             init_source_to_target.To(core::Dtype::Float32).Copy(device)},
+            {"depth_diff", ScalarTensor(depth_diff, device)}};
+    std::unordered_map<std::string, core::Tensor> dsts;
+    core::kernel::GeneralEW(srcs, dsts,
+                            core::kernel::GeneralEWOpCode::OdometryHybrid);
+    return SolveReduction(dsts.at("reduction"), device);
+}
+
+/// Converts a color image to a Float32 intensity image in [0, 1].
+static core::Tensor CreateIntensity(const t::geometry::Image &color) {
+    core::Tensor color_f = color.AsTensor().To(core::Dtype::Float32);
+    if (color.GetDtype() == core::Dtype::UInt8) {
+        color_f.Div_(255.0f);
+    }
+    if (color.GetChannels() == 1) {
+        return color_f.Contiguous();
+    } else if (color.GetChannels() == 3) {
+        return (color_f.Slice(2, 0, 1) * 0.299f +
+                color_f.Slice(2, 1, 2) * 0.587f +
+                color_f.Slice(2, 2, 3) * 0.114f)
+                .Contiguous();
+    }
+    utility::LogError("[RGBDOdometry] Unsupported number of channels {}.",
+                      color.GetChannels());
+}
+
+/// Halves the resolution by averaging 2x2 blocks.
+static core::Tensor PyrDownIntensity(const core::Tensor &intensity) {
+    int64_t rows = intensity.GetShape(0) / 2 * 2;
+    int64_t cols = intensity.GetShape(1) / 2 * 2;
+    core::Tensor even_rows = intensity.Slice(0, 0, rows, 2);
+    core::Tensor odd_rows = intensity.Slice(0, 1, rows, 2);
+    return ((even_rows.Slice(1, 0, cols, 2) + even_rows.Slice(1, 1, cols, 2) +
+             odd_rows.Slice(1, 0, cols, 2) + odd_rows.Slice(1, 1, cols, 2)) *
+            0.25f)
+            .Contiguous();
+}
+
+/// Halves the resolution by subsampling, so that depth discontinuities are not
+/// blurred.
+static core::Tensor PyrDownDepth(const core::Tensor &depth) {
+    int64_t rows = depth.GetShape(0) / 2 * 2;
+    int64_t cols = depth.GetShape(1) / 2 * 2;
+    return depth.Slice(0, 0, rows, 2).Slice(1, 0, cols, 2).Contiguous();
+}
+
+core::Tensor RGBDOdometryMultiScale(const t::geometry::RGBDImage &source,
+                                    const t::geometry::RGBDImage &target,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &init_source_to_target,
+                                    float depth_scale,
+                                    float depth_max,
+                                    float depth_diff,
+                                    const std::vector<int> &iterations,
+                                    Method method) {
+    core::Device device = source.depth_.GetDevice();
+    if (target.depth_.GetDevice() != device) {
+        utility::LogError(
+                "[RGBDOdometry] Target device {} != source device {}.",
+                target.depth_.GetDevice().ToString(), device.ToString());
+    }
+    if (source.depth_.GetRows() != target.depth_.GetRows() ||
+        source.depth_.GetCols() != target.depth_.GetCols()) {
+        utility::LogError(
+                "[RGBDOdometry] Source and target images must have the same "
+                "size.");
+    }
+    intrinsics.AssertShape({3, 3});
+    init_source_to_target.AssertShape({4, 4});
+    const int num_levels = static_cast<int>(iterations.size());
+    if (num_levels == 0) {
+        utility::LogError("[RGBDOdometry] iterations must not be empty.");
+    }
+
+    // Image pyramids, level 0 is the finest.
+    std::vector<core::Tensor> source_depth(num_levels);
+    std::vector<core::Tensor> target_depth(num_levels);
+    std::vector<core::Tensor> source_intensity(num_levels);
+    std::vector<core::Tensor> target_intensity(num_levels);
+    std::vector<core::Tensor> level_intrinsics(num_levels);
+    // To() does not copy Float32 depth, so do not scale it in place.
+    source_depth[0] =
+            source.depth_.AsTensor().To(core::Dtype::Float32) / depth_scale;
+    target_depth[0] =
+            target.depth_.AsTensor().To(core::Dtype::Float32) / depth_scale;
+    level_intrinsics[0] = intrinsics.To(core::Dtype::Float32)
+                                  .Copy(core::Device("CPU:0"));
+    if (method == Method::Hybrid) {
+        source_intensity[0] = CreateIntensity(source.color_);
+        target_intensity[0] = CreateIntensity(target.color_);
+    }
+    for (int level = 1; level < num_levels; ++level) {
+        source_depth[level] = PyrDownDepth(source_depth[level - 1]);
+        target_depth[level] = PyrDownDepth(target_depth[level - 1]);
+        level_intrinsics[level] = level_intrinsics[level - 1] * 0.5f;
+        level_intrinsics[level][2][2] = 1.0f;
+        if (method == Method::Hybrid) {
+            source_intensity[level] =
+                    PyrDownIntensity(source_intensity[level - 1]);
+            target_intensity[level] =
+                    PyrDownIntensity(target_intensity[level - 1]);
+        }
+    }
+
+    core::Tensor transformation =
+            init_source_to_target.To(core::Dtype::Float32).Copy(device);
+    for (int level = num_levels - 1; level >= 0; --level) {
+        const core::Tensor &K = level_intrinsics[level];
+        core::Tensor source_vertex_map =
+                CreateVertexMap(source_depth[level], K, depth_max);
+        core::Tensor target_vertex_map =
+                CreateVertexMap(target_depth[level], K, depth_max);
+        core::Tensor target_normal_map;
+        if (method == Method::PointToPlane) {
+            target_normal_map = CreateNormalMap(target_vertex_map);
+        }
+
+        for (int iter = 0; iter < iterations[num_levels - 1 - level]; ++iter) {
+            bool is_success;
+            core::Tensor update;
+            if (method == Method::PointToPlane) {
+                std::tie(is_success, update) = ComputePosePointToPlane(
+                        source_vertex_map, target_vertex_map,
+                        target_normal_map, K, transformation, depth_diff);
+            } else {
+                std::tie(is_success, update) = ComputePoseHybrid(
+                        source_vertex_map, source_intensity[level],
+                        target_vertex_map, target_intensity[level], K,
+                        transformation, depth_diff);
+            }
+            if (!is_success) {
+                // Keep the current estimate and refine it on the next level.
+                utility::LogWarning(
+                        "[RGBDOdometry] no solution on level {}, iteration {}.",
+                        level, iter);
+                break;
+            }
+            transformation = update.Matmul(transformation);
+        }
+    }
+    return transformation;
+}
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+/// Energy minimized by the odometry.
+enum class Method {
+    /// Point to plane distance between the source and target vertex maps.
+    PointToPlane,
+    /// Intensity and depth differences, as in the legacy
+    /// RGBDOdometryJacobianFromHybridTerm.
+    Hybrid,
+};
+
+/// \brief Create a vertex map from a depth image.
+///
+/// \param depth Depth in meters, a tensor of shape {rows, cols, 1} and dtype
+/// Float32.
+/// \param intrinsics Pinhole camera matrix, a tensor of shape {3, 3} and dtype
+/// Float32.
+/// \param depth_max Depth values larger than this are invalid.
+/// \return Vertex map of shape {rows, cols, 3} in camera coordinates, invalid
+/// pixels are set to zero.
+core::Tensor CreateVertexMap(const core::Tensor &depth,
+                             const core::Tensor &intrinsics,
+                             float depth_max = 3.0f);
+
+/// \brief Create a normal map from a vertex map.
+///
+/// \param vertex_map Vertex map of shape {rows, cols, 3} and dtype Float32.
+/// \return Normal map of shape {rows, cols, 3}, pointing towards the camera.
+/// Normals at invalid pixels are set to zero.
+core::Tensor CreateNormalMap(const core::Tensor &vertex_map);
+
+/// \brief Compute one Gauss-Newton step of point to plane odometry.
+///
+/// Correspondences are found by projecting the source vertices into the
+/// target image. Projection, residuals and the reduction of the 6x6 system are
+/// fused in one kernel.
+///
+/// \param source_vertex_map Vertex map of the source image.
+/// \param target_vertex_map Vertex map of the target image.
+/// \param target_normal_map Normal map of the target image.
+/// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+/// \param init_source_to_target Current estimate of the transformation from
+/// the source to the target camera, a tensor of shape {4, 4}.
+/// \param depth_diff Maximum depth difference of a correspondence.
+/// \return A success flag and the update of shape {4, 4} and dtype Float32,
+/// to be multiplied from the left to \p init_source_to_target. With fewer
+/// than 6 correspondences or no solution, the flag is false and the update is
+/// the identity.
+std::tuple<bool, core::Tensor> ComputePosePointToPlane(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_normal_map,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        float depth_diff);
+
+/// \brief Compute one Gauss-Newton step of hybrid (intensity and depth)
+/// odometry.
+///
+/// \param source_vertex_map Vertex map of the source image.
+/// \param source_intensity Intensity of the source image, a tensor of shape
+/// {rows, cols, 1} and dtype Float32.
+/// \param target_vertex_map Vertex map of the target image.
+/// \param target_intensity Intensity of the target image.
+/// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+/// \param init_source_to_target Current estimate of the transformation from
+/// the source to the target camera, a tensor of shape {4, 4}.
+/// \param depth_diff Maximum depth difference of a correspondence.
+/// \return A success flag and the update of shape {4, 4} and dtype Float32,
+/// to be multiplied from the left to \p init_source_to_target. With fewer
+/// than 6 correspondences or no solution, the flag is false and the update is
+/// the identity.
+std::tuple<bool, core::Tensor> ComputePoseHybrid(
+        const core::Tensor &source_vertex_map,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_vertex_map,
+        const core::Tensor &target_intensity,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        float depth_diff);
+
+/// \brief Estimate the rigid motion between two RGBD images with a
+/// coarse-to-fine image pyramid.
+///
+/// \param source Source RGBD image. The color image is either 3 channel UInt8
+/// or 1 channel Float32 intensity, the depth image is UInt16 or Float32.
+/// \param target Target RGBD image, of the same size as the source.
+/// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+/// \param init_source_to_target Initial 4x4 transformation from the source to
+/// the target camera.
+/// \param depth_scale Depth values are divided by this to obtain meters.
+/// \param depth_max Depth values (in meters) larger than this are invalid.
+/// \param depth_diff Maximum depth difference of a correspondence.
+/// \param iterations Number of iterations per pyramid level, from the coarsest
+/// to the finest level.
+/// \param method Energy to minimize.
+/// A level on which a step has no solution keeps the estimate of the previous
+/// steps and continues with the next finer level.
+/// \return The 4x4 transformation from the source to the target camera, dtype
+/// Float32, on the device of the images.
+core::Tensor RGBDOdometryMultiScale(
+        const t::geometry::RGBDImage &source,
+        const t::geometry::RGBDImage &target,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float32, core::Device("CPU:0")),
+        float depth_scale = 1000.0f,
+        float depth_max = 3.0f,
+        float depth_diff = 0.07f,
+        const std::vector<int> &iterations = {10, 5, 3},
+        Method method = Method::Hybrid);
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include <Eigen/Sparse>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace utility {
@@ -166,34 +167,40 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         std::function<void(int, VecType &, double &, double &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#pragma omp parallel
+    // Every thread accumulates into its own slot, the slots are reduced in
+    // thread order afterwards so that the result is deterministic. Nested in
+    // another parallel region, the region runs single threaded.
+    const int num_threads = InParallel() ? 1 : GetMaxThreads();
+    std::vector<MatType, Eigen::aligned_allocator<MatType>> JTJ_private(
+            num_threads, MatType::Zero());
+    std::vector<VecType, Eigen::aligned_allocator<VecType>> JTr_private(
+            num_threads, VecType::Zero());
+    std::vector<double> r2_sum_private(num_threads, 0.0);
+#pragma omp parallel num_threads(num_threads)
     {
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
+        const int thread_id = GetThreadNum();
+        MatType &JTJ_thread = JTJ_private[thread_id];
+        VecType &JTr_thread = JTr_private[thread_id];
+        double r2_sum_thread = 0.0;
         VecType J_r;
         double r;
         double w = 0.0;
 #pragma omp for nowait
         for (int i = 0; i < iteration_num; i++) {
             f(i, J_r, r, w);
-            JTJ_private.noalias() += J_r * w * J_r.transpose();
-            JTr_private.noalias() += J_r * w * r;
-            r2_sum_private += r * r;
-        }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
+            JTJ_thread.noalias() += J_r * w * J_r.transpose();
+            JTr_thread.noalias() += J_r * w * r;
+            r2_sum_thread += r * r;
         }
+        r2_sum_private[thread_id] = r2_sum_thread;
+    }
+    MatType JTJ = MatType::Zero();
+    VecType JTr = VecType::Zero();
+    double r2_sum = 0.0;
+    for (int i = 0; i < num_threads; i++) {
+        JTJ += JTJ_private[i];
+        JTr += JTr_private[i];
+        r2_sum += r2_sum_private[i];
     }
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
@@ -211,18 +218,18 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
                      std::vector<double> &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#pragma omp parallel
+    const int num_threads = InParallel() ? 1 : GetMaxThreads();
+    std::vector<MatType, Eigen::aligned_allocator<MatType>> JTJ_private(
+            num_threads, MatType::Zero());
+    std::vector<VecType, Eigen::aligned_allocator<VecType>> JTr_private(
+            num_threads, VecType::Zero());
+    std::vector<double> r2_sum_private(num_threads, 0.0);
+#pragma omp parallel num_threads(num_threads)
     {
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
+        const int thread_id = GetThreadNum();
+        MatType &JTJ_thread = JTJ_private[thread_id];
+        VecType &JTr_thread = JTr_private[thread_id];
+        double r2_sum_thread = 0.0;
         std::vector<double> r;
         std::vector<double> w;
         std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
@@ -230,17 +237,20 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         for (int i = 0; i < iteration_num; i++) {
             f(i, J_r, r, w);
             for (int j = 0; j < (int)r.size(); j++) {
-                JTJ_private.noalias() += J_r[j] * w[j] * J_r[j].transpose();
-                JTr_private.noalias() += J_r[j] * w[j] * r[j];
-                r2_sum_private += r[j] * r[j];
+                JTJ_thread.noalias() += J_r[j] * w[j] * J_r[j].transpose();
+                JTr_thread.noalias() += J_r[j] * w[j] * r[j];
+                r2_sum_thread += r[j] * r[j];
             }
         }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-        }
+        r2_sum_private[thread_id] = r2_sum_thread;
+    }
+    MatType JTJ = MatType::Zero();
+    VecType JTr = VecType::Zero();
+    double r2_sum = 0.0;
+    for (int i = 0; i < num_threads; i++) {
+        JTJ += JTJ_private[i];
+        JTr += JTr_private[i];
+        r2_sum += r2_sum_private[i];
     }
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
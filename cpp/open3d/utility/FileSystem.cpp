@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -556,6 +557,103 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifdef _WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    file_handle_ = file;
+    size_ = static_cast<int64_t>(size.QuadPart);
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingW(
+                file, NULL, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0,
+                0, NULL);
+        if (!mapping) {
+            Close();
+            return false;
+        }
+        mapping_handle_ = mapping;
+        data_ = static_cast<const uint8_t *>(
+                MapViewOfFile(mapping,
+                              copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0,
+                              0, 0));
+        if (!data_) {
+            Close();
+            return false;
+        }
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<int64_t>(st.st_size);
+    if (size_ > 0) {
+        int prot = copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ;
+        void *data = mmap(nullptr, static_cast<size_t>(size_), prot,
+                          MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            size_ = 0;
+            return false;
+        }
+        data_ = static_cast<const uint8_t *>(data);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+#endif
+    is_open_ = true;
+    copy_on_write_ = copy_on_write;
+    return true;
+}
+
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+    }
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if (data_) {
+        munmap(const_cast<uint8_t *>(data_), static_cast<size_t>(size_));
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+    copy_on_write_ = false;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -147,6 +148,49 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII read-only memory map of a whole file. Pages are loaded by the OS on
+/// first access, so large files are not copied into memory up front and can
+/// be read from multiple threads.
+class MappedFile {
+public:
+    MappedFile() {}
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// Map a file. Returns false if the file cannot be opened or mapped.
+    /// With \p copy_on_write, the mapped pages can be modified through
+    /// GetMutableData() without changing the file.
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Unmap the file.
+    void Close();
+
+    bool IsOpen() const { return is_open_; }
+
+    /// Returns the mapped bytes, nullptr for an empty file.
+    const uint8_t *GetData() const { return data_; }
+
+    /// Returns the mapped bytes of a copy-on-write mapping, nullptr otherwise.
+    uint8_t *GetMutableData() const {
+        return copy_on_write_ ? const_cast<uint8_t *>(data_) : nullptr;
+    }
+
+    /// Returns the file size in bytes.
+    int64_t GetSize() const { return size_; }
+
+private:
+    bool is_open_ = false;
+    bool copy_on_write_ = false;
+    const uint8_t *data_ = nullptr;
+    int64_t size_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
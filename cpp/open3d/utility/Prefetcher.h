@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace open3d {
+namespace utility {
+
+/// \class Prefetcher
+///
+/// \brief Produces items on a background thread, at most \p capacity items
+/// ahead of the consumer.
+///
+/// The producer function fills its argument and returns false when there are
+/// no more items. Memory is bounded by \p capacity buffered items plus the
+/// one being produced. Exceptions thrown by the producer are rethrown by
+/// Next().
+template <typename T>
+class Prefetcher {
+public:
+    Prefetcher(const std::function<bool(T &)> &produce, size_t capacity)
+        : produce_(produce), capacity_(capacity > 0 ? capacity : 1) {
+        thread_ = std::thread(&Prefetcher::Run, this);
+    }
+
+    Prefetcher(const Prefetcher &) = delete;
+    Prefetcher &operator=(const Prefetcher &) = delete;
+
+    /// Stops the producer after the item it is working on.
+    ~Prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+    /// Waits until the next item is produced. Returns false if the producer
+    /// has finished and all items are consumed.
+    bool HasNext() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !queue_.empty() || done_; });
+        return !queue_.empty() || exception_;
+    }
+
+    /// Waits for the next item. Returns false once all items are consumed.
+    bool Next(T &item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !queue_.empty() || done_; });
+        if (queue_.empty()) {
+            if (exception_) {
+                std::exception_ptr exception = exception_;
+                exception_ = nullptr;
+                std::rethrow_exception(exception);
+            }
+            return false;
+        }
+        item = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        cv_.notify_all();
+        return true;
+    }
+
+private:
+    void Run() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() {
+                    return queue_.size() < capacity_ || stop_;
+                });
+                if (stop_) {
+                    break;
+                }
+            }
+            T item;
+            bool has_item = false;
+            try {
+                has_item = produce_(item);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                exception_ = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!has_item) {
+                break;
+            }
+            queue_.push_back(std::move(item));
+            cv_.notify_all();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+        cv_.notify_all();
+    }
+
+    std::function<bool(T &)> produce_;
+    size_t capacity_;
+    std::deque<T> queue_;
+    bool done_ = false;
+    bool stop_ = false;
+    std::exception_ptr exception_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+};
+
+}  // namespace utility
+}  // namespace open3d
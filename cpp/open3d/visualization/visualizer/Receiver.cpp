@@ -42,6 +42,18 @@ using namespace open3d::utility;
 namespace open3d {
 namespace visualization {
 
+static std::shared_ptr<zmq::message_t> CreateErrorStatusMsg(
+        const std::string& errstr) {
+    auto status_err = messages::Status::ErrorProcessingMessage();
+    status_err.str += errstr;
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{status_err.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, status_err);
+    return std::shared_ptr<zmq::message_t>(
+            new zmq::message_t(sbuf.data(), sbuf.size()));
+}
+
 std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
         const messages::Request& req,
         const messages::SetMeshData& msg,
@@ -52,14 +64,7 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
 
     std::string errstr(":");
     if (!msg.data.CheckMessage(errstr)) {
-        auto status_err = messages::Status::ErrorProcessingMessage();
-        status_err.str += errstr;
-        msgpack::sbuffer sbuf;
-        messages::Reply reply{status_err.MsgId()};
-        msgpack::pack(sbuf, reply);
-        msgpack::pack(sbuf, status_err);
-        return std::shared_ptr<zmq::message_t>(
-                new zmq::message_t(sbuf.data(), sbuf.size()));
+        return CreateErrorStatusMsg(errstr);
     }
 
     if (msg.data.faces.CheckNonEmpty()) {
@@ -199,6 +204,7 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
             }
         }
 
+        point_clouds_.erase(msg.path);
         SetGeometry(mesh, msg.path, msg.time, msg.layer);
 
     } else {
@@ -305,12 +311,38 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
                 }
             }
         }
+        point_clouds_[msg.path] = pcd;
         SetGeometry(pcd, msg.path, msg.time, msg.layer);
     }
 
     return CreateStatusOKMsg();
 }
 
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::UpdateMeshData& msg,
+        const MsgpackObject& obj) {
+    if (!scene_) {
+        LogError("scene is null");
+    }
+
+    // The update is applied to a copy, the main thread may still use the
+    // previous point cloud.
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    auto pcd_itr = point_clouds_.find(msg.path);
+    if (pcd_itr != point_clouds_.end()) {
+        *pcd = *pcd_itr->second;
+    }
+    std::string errstr(":");
+    if (!UpdatePointCloud(msg, *pcd, errstr)) {
+        return CreateErrorStatusMsg(errstr);
+    }
+
+    point_clouds_[msg.path] = pcd;
+    SetGeometry(pcd, msg.path, msg.time, msg.layer);
+    return CreateStatusOKMsg();
+}
+
 void Receiver::SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                            const std::string& path,
                            int time,
@@ -27,6 +27,10 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/io/rpc/ReceiverBase.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
 
@@ -51,6 +55,12 @@ public:
             const io::rpc::messages::SetMeshData& msg,
             const MsgpackObject& obj) override;
 
+    /// Replaces or appends vertices of a point cloud received before.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::UpdateMeshData& msg,
+            const MsgpackObject& obj) override;
+
 private:
     void SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                      const std::string& path,
@@ -59,6 +69,8 @@ private:
 
     gui::Window* window_;
     std::shared_ptr<rendering::Open3DScene> scene_;
+    /// Point clouds by path, which can be updated by UpdateMeshData messages.
+    std::map<std::string, std::shared_ptr<geometry::PointCloud>> point_clouds_;
 };
 
 }  // namespace visualization
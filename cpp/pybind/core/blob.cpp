@@ -26,6 +26,10 @@
 
 #include "open3d/core/Blob.h"
 
+#include <memory>
+#include <string>
+
+#include "open3d/core/MemoryUsage.h"
 #include "pybind/core/core.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
@@ -33,7 +37,59 @@
 namespace open3d {
 namespace core {
 
-void pybind_core_blob(py::module &m) { py::class_<Blob> blob(m, "Blob"); }
+namespace {
+
+/// Python context manager setting the allocation tag, e.g.
+/// `with o3d.core.MemoryTag("integration"): ...`.
+class PyMemoryTag {
+public:
+    explicit PyMemoryTag(const std::string &tag) : tag_(tag) {}
+
+    void Enter() { scope_.reset(new ScopedMemoryTag(tag_)); }
+
+    void Exit() { scope_.reset(); }
+
+private:
+    std::string tag_;
+    std::unique_ptr<ScopedMemoryTag> scope_;
+};
+
+}  // namespace
+
+void pybind_core_blob(py::module &m) {
+    py::class_<Blob> blob(m, "Blob");
+
+    py::class_<MemoryUsageStats> stats(
+            m, "MemoryUsageStats",
+            "Memory held by Tensors on a device or under an allocation tag.");
+    stats.def_readonly("current_bytes", &MemoryUsageStats::current_bytes_)
+            .def_readonly("peak_bytes", &MemoryUsageStats::peak_bytes_)
+            .def_readonly("num_allocations",
+                          &MemoryUsageStats::num_allocations_)
+            .def("__repr__", [](const MemoryUsageStats &s) {
+                return fmt::format(
+                        "MemoryUsageStats(current_bytes={}, peak_bytes={}, "
+                        "num_allocations={})",
+                        s.current_bytes_, s.peak_bytes_, s.num_allocations_);
+            });
+
+    m.def("get_device_memory_usage", &MemoryUsage::GetDeviceUsage, "device"_a);
+    m.def("get_tag_memory_usage", &MemoryUsage::GetTagUsage, "tag"_a);
+    m.def("get_all_device_memory_usage", &MemoryUsage::GetAllDeviceUsage);
+    m.def("get_all_tag_memory_usage", &MemoryUsage::GetAllTagUsage);
+    m.def("reset_peak_memory_usage", &MemoryUsage::ResetPeak);
+
+    py::class_<PyMemoryTag> memory_tag(
+            m, "MemoryTag",
+            "Context manager recording Tensors allocated in its scope under "
+            "the given tag.");
+    memory_tag.def(py::init<const std::string &>(), "tag"_a)
+            .def("__enter__", &PyMemoryTag::Enter)
+            .def("__exit__",
+                 [](PyMemoryTag &self, py::object, py::object, py::object) {
+                     self.Exit();
+                 });
+}
 
 }  // namespace core
 }  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/Inverse.h"
 #include "open3d/core/linalg/LeastSquares.h"
 #include "open3d/core/linalg/Matmul.h"
@@ -32,6 +33,7 @@
 #include "pybind/core/core.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
+#include "pybind/pybind_utils.h"
 
 namespace open3d {
 namespace core {
@@ -41,17 +43,21 @@ void pybind_core_linalg(py::module &m) {
             "matmul",
             [](const Tensor &A, const Tensor &B) {
                 Tensor output;
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        A.NumElements());
                 Matmul(A, B, output);
                 return output;
             },
             "Function to perform matrix multiplication of two 2D tensors with "
-            "compatible shapes.",
+            "compatible shapes, or of two batches of matrices if A is 3D.",
             "A"_a, "B"_a);
 
     m.def(
             "inv",
             [](const Tensor &A) {
                 Tensor output;
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        A.NumElements());
                 Inverse(A, output);
                 return output;
             },
@@ -61,6 +67,8 @@ void pybind_core_linalg(py::module &m) {
             "solve",
             [](const Tensor &A, const Tensor &B) {
                 Tensor output;
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        A.NumElements());
                 Solve(A, B, output);
                 return output;
             },
@@ -73,6 +81,8 @@ void pybind_core_linalg(py::module &m) {
             "lstsq",
             [](const Tensor &A, const Tensor &B) {
                 Tensor output;
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        A.NumElements());
                 LeastSquares(A, B, output);
                 return output;
             },
@@ -84,10 +94,44 @@ void pybind_core_linalg(py::module &m) {
             "svd",
             [](const Tensor &A) {
                 Tensor U, S, VT;
-                SVD(A, U, S, VT);
+                {
+                    pybind_utils::ScopedGILReleaseForTensors release(
+                            A.NumElements());
+                    SVD(A, U, S, VT);
+                }
                 return py::make_tuple(U, S, VT);
             },
             "Function to decompose A with A = U S VT.", "A"_a);
+
+    m.def(
+            "cholesky_solve",
+            [](const Tensor &A, const Tensor &B) {
+                Tensor output;
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        A.NumElements());
+                BatchedCholeskySolve(A, B, output);
+                return output;
+            },
+            "Function to solve X[i] for the linear systems A[i] X[i] = B[i] "
+            "where A is a (batch_size, n, n) batch of symmetric positive "
+            "definite matrices.",
+            "A"_a, "B"_a);
+
+    m.def(
+            "symmetric_eigen_3x3",
+            [](const Tensor &A) {
+                Tensor eigenvalues, eigenvectors;
+                {
+                    pybind_utils::ScopedGILReleaseForTensors release(
+                            A.NumElements());
+                    BatchedSymmetricEigen3x3(A, eigenvalues, eigenvectors);
+                }
+                return py::make_tuple(eigenvalues, eigenvectors);
+            },
+            "Function to compute the eigenvalues in ascending order and the "
+            "eigenvectors (as columns) of a (batch_size, 3, 3) batch of "
+            "symmetric matrices.",
+            "A"_a);
 }
 
 }  // namespace core
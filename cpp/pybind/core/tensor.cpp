@@ -26,6 +26,7 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -47,6 +48,8 @@
 
 #define BIND_BINARY_OP_ALL_DTYPES(py_name, cpp_name, self_const)            \
     tensor.def(#py_name, [](self_const Tensor& self, const Tensor& other) { \
+        pybind_utils::ScopedGILReleaseForTensors release(                   \
+                std::max(self.NumElements(), other.NumElements()));         \
         return self.cpp_name(other);                                        \
     });                                                                     \
     tensor.def(#py_name, &Tensor::cpp_name<float>);                         \
@@ -95,6 +98,8 @@
                         reduction_dims.push_back(i);                    \
                     }                                                   \
                 }                                                       \
+                pybind_utils::ScopedGILReleaseForTensors release(       \
+                        tensor.NumElements());                          \
                 return tensor.cpp_name(reduction_dims, keepdim);        \
             },                                                          \
             "dim"_a = py::none(), "keepdim"_a = false);
@@ -111,6 +116,8 @@
                         reduction_dims.push_back(i);                      \
                     }                                                     \
                 }                                                         \
+                pybind_utils::ScopedGILReleaseForTensors release(         \
+                        tensor.NumElements());                            \
                 return tensor.cpp_name(reduction_dims);                   \
             },                                                            \
             "dim"_a = py::none());
@@ -279,6 +286,8 @@ void pybind_core_tensor(py::module& m) {
             },
             "n"_a, "dtype"_a = py::none(), "device"_a = py::none());
     tensor.def_static("diag", &Tensor::Diag);
+    tensor.def_static("cat", &Tensor::Cat, "tensors"_a, "dim"_a = 0);
+    tensor.def_static("stack", &Tensor::Stack, "tensors"_a, "dim"_a = 0);
 
     // Tensor copy.
     tensor.def("shallow_copy_from", &Tensor::ShallowCopyFrom);
@@ -307,9 +316,14 @@ void pybind_core_tensor(py::module& m) {
     // Buffer I/O for Numpy and DLPack(PyTorch).
     tensor.def("numpy", &core::TensorToPyArray);
 
-    tensor.def_static("from_numpy", [](py::array np_array) {
-        return core::PyArrayToTensor(np_array, true);
-    });
+    tensor.def_static(
+            "from_numpy",
+            [](py::array np_array) {
+                return core::PyArrayToTensor(np_array, true);
+            },
+            "Creates a Tensor sharing memory with the Numpy array without "
+            "copying. The Tensor keeps the array alive.",
+            "ndarray"_a);
 
     tensor.def("to_dlpack", [](const Tensor& tensor) {
         DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
@@ -349,22 +363,66 @@ void pybind_core_tensor(py::module& m) {
     });
 
     /// Linalg operations.
-    tensor.def("matmul", &Tensor::Matmul);
-    tensor.def("__matmul__", &Tensor::Matmul);
-    tensor.def("lstsq", &Tensor::LeastSquares);
-    tensor.def("solve", &Tensor::Solve);
-    tensor.def("inv", &Tensor::Inverse);
-    tensor.def("svd", &Tensor::SVD);
+    auto matmul = [](const Tensor& self, const Tensor& other) {
+        pybind_utils::ScopedGILReleaseForTensors release(
+                std::max(self.NumElements(), other.NumElements()));
+        return self.Matmul(other);
+    };
+    tensor.def("matmul", matmul);
+    tensor.def("__matmul__", matmul);
+    tensor.def("lstsq", [](const Tensor& self, const Tensor& other) {
+        pybind_utils::ScopedGILReleaseForTensors release(self.NumElements());
+        return self.LeastSquares(other);
+    });
+    tensor.def("solve", [](const Tensor& self, const Tensor& other) {
+        pybind_utils::ScopedGILReleaseForTensors release(self.NumElements());
+        return self.Solve(other);
+    });
+    tensor.def("inv", [](const Tensor& self) {
+        pybind_utils::ScopedGILReleaseForTensors release(self.NumElements());
+        return self.Inverse();
+    });
+    tensor.def("svd", [](const Tensor& self) {
+        pybind_utils::ScopedGILReleaseForTensors release(self.NumElements());
+        return self.SVD();
+    });
 
     // Casting.
     tensor.def(
             "to",
             [](const Tensor& tensor, const Dtype& dtype, bool copy) {
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        tensor.NumElements());
                 return tensor.To(dtype, copy);
             },
             "dtype"_a, "copy"_a = false);
+    tensor.def(
+            "quantize",
+            [](const Tensor& tensor, const Dtype& dtype, double scale,
+               int64_t zero_point) {
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        tensor.NumElements());
+                return tensor.Quantize(dtype, scale, zero_point);
+            },
+            "Returns round(x / scale) + zero_point saturated to dtype.",
+            "dtype"_a, "scale"_a, "zero_point"_a = 0);
+    tensor.def(
+            "dequantize",
+            [](const Tensor& tensor, const Dtype& dtype, double scale,
+               int64_t zero_point) {
+                pybind_utils::ScopedGILReleaseForTensors release(
+                        tensor.NumElements());
+                return tensor.Dequantize(dtype, scale, zero_point);
+            },
+            "Returns (q - zero_point) * scale as dtype.", "dtype"_a,
+            "scale"_a, "zero_point"_a = 0);
+    tensor.def("lazy_copy", &Tensor::LazyCopy,
+               "Copy on the same device, sharing memory copy-on-write.");
     tensor.def("T", &Tensor::T);
-    tensor.def("contiguous", &Tensor::Contiguous);
+    tensor.def("contiguous", [](const Tensor& tensor) {
+        pybind_utils::ScopedGILReleaseForTensors release(tensor.NumElements());
+        return tensor.Contiguous();
+    });
 
     // See "emulating numeric types" section for Python built-in numeric ops.
     // https://docs.python.org/3/reference/datamodel.html#emulating-numeric-types
@@ -488,6 +546,20 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("all", &Tensor::All);
     tensor.def("any", &Tensor::Any);
 
+    // Sorting and segment reductions.
+    tensor.def("argsort", &Tensor::ArgSort, "descending"_a = false);
+    tensor.def("sort", &Tensor::Sort, "descending"_a = false);
+    tensor.def("unique", &Tensor::Unique,
+               "Returns a tuple (values, inverse, counts) for a 1-D tensor.");
+    tensor.def("segment_sum", &Tensor::SegmentSum, "segment_ids"_a,
+               "num_segments"_a = -1);
+    tensor.def("segment_mean", &Tensor::SegmentMean, "segment_ids"_a,
+               "num_segments"_a = -1);
+    tensor.def("segment_min", &Tensor::SegmentMin, "segment_ids"_a,
+               "num_segments"_a = -1);
+    tensor.def("segment_max", &Tensor::SegmentMax, "segment_ids"_a,
+               "num_segments"_a = -1);
+
     // Reduction ops.
     BIND_REDUCTION_OP(sum, Sum);
     BIND_REDUCTION_OP(mean, Mean);
@@ -513,10 +585,16 @@ void pybind_core_tensor(py::module& m) {
     // Get item from Tensor of one element.
     tensor.def("item", [](const Tensor& tensor) -> py::object {
         Dtype dtype = tensor.GetDtype();
-        if (dtype == Dtype::Float32) {
+        if (dtype == Dtype::Float16) {
+            return py::float_(static_cast<float>(tensor.Item<Half>()));
+        } else if (dtype == Dtype::Float32) {
             return py::float_(tensor.Item<float>());
         } else if (dtype == Dtype::Float64) {
             return py::float_(tensor.Item<double>());
+        } else if (dtype == Dtype::Int8) {
+            return py::int_(tensor.Item<int8_t>());
+        } else if (dtype == Dtype::Int16) {
+            return py::int_(tensor.Item<int16_t>());
         } else if (dtype == Dtype::Int32) {
             return py::int_(tensor.Item<int32_t>());
         } else if (dtype == Dtype::Int64) {
@@ -107,7 +107,9 @@ py::array TensorToPyArray(const Tensor& tensor) {
 
     py::capsule base_tensor_capsule(base_tensor, "open3d::Tensor",
                                     capsule_destructor);
-    return py::array(py_dtype, py_shape, py_strides, tensor.GetDataPtr(),
+    // The numpy array is writable, the non-const accessor detaches the memory
+    // from any copy-on-write share.
+    return py::array(py_dtype, py_shape, py_strides, base_tensor->GetDataPtr(),
                      base_tensor_capsule);
 }
 
@@ -117,15 +119,25 @@ Tensor PyArrayToTensor(py::array array, bool inplace) {
     SizeVector shape(info.shape.begin(), info.shape.end());
     SizeVector strides(info.strides.begin(), info.strides.end());
     for (size_t i = 0; i < strides.size(); ++i) {
+        if (strides[i] % info.itemsize != 0) {
+            // E.g. a field of a structured array. The Tensor can only address
+            // strides in elements, so use a contiguous copy.
+            py::object numpy = py::module::import("numpy");
+            return PyArrayToTensor(numpy.attr("ascontiguousarray")(array),
+                                   inplace);
+        }
         strides[i] /= info.itemsize;
     }
     Dtype dtype = pybind_utils::ArrayFormatToDtype(info.format, info.itemsize);
     Device device("CPU:0");
 
-    array.inc_ref();
-    std::function<void(void*)> deleter = [array](void*) -> void {
+    // The Tensor keeps a reference to the Numpy array. The deleter can be
+    // called from threads not holding the GIL, so it only captures the raw
+    // pointer and acquires the GIL before decrementing the reference.
+    PyObject* array_ptr = array.inc_ref().ptr();
+    std::function<void(void*)> deleter = [array_ptr](void*) -> void {
         py::gil_scoped_acquire acquire;
-        array.dec_ref();
+        Py_DECREF(array_ptr);
     };
     auto blob = std::make_shared<Blob>(device, info.ptr, deleter);
     Tensor t_inplace(shape, strides, info.ptr, dtype, blob);
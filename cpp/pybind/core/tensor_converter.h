@@ -60,9 +60,9 @@ py::array TensorToPyArray(const Tensor& tensor);
 /// You may use this helper function for importing data from Numpy.
 ///
 /// \param inplace If True, Tensor will directly use the underlying Numpy
-/// buffer. However, The data will become invalid once the Numpy variable is
-/// deallocated, the Tensor's data becomes invalid without notice. If False, the
-/// python buffer will be copied.
+/// buffer and holds a reference to the Numpy array, which stays alive as long
+/// as the Tensor or any Tensor sharing its memory. Changes to the data are
+/// visible on both sides. If False, the python buffer will be copied.
 Tensor PyArrayToTensor(py::array array, bool inplace);
 
 /// Convert py::list to Tensor.
@@ -73,12 +73,14 @@ void pybind_pointcloud(py::module &m) {
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
             .def("voxel_down_sample", &PointCloud::VoxelDownSample,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel. Normals and colors are averaged if they exist.",
                  "voxel_size"_a)
             .def("voxel_down_sample_and_trace",
                  &PointCloud::VoxelDownSampleAndTrace,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample using "
                  "PointCloud::VoxelDownSample. Also records point "
                  "cloud index before downsampling",
@@ -107,15 +109,18 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier", &PointCloud::RemoveRadiusOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
             .def("remove_statistical_outlier",
                  &PointCloud::RemoveStatisticalOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
             .def("estimate_normals", &PointCloud::EstimateNormals,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
@@ -131,11 +136,13 @@ void pybind_pointcloud(py::module &m) {
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
             .def("orient_normals_consistent_tangent_plane",
                  &PointCloud::OrientNormalsConsistentTangentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to orient the normals with respect to consistent "
                  "tangent planes",
                  "k"_a)
             .def("compute_point_cloud_distance",
                  &PointCloud::ComputePointCloudDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
@@ -153,11 +160,14 @@ void pybind_pointcloud(py::module &m) {
                  "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
             .def("compute_nearest_neighbor_distance",
                  &PointCloud::ComputeNearestNeighborDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
             .def("compute_convex_hull", &PointCloud::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the point cloud.")
             .def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Removes hidden points from a point cloud and returns a mesh "
                  "of the remaining points. Based on Katz et al. 'Direct "
                  "Visibility of Point Sets', 2007. Additional information "
@@ -166,18 +176,21 @@ void pybind_pointcloud(py::module &m) {
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
             .def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
                  "eps"_a, "min_points"_a, "print_progress"_a = false)
             .def("segment_plane", &PointCloud::SegmentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
+                    py::call_guard<py::gil_scoped_release>(),
                     R"(Factory function to create a pointcloud from a depth image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
@@ -192,6 +205,7 @@ void pybind_pointcloud(py::module &m) {
                     "stride"_a = 1, "project_valid_depth_only"_a = true)
             .def_static("create_from_rgbd_image",
                         &PointCloud::CreateFromRGBDImage,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Factory function to create a pointcloud from an RGB-D "
                         "image and a        camera. Given depth value d at (u, "
                         "v) image coordinate, the corresponding 3d point is: "
@@ -117,6 +117,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +126,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +136,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +147,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -238,11 +242,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -252,20 +258,24 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
@@ -273,9 +283,11 @@ void pybind_trianglemesh(py::module &m) {
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -307,6 +319,7 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask"_a)
             .def("deform_as_rigid_as_possible",
                  &TriangleMesh::DeformAsRigidAsPossible,
+                 py::call_guard<py::gil_scoped_release>(),
                  "This function deforms the mesh using the method by Sorkine "
                  "and Alexa, "
                  "'As-Rigid-As-Possible Surface Modeling', 2007",
@@ -320,6 +333,7 @@ void pybind_trianglemesh(py::module &m) {
                         return TriangleMesh::CreateFromPointCloudAlphaShape(
                                 pcd, alpha);
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Alpha shapes are a generalization of the convex hull. "
                     "With decreasing alpha value the shape schrinks and "
                     "creates cavities. See Edelsbrunner and Muecke, "
@@ -327,6 +341,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
@@ -335,6 +350,7 @@ void pybind_trianglemesh(py::module &m) {
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -348,6 +364,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -356,6 +373,40 @@ void pybind_trianglemesh(py::module &m) {
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
                         "linear_fit"_a = false, "n_threads"_a = -1)
+            .def_static(
+                    "create_from_point_cloud_poisson_streaming",
+                    [](py::function source, py::function callback,
+                       size_t depth, size_t tile_depth, double overlap,
+                       size_t max_points_in_memory, bool linear_fit,
+                       int n_threads) {
+                        // The GIL is only held while calling back into Python.
+                        py::gil_scoped_release release;
+                        TriangleMesh::CreateFromPointCloudPoissonStreaming(
+                                [&](size_t chunk_index, PointCloud &chunk) {
+                                    py::gil_scoped_acquire acquire;
+                                    py::object ret = source(chunk_index);
+                                    if (ret.is_none()) {
+                                        return false;
+                                    }
+                                    chunk = ret.cast<PointCloud>();
+                                    return true;
+                                },
+                                [&](const TriangleMesh &mesh,
+                                    const std::vector<double> &densities) {
+                                    py::gil_scoped_acquire acquire;
+                                    callback(mesh, densities);
+                                },
+                                depth, tile_depth, overlap,
+                                max_points_in_memory, linear_fit, n_threads);
+                    },
+                    "Out-of-core variant of create_from_point_cloud_poisson. "
+                    "The input is read in chunks from source and "
+                    "reconstructed in independent cubic tiles, each tile "
+                    "mesh is passed to callback as soon as it is available.",
+                    "source"_a, "callback"_a, "depth"_a = 10,
+                    "tile_depth"_a = 2, "overlap"_a = 0.1,
+                    "max_points_in_memory"_a = 10000000,
+                    "linear_fit"_a = false, "n_threads"_a = -1)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -696,6 +747,32 @@ void pybind_trianglemesh(py::module &m) {
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
               "automatically determine it."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_streaming",
+            {{"source",
+              "Callable that takes a chunk index (starting at 0) and returns "
+              "the PointCloud of that chunk, or None once the input is "
+              "exhausted. It is called several times for each index."},
+             {"callback",
+              "Callable that receives the TriangleMesh and the per vertex "
+              "densities of every reconstructed tile."},
+             {"depth",
+              "Depth of the equivalent in-memory reconstruction of the whole "
+              "input."},
+             {"tile_depth",
+              "Number of octree levels handled by tiling. Each tile is "
+              "solved at depth - tile_depth."},
+             {"overlap",
+              "Fraction of the tile edge added on every side of a tile when "
+              "gathering its points."},
+             {"max_points_in_memory",
+              "Upper bound on the number of points gathered at once."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used for the octree solve of a tile. Set to "
+              "-1 to automatically determine it."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "create_box",
                                     {{"width", "x-directional length."},
                                      {"height", "y-directional length."},
@@ -48,14 +48,17 @@ void pybind_rpc(py::module& m_io) {
     py::class_<rpc::Connection, std::shared_ptr<rpc::Connection>,
                rpc::ConnectionBase>(m, "Connection")
             .def(py::init([](std::string address, int connect_timeout,
-                             int timeout) {
+                             int timeout, bool multipart) {
                      return std::shared_ptr<rpc::Connection>(
                              new rpc::Connection(address, connect_timeout,
-                                                 timeout));
+                                                 timeout, multipart));
                  }),
-                 "Creates a connection object",
+                 "Creates a connection object. If multipart is True, tensor "
+                 "data is sent as separate message frames without copying. "
+                 "The receiver must support multipart messages.",
                  "address"_a = "tcp://127.0.0.1:51454",
-                 "connect_timeout"_a = 5000, "timeout"_a = 10000);
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "multipart"_a = false);
 
     py::class_<rpc::DummyReceiver, std::shared_ptr<rpc::DummyReceiver>>(
             m, "_DummyReceiver",
@@ -141,6 +144,33 @@ void pybind_rpc(py::module& m_io) {
                      "the connection."},
             });
 
+    m.def("update_mesh_data", &rpc::UpdateMeshData, "vertices"_a,
+          "path"_a = "", "time"_a = 0, "layer"_a = "",
+          "vertex_attributes"_a = std::map<std::string, core::Tensor>(),
+          "vertex_offset"_a = -1, "quantize"_a = false,
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Sends an update_mesh_data message replacing or appending a range "
+          "of vertices.");
+    docstring::FunctionDocInject(
+            m, "update_mesh_data",
+            {
+                    {"vertices", "Tensor defining the vertices of the range."},
+                    {"path", "Path of the mesh data to update."},
+                    {"time", "The time associated with this data."},
+                    {"layer", "The layer associated with this data."},
+                    {"vertex_attributes",
+                     "dict of Tensors with vertex attributes."},
+                    {"vertex_offset",
+                     "Index of the first vertex that is replaced. -1 appends "
+                     "the vertices."},
+                    {"quantize",
+                     "Send vertices as 16 bit and float colors as 8 bit "
+                     "integers."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
+
     m.def("set_legacy_camera", &rpc::SetLegacyCamera, "camera"_a, "path"_a = "",
           "time"_a = 0, "layer"_a = "",
           "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
@@ -137,6 +137,14 @@ void pybind_color_map_classes(py::module &m) {
                     "visible vertices to fill the invisible vertex. Set to "
                     "``0`` to disable this feature and all invisible vertices "
                     "will be black.")
+            .def_readwrite(
+                    "maximum_resident_images",
+                    &ColorMapOptimizationOption::maximum_resident_images_,
+                    "int: (Default ``0``) Maximum number of images kept in "
+                    "memory at a time. Images are processed in batches of "
+                    "this size and loaded again in every iteration if they "
+                    "do not all fit. Set to ``0`` to keep all images in "
+                    "memory.")
             .def("__repr__", [](const ColorMapOptimizationOption &to) {
                 // clang-format off
                 return fmt::format(
@@ -150,7 +158,8 @@ void pybind_color_map_classes(py::module &m) {
                     "- depth_threshold_for_discontinuity_check: {}\n"
                     "- half_dilation_kernel_size_for_discontinuity_map: {}\n"
                     "- image_boundary_margin: {}\n"
-                    "- invisible_vertex_color_knn: {}\n",
+                    "- invisible_vertex_color_knn: {}\n"
+                    "- maximum_resident_images: {}\n",
                     to.non_rigid_camera_coordinate_,
                     to.number_of_vertical_anchors_,
                     to.non_rigid_anchor_point_weight_,
@@ -160,14 +169,22 @@ void pybind_color_map_classes(py::module &m) {
                     to.depth_threshold_for_discontinuity_check_,
                     to.half_dilation_kernel_size_for_discontinuity_map_,
                     to.image_boundary_margin_,
-                    to.invisible_vertex_color_knn_
+                    to.invisible_vertex_color_knn_,
+                    to.maximum_resident_images_
                 );
                 // clang-format on
             });
 }
 
 void pybind_color_map_methods(py::module &m) {
-    m.def("color_map_optimization", &ColorMapOptimization,
+    m.def("color_map_optimization",
+          py::overload_cast<geometry::TriangleMesh &,
+                            const std::vector<
+                                    std::shared_ptr<geometry::RGBDImage>> &,
+                            camera::PinholeCameraTrajectory &,
+                            const ColorMapOptimizationOption &>(
+                  &ColorMapOptimization),
+          py::call_guard<py::gil_scoped_release>(),
           "Function for color mapping of reconstructed scenes via "
           "optimization, "
           "This is implementation of following by paper Q-Y Zhou and V Koltun: "
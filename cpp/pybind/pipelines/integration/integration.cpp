@@ -88,11 +88,14 @@ In SIGGRAPH, 1996)");
             .def("reset", &TSDFVolume::Reset,
                  "Function to reset the TSDFVolume")
             .def("integrate", &TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud", &TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh", &TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
             .def_readwrite("voxel_length", &TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
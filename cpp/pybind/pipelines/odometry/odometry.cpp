@@ -174,10 +174,65 @@ Anonymous submission.)");
             "__repr__", [](const RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryFrame
+    py::class_<RGBDOdometryFrame, std::shared_ptr<RGBDOdometryFrame>> frame(
+            m, "RGBDOdometryFrame",
+            "RGBD image preprocessed for odometry. A frame can be reused for "
+            "several odometry computations.");
+    py::detail::bind_default_constructor<RGBDOdometryFrame>(frame);
+    py::detail::bind_copy_functions<RGBDOdometryFrame>(frame);
+    frame.def(py::init<const geometry::RGBDImage &,
+                       const camera::PinholeCameraIntrinsic &,
+                       const OdometryOption &>(),
+              "rgbd_image"_a, "pinhole_camera_intrinsic"_a,
+              "option"_a = OdometryOption())
+            .def("is_empty", &RGBDOdometryFrame::IsEmpty,
+                 "Returns ``True`` if the frame is empty.")
+            .def("num_levels", &RGBDOdometryFrame::NumLevels,
+                 "Returns the number of pyramid levels.")
+            .def_readonly("intensity_scale",
+                          &RGBDOdometryFrame::intensity_scale_,
+                          "float: Factor the intensity of the input image is "
+                          "currently scaled by.")
+            .def("__repr__", [](const RGBDOdometryFrame &f) {
+                return std::string("RGBDOdometryFrame with ") +
+                       std::to_string(f.NumLevels()) + " levels.";
+            });
+
+    // open3d.odometry.RGBDOdometryTiming
+    py::class_<RGBDOdometryTiming> timing(
+            m, "RGBDOdometryTiming",
+            "Wall clock time in milliseconds spent in the stages of an "
+            "odometry computation.");
+    py::detail::bind_default_constructor<RGBDOdometryTiming>(timing);
+    timing.def_readonly("preprocessing_ms",
+                        &RGBDOdometryTiming::preprocessing_ms_,
+                        "float: Building the source and target frames.")
+            .def_readonly("normalization_ms",
+                          &RGBDOdometryTiming::normalization_ms_,
+                          "float: Intensity normalization.")
+            .def_readonly("level_ms", &RGBDOdometryTiming::level_ms_,
+                          "List(float): Iterations of every pyramid level, "
+                          "level 0 is the finest.")
+            .def_readonly("information_ms",
+                          &RGBDOdometryTiming::information_ms_,
+                          "float: Computing the information matrix.");
 }
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("compute_rgbd_odometry", &ComputeRGBDOdometry,
+    m.def("compute_rgbd_odometry",
+          [](const geometry::RGBDImage &source,
+             const geometry::RGBDImage &target,
+             const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+             const Eigen::Matrix4d &odo_init,
+             const RGBDOdometryJacobian &jacobian_method,
+             const OdometryOption &option) {
+              return ComputeRGBDOdometry(source, target,
+                                         pinhole_camera_intrinsic, odo_init,
+                                         jacobian_method, option);
+          },
+          py::call_guard<py::gil_scoped_release>(),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
           "rgbd_source"_a, "rgbd_target"_a,
@@ -200,6 +255,42 @@ void pybind_odometry_methods(py::module &m) {
                      ").``"},
                     {"option", "Odometry hyper parameteres."},
             });
+    m.def("compute_rgbd_odometry_from_frames",
+          [](RGBDOdometryFrame &source, RGBDOdometryFrame &target,
+             const Eigen::Matrix4d &odo_init,
+             const RGBDOdometryJacobian &jacobian_method,
+             const OdometryOption &option) {
+              RGBDOdometryTiming timing;
+              auto result = ComputeRGBDOdometry(source, target, odo_init,
+                                                jacobian_method, option,
+                                                &timing);
+              return std::make_tuple(std::get<0>(result), std::get<1>(result),
+                                     std::get<2>(result), timing);
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to estimate 6D rigid motion from two preprocessed RGBD "
+          "frames. Output: (is_success, 4x4 motion matrix, 6x6 information "
+          "matrix, timing).",
+          "frame_source"_a, "frame_target"_a,
+          "odo_init"_a = Eigen::Matrix4d::Identity(),
+          "jacobian"_a = RGBDOdometryJacobianFromHybridTerm(),
+          "option"_a = OdometryOption());
+    docstring::FunctionDocInject(
+            m, "compute_rgbd_odometry_from_frames",
+            {
+                    {"frame_source", "Source RGBDOdometryFrame."},
+                    {"frame_target", "Target RGBDOdometryFrame."},
+                    {"odo_init", "Initial 4x4 motion matrix estimation."},
+                    {"jacobian",
+                     "The odometry Jacobian method to use. Can be "
+                     "``"
+                     "RGBDOdometryJacobianFromHybridTerm()`` or "
+                     "``RGBDOdometryJacobianFromColorTerm("
+                     ").``"},
+                    {"option",
+                     "Odometry hyper parameteres. Must have as many levels "
+                     "as the frames."},
+            });
 }
 
 void pybind_odometry(py::module &m) {
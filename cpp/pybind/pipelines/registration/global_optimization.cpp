@@ -331,6 +331,7 @@ void pybind_global_optimization_methods(py::module &m) {
                const GlobalOptimizationOption &option) {
                 GlobalOptimization(pose_graph, method, criteria, option);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Function to optimize PoseGraph", "pose_graph"_a, "method"_a,
             "criteria"_a, "option"_a);
     docstring::FunctionDocInject(
@@ -562,13 +562,16 @@ static const std::unordered_map<std::string, std::string>
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = Eigen::Matrix4d::Identity());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &RegistrationICP, "Function for ICP registration",
+    m.def("registration_icp", &RegistrationICP,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a = TransformationEstimationPointToPoint(false),
@@ -577,6 +580,7 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_colored_icp", &RegistrationColoredICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -587,6 +591,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_correspondence",
           &RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on a set of "
           "correspondences",
           "source"_a, "target"_a, "corres"_a, "max_correspondence_distance"_a,
@@ -601,6 +606,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_feature_matching",
           &RegistrationRANSACBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "mutual_filter"_a, "max_correspondence_distance"_a,
@@ -615,6 +621,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_fast_based_on_feature_matching",
           &FastGlobalRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "option"_a = FastGlobalRegistrationOption());
@@ -624,6 +631,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("get_information_matrix_from_point_clouds",
           &GetInformationMatrixFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "open3d/core/Dtype.h"
@@ -39,6 +40,26 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size);
 
 std::string DtypeToArrayFormat(const core::Dtype& dtype);
 
+/// Tensor ops on fewer elements than this keep the GIL, since releasing and
+/// reacquiring it costs more than the op.
+constexpr int64_t kReleaseGILMinNumElements = 1 << 16;
+
+/// \brief Releases the GIL for the lifetime of the object if the op processes
+/// at least kReleaseGILMinNumElements elements.
+///
+/// Python objects must not be accessed while the object is alive.
+class ScopedGILReleaseForTensors {
+public:
+    explicit ScopedGILReleaseForTensors(int64_t num_elements) {
+        if (num_elements >= kReleaseGILMinNumElements) {
+            release_.reset(new py::gil_scoped_release());
+        }
+    }
+
+private:
+    std::unique_ptr<py::gil_scoped_release> release_;
+};
+
 }  // namespace pybind_utils
 
 }  // namespace open3d
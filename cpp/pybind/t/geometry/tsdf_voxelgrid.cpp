@@ -56,17 +56,21 @@ void pybind_tsdf_voxelgrid(py::module& m) {
     tsdf_voxelgrid.def("integrate",
                        py::overload_cast<const Image&, const core::Tensor&,
                                          const core::Tensor&, double, double>(
-                               &TSDFVoxelGrid::Integrate));
+                               &TSDFVoxelGrid::Integrate),
+                       py::call_guard<py::gil_scoped_release>());
     tsdf_voxelgrid.def(
             "integrate",
             py::overload_cast<const Image&, const Image&, const core::Tensor&,
                               const core::Tensor&, double, double>(
-                    &TSDFVoxelGrid::Integrate));
+                    &TSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>());
 
     tsdf_voxelgrid.def("extract_surface_points",
-                       &TSDFVoxelGrid::ExtractSurfacePoints);
+                       &TSDFVoxelGrid::ExtractSurfacePoints,
+                       py::call_guard<py::gil_scoped_release>());
     tsdf_voxelgrid.def("extract_surface_mesh",
-                       &TSDFVoxelGrid::ExtractSurfaceMesh);
+                       &TSDFVoxelGrid::ExtractSurfaceMesh,
+                       py::call_guard<py::gil_scoped_release>());
 
     tsdf_voxelgrid.def("copy", &TSDFVoxelGrid::Copy);
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
@@ -27,6 +27,8 @@
 #include <memory>
 
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/PrefetchingRGBDVideoReader.h"
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
@@ -107,6 +109,82 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "create",
                                     map_shared_argument_docstrings);
 
+    // Class RGBD image sequence reader
+    py::class_<RGBDImageSequenceReader,
+               std::shared_ptr<RGBDImageSequenceReader>, RGBDVideoReader>
+            rgbd_image_sequence_reader(
+                    m, "RGBDImageSequenceReader",
+                    "Reader for directories of color and depth images.");
+    rgbd_image_sequence_reader.def(py::init<>())
+            .def("is_opened", &RGBDImageSequenceReader::IsOpened,
+                 "Check if the image sequence is opened.")
+            .def("open", &RGBDImageSequenceReader::Open, "filename"_a,
+                 "Open a directory with 'color' and 'depth' subfolders.")
+            .def("close", &RGBDImageSequenceReader::Close,
+                 "Close the opened image sequence.")
+            .def("is_eof", &RGBDImageSequenceReader::IsEOF,
+                 "Check if all frames are read.")
+            .def_property("metadata",
+                          py::overload_cast<>(
+                                  &RGBDImageSequenceReader::GetMetadata,
+                                  py::const_),
+                          py::overload_cast<>(
+                                  &RGBDImageSequenceReader::GetMetadata),
+                          "Get metadata of the image sequence.")
+            .def("seek_timestamp", &RGBDImageSequenceReader::SeekTimestamp,
+                 "timestamp"_a, "Seek to the timestamp (in us).")
+            .def("get_timestamp", &RGBDImageSequenceReader::GetTimestamp,
+                 "Get current timestamp (in us).")
+            .def("next_frame", &RGBDImageSequenceReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Read the next frame and return the RGBD object.")
+            .def("__repr__", &RGBDImageSequenceReader::ToString);
+    docstring::ClassMethodDocInject(m, "RGBDImageSequenceReader",
+                                    "seek_timestamp",
+                                    map_shared_argument_docstrings);
+
+    // Class prefetching RGBD video reader
+    py::class_<PrefetchingRGBDVideoReader,
+               std::shared_ptr<PrefetchingRGBDVideoReader>, RGBDVideoReader>
+            prefetching_rgbd_video_reader(
+                    m, "PrefetchingRGBDVideoReader",
+                    "Reads frames of another RGBD video reader on a "
+                    "background thread.");
+    prefetching_rgbd_video_reader
+            .def(py::init<const std::shared_ptr<RGBDVideoReader> &, size_t>(),
+                 "reader"_a,
+                 "buffer_size"_a =
+                         PrefetchingRGBDVideoReader::DEFAULT_BUFFER_SIZE)
+            .def("is_opened", &PrefetchingRGBDVideoReader::IsOpened,
+                 "Check if the wrapped reader is opened.")
+            .def("open", &PrefetchingRGBDVideoReader::Open, "filename"_a,
+                 "Open an RGBD video playback with the wrapped reader.")
+            .def("close", &PrefetchingRGBDVideoReader::Close,
+                 "Close the opened RGBD video playback.")
+            .def("is_eof", &PrefetchingRGBDVideoReader::IsEOF,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Check if all frames are read.")
+            .def_property("metadata",
+                          py::overload_cast<>(
+                                  &PrefetchingRGBDVideoReader::GetMetadata,
+                                  py::const_),
+                          py::overload_cast<>(
+                                  &PrefetchingRGBDVideoReader::GetMetadata),
+                          "Get metadata of the RGBD video playback.")
+            .def("seek_timestamp", &PrefetchingRGBDVideoReader::SeekTimestamp,
+                 "timestamp"_a, "Seek to the timestamp (in us).")
+            .def("get_timestamp", &PrefetchingRGBDVideoReader::GetTimestamp,
+                 "Get the timestamp of the last frame (in us).")
+            .def("next_frame", &PrefetchingRGBDVideoReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return the next prefetched frame.")
+            .def("__repr__", &PrefetchingRGBDVideoReader::ToString);
+    docstring::ClassMethodDocInject(m, "PrefetchingRGBDVideoReader", "__init__",
+                                    {{"reader", "RGBD video reader to prefetch "
+                                                "frames from."},
+                                     {"buffer_size",
+                                      "Maximum number of frames read ahead."}});
+
     // Class RGBD sensor
     py::class_<RGBDSensor> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
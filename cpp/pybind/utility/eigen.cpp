@@ -46,44 +46,54 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
     return cl;
 }
 
+// Arrays of at least this many scalars are copied without holding the GIL.
+static constexpr size_t kReleaseGILMinNumScalars = 1 << 16;
+
 // - This function is used by Pybind for std::vector<SomeEigenType> constructor.
 //   This optional constructor is added to avoid too many Python <-> C++ API
 //   calls when the vector size is large using the default biding method.
 //   Pybind matches np.float64 array to py::array_t<double> buffer.
+// - The rows of the C-contiguous array have the memory layout of the packed
+//   Eigen vectors, so the data is copied with a single memcpy into the
+//   uninitialized vectors.
 // - Directly using templates for the py::array_t<double> and py::array_t<int>
 //   and etc. doesn't work. The current solution is to explicitly implement
 //   bindings for each py array types.
-template <typename EigenVector>
-std::vector<EigenVector> py_array_to_vectors_double(
-        py::array_t<double, py::array::c_style | py::array::forcecast> array) {
+template <typename EigenVector,
+          typename EigenAllocator = std::allocator<EigenVector>,
+          typename Scalar = typename EigenVector::Scalar>
+std::vector<EigenVector, EigenAllocator> py_array_to_vectors(
+        const py::array_t<Scalar, py::array::c_style | py::array::forcecast>
+                &array) {
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(Scalar) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be packed.");
     size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
     if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
         throw py::cast_error();
     }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
+    if (size_t(array.size()) >= kReleaseGILMinNumScalars) {
+        py::gil_scoped_release release;
+        memcpy(eigen_vectors.data(), array.data(),
+               sizeof(EigenVector) * eigen_vectors.size());
+    } else {
+        memcpy(eigen_vectors.data(), array.data(),
+               sizeof(EigenVector) * eigen_vectors.size());
     }
     return eigen_vectors;
 }
 
+template <typename EigenVector>
+std::vector<EigenVector> py_array_to_vectors_double(
+        py::array_t<double, py::array::c_style | py::array::forcecast> array) {
+    return py_array_to_vectors<EigenVector>(array);
+}
+
 template <typename EigenVector>
 std::vector<EigenVector> py_array_to_vectors_int(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector>(array);
 }
 
 template <typename EigenVector,
@@ -91,16 +101,7 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int_eigen_allocator(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector, EigenAllocator>(array);
 }
 
 template <typename EigenVector,
@@ -108,16 +109,7 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int64_eigen_allocator(
         py::array_t<int64_t, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector, EigenAllocator>(array);
 }
 
 }  // namespace pybind11
@@ -26,6 +26,8 @@
 
 #include "open3d/core/Blob.h"
 
+#include <vector>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManager.h"
 #include "tests/UnitTest.h"
@@ -64,5 +66,53 @@ TEST_P(BlobPermuteDevices, BlobConstructorWithExternalMemory) {
     EXPECT_TRUE(deleter_called);
 }
 
+TEST_P(BlobPermuteDevices, LazyCopy) {
+    core::Device device = GetParam();
+
+    std::vector<int> vals{0, 1, 2, 3};
+    auto b = std::make_shared<core::Blob>(sizeof(int) * 4, device);
+    core::MemoryManager::MemcpyFromHost(b->GetDataPtr(), device, vals.data(),
+                                        sizeof(int) * 4);
+    EXPECT_EQ(b->GetByteSize(), static_cast<int64_t>(sizeof(int) * 4));
+    EXPECT_FALSE(b->IsShared());
+
+    // The lazy copy shares the memory until written.
+    std::shared_ptr<core::Blob> c = b->LazyCopy();
+    const core::Blob& b_const = *b;
+    const core::Blob& c_const = *c;
+    EXPECT_TRUE(b->IsShared());
+    EXPECT_TRUE(c->IsShared());
+    EXPECT_EQ(b_const.GetDataPtr(), c_const.GetDataPtr());
+
+    // Non-const access detaches.
+    int one = 100;
+    core::MemoryManager::MemcpyFromHost(c->GetDataPtr(), device, &one,
+                                        sizeof(int));
+    EXPECT_NE(b_const.GetDataPtr(), c_const.GetDataPtr());
+    EXPECT_FALSE(b->IsShared());
+    EXPECT_FALSE(c->IsShared());
+
+    std::vector<int> b_vals(4);
+    std::vector<int> c_vals(4);
+    core::MemoryManager::MemcpyToHost(b_vals.data(), b_const.GetDataPtr(),
+                                      device, sizeof(int) * 4);
+    core::MemoryManager::MemcpyToHost(c_vals.data(), c_const.GetDataPtr(),
+                                      device, sizeof(int) * 4);
+    EXPECT_EQ(b_vals, std::vector<int>({0, 1, 2, 3}));
+    EXPECT_EQ(c_vals, std::vector<int>({100, 1, 2, 3}));
+}
+
+TEST_P(BlobPermuteDevices, LazyCopyExternalMemory) {
+    core::Device device = GetParam();
+
+    void* data_ptr = core::MemoryManager::Malloc(8, device);
+    core::Blob b(device, data_ptr, [&device, data_ptr](void* dummy) -> void {
+        core::MemoryManager::Free(data_ptr, device);
+    });
+    EXPECT_EQ(b.GetByteSize(), -1);
+    EXPECT_FALSE(b.IsLazyCopyable());
+    EXPECT_ANY_THROW(b.LazyCopy());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -33,6 +33,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
@@ -216,5 +217,163 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
         EXPECT_TRUE(std::abs(X_data[i] - X_gt[i]) < EPSILON);
     }
 }
+
+TEST_P(LinalgPermuteDevices, BatchedMatmul) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor A(std::vector<float>{1, 2, 3, 4, 5, 6, 6, 5, 4, 3, 2, 1},
+                   {2, 2, 3}, dtype, device);
+    core::Tensor B(std::vector<float>{7, 8, 9, 10, 11, 12, 1, 0, 0, 1, 1, 1},
+                   {2, 3, 2}, dtype, device);
+    core::Tensor C = A.Matmul(B);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({2, 2, 2}));
+    EXPECT_TRUE(C[0].AllClose(A[0].Matmul(B[0])));
+    EXPECT_TRUE(C[1].AllClose(A[1].Matmul(B[1])));
+
+    // Batch of vectors.
+    core::Tensor v(std::vector<float>{1, 0, 1, 0, 1, 0}, {2, 3, 1}, dtype,
+                   device);
+    core::Tensor Av = A.Matmul(v);
+    EXPECT_EQ(Av.GetShape(), core::SizeVector({2, 2, 1}));
+    EXPECT_EQ(Av.ToFlatVector<float>(), std::vector<float>({4, 10, 5, 2}));
+
+    // A matrix or a vector is multiplied with every matrix, as numpy's A @ B.
+    core::Tensor C_shared = A.Matmul(B[1]);
+    EXPECT_EQ(C_shared.GetShape(), core::SizeVector({2, 2, 2}));
+    EXPECT_TRUE(C_shared[0].AllClose(A[0].Matmul(B[1])));
+    EXPECT_TRUE(C_shared[1].AllClose(A[1].Matmul(B[1])));
+    EXPECT_TRUE(A.Matmul(B.Slice(0, 1, 2)).AllClose(C_shared));
+    core::Tensor Av_shared = A.Matmul(v[0].Reshape({3}));
+    EXPECT_EQ(Av_shared.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(Av_shared.ToFlatVector<float>(),
+              std::vector<float>({4, 10, 10, 4}));
+    core::Tensor A_square = core::Tensor::Ones({3, 3, 3}, dtype, device);
+    EXPECT_TRUE(A_square.Matmul(core::Tensor::Eye(3, dtype, device))
+                        .AllClose(A_square));
+
+    // Large enough for the BLAS path.
+    core::Tensor A_large = core::Tensor::Ones({3, 20, 30}, dtype, device);
+    core::Tensor B_large = core::Tensor::Ones({3, 30, 10}, dtype, device);
+    EXPECT_TRUE(A_large.Matmul(B_large).AllClose(
+            core::Tensor::Full({3, 20, 10}, 30.f, dtype, device)));
+
+    EXPECT_ANY_THROW(A.Matmul(core::Tensor::Ones({3, 3, 2}, dtype, device)));
+    EXPECT_ANY_THROW(A.Matmul(core::Tensor::Ones({2, 2, 2}, dtype, device)));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedInverseAndSolve) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+
+    core::Tensor A(std::vector<double>{2, 3, 1, 3, 3, 1, 2, 4, 1, 4, 1, 0, 1,
+                                       3, 1, 0, 1, 2},
+                   {2, 3, 3}, dtype, device);
+    core::Tensor A_inv = A.Inverse();
+    EXPECT_EQ(A_inv.GetShape(), core::SizeVector({2, 3, 3}));
+    core::Tensor I = core::Tensor::Eye(3, dtype, device);
+    EXPECT_TRUE(A[0].Matmul(A_inv[0]).AllClose(I, 1e-8, 1e-8));
+    EXPECT_TRUE(A[1].Matmul(A_inv[1]).AllClose(I, 1e-8, 1e-8));
+
+    core::Tensor B(std::vector<double>{1, 2, 3, 4, 5, 6}, {2, 3}, dtype,
+                   device);
+    core::Tensor X = A.Solve(B);
+    EXPECT_EQ(X.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(A.Matmul(X).AllClose(B, 1e-8, 1e-8));
+
+    // One singular matrix fails the whole batch.
+    core::Tensor A_singular = A.Copy();
+    A_singular[1] = core::Tensor::Zeros({3, 3}, dtype, device);
+    EXPECT_ANY_THROW(A_singular.Inverse());
+    EXPECT_ANY_THROW(A_singular.Solve(B));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSVDAndLeastSquares) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+
+    core::Tensor A(std::vector<double>{2, 4, 1, 3, 0, 0, 1, 2, 3, 4, 5, 7},
+                   {2, 3, 2}, dtype, device);
+    core::Tensor U, S, VT;
+    std::tie(U, S, VT) = A.SVD();
+    EXPECT_EQ(U.GetShape(), core::SizeVector({2, 3, 3}));
+    EXPECT_EQ(S.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(VT.GetShape(), core::SizeVector({2, 2, 2}));
+    for (int64_t i = 0; i < 2; ++i) {
+        core::Tensor U_i = U[i].Slice(1, 0, 2);
+        core::Tensor USVT = U_i.Matmul(core::Tensor::Diag(S[i])).Matmul(VT[i]);
+        EXPECT_TRUE(USVT.AllClose(A[i], 1e-8, 1e-8));
+    }
+
+    core::Tensor B(std::vector<double>{1, 2, 3, 4, 5, 6}, {2, 3}, dtype,
+                   device);
+    core::Tensor X = A.LeastSquares(B);
+    EXPECT_EQ(X.GetShape(), core::SizeVector({2, 2}));
+    for (int64_t i = 0; i < 2; ++i) {
+        EXPECT_TRUE(X[i].AllClose(A[i].LeastSquares(B[i].Reshape({3, 1}))
+                                          .Reshape({2}),
+                                  1e-8, 1e-8));
+    }
+}
+
+TEST_P(LinalgPermuteDevices, BatchedCholeskySolve) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        for (int64_t n : {1, 3, 6, 7}) {
+            // A = M M^T + (n + i) I is symmetric positive definite.
+            core::Tensor M = core::Tensor::Ones({4, n, n}, dtype, device);
+            core::Tensor A = core::Tensor::Empty({4, n, n}, dtype, device);
+            for (int64_t i = 0; i < 4; ++i) {
+                A[i] = M[i].Matmul(M[i].T()) +
+                       core::Tensor::Eye(n, dtype, device) * (n + i);
+            }
+            core::Tensor B = core::Tensor::Ones({4, n, 2}, dtype, device);
+            core::Tensor X;
+            core::BatchedCholeskySolve(A, B, X);
+            EXPECT_EQ(X.GetShape(), core::SizeVector({4, n, 2}));
+            EXPECT_TRUE(A.Matmul(X).AllClose(B, 1e-4, 1e-4));
+        }
+    }
+
+    core::Tensor not_spd(std::vector<float>{1, 2, 2, 1}, {1, 2, 2},
+                         core::Dtype::Float32, device);
+    core::Tensor B = core::Tensor::Ones({1, 2}, core::Dtype::Float32, device);
+    core::Tensor X;
+    EXPECT_ANY_THROW(core::BatchedCholeskySolve(not_spd, B, X));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSymmetricEigen3x3) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+
+    // A diagonal, a repeated eigenvalue and a general symmetric matrix.
+    core::Tensor A(std::vector<double>{3, 0, 0, 0, 1, 0, 0, 0, 2,
+                                       2, 1, 0, 1, 2, 0, 0, 0, 3,
+                                       4, 1, 2, 1, 3, 0, 2, 0, 5},
+                   {3, 3, 3}, dtype, device);
+    core::Tensor eigenvalues, eigenvectors;
+    core::BatchedSymmetricEigen3x3(A, eigenvalues, eigenvectors);
+    EXPECT_EQ(eigenvalues.GetShape(), core::SizeVector({3, 3}));
+    EXPECT_EQ(eigenvectors.GetShape(), core::SizeVector({3, 3, 3}));
+    EXPECT_TRUE(eigenvalues[0].AllClose(
+            core::Tensor(std::vector<double>{1, 2, 3}, {3}, dtype, device)));
+    EXPECT_TRUE(eigenvalues[1].AllClose(
+            core::Tensor(std::vector<double>{1, 3, 3}, {3}, dtype, device)));
+
+    for (int64_t i = 0; i < 3; ++i) {
+        // A V = V diag(w) and V^T V = I.
+        core::Tensor V = eigenvectors[i];
+        EXPECT_TRUE(A[i].Matmul(V).AllClose(
+                V.Matmul(core::Tensor::Diag(eigenvalues[i])), 1e-8, 1e-8));
+        EXPECT_TRUE(V.T().Matmul(V).AllClose(
+                core::Tensor::Eye(3, dtype, device), 1e-8, 1e-8));
+    }
+
+    EXPECT_ANY_THROW(core::BatchedSymmetricEigen3x3(
+            core::Tensor::Ones({2, 2, 2}, dtype, device), eigenvalues,
+            eigenvectors));
+}
+
 }  // namespace tests
 }  // namespace open3d
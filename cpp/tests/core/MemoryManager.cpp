@@ -30,6 +30,7 @@
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryUsage.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -78,5 +79,67 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, MemoryUsage) {
+    core::Device device = GetParam();
+
+    core::MemoryUsageStats device_before =
+            core::MemoryUsage::GetDeviceUsage(device);
+    core::MemoryUsageStats tag_before =
+            core::MemoryUsage::GetTagUsage("MemoryUsageTest");
+    core::MemoryUsage::ResetPeak();
+    {
+        core::ScopedMemoryTag tag("MemoryUsageTest");
+        EXPECT_EQ(core::ScopedMemoryTag::GetCurrentTag(), "MemoryUsageTest");
+        core::Blob b0(100, device);
+        {
+            core::ScopedMemoryTag inner_tag("MemoryUsageTestInner");
+            core::Blob b1(50, device);
+            EXPECT_EQ(core::MemoryUsage::GetTagUsage("MemoryUsageTestInner")
+                              .current_bytes_,
+                      50);
+        }
+        core::Blob b2(20, device);
+
+        core::MemoryUsageStats device_stats =
+                core::MemoryUsage::GetDeviceUsage(device);
+        EXPECT_EQ(device_stats.current_bytes_,
+                  device_before.current_bytes_ + 120);
+        EXPECT_EQ(device_stats.num_allocations_,
+                  device_before.num_allocations_ + 2);
+        EXPECT_EQ(device_stats.peak_bytes_, device_before.current_bytes_ + 150);
+
+        core::MemoryUsageStats tag_stats =
+                core::MemoryUsage::GetTagUsage("MemoryUsageTest");
+        EXPECT_EQ(tag_stats.current_bytes_, tag_before.current_bytes_ + 120);
+        EXPECT_EQ(tag_stats.num_allocations_, 2);
+        EXPECT_EQ(core::MemoryUsage::GetAllTagUsage().count("MemoryUsageTest"),
+                  1);
+        EXPECT_EQ(core::MemoryUsage::GetAllDeviceUsage().count(
+                          device.ToString()),
+                  1);
+
+        // Lazy copies do not allocate until detached.
+        std::shared_ptr<core::Blob> b3 =
+                std::make_shared<core::Blob>(8, device);
+        std::shared_ptr<core::Blob> b4 = b3->LazyCopy();
+        EXPECT_EQ(core::MemoryUsage::GetTagUsage("MemoryUsageTest")
+                          .current_bytes_,
+                  128);
+        b4->Detach();
+        EXPECT_EQ(core::MemoryUsage::GetTagUsage("MemoryUsageTest")
+                          .current_bytes_,
+                  136);
+    }
+    EXPECT_EQ(core::ScopedMemoryTag::GetCurrentTag(), "default");
+    EXPECT_EQ(core::MemoryUsage::GetDeviceUsage(device).current_bytes_,
+              device_before.current_bytes_);
+    EXPECT_EQ(core::MemoryUsage::GetTagUsage("MemoryUsageTest").peak_bytes_,
+              136);
+
+    core::MemoryUsage::ResetPeak();
+    EXPECT_EQ(core::MemoryUsage::GetTagUsage("MemoryUsageTest").peak_bytes_,
+              0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,12 +26,16 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Indexer.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryUsage.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Helper.h"
@@ -209,6 +213,84 @@ TEST_P(TensorPermuteDevicePairs, CopyBool) {
     EXPECT_EQ(dst_t.ToFlatVector<bool>(), vals);
 }
 
+TEST_P(TensorPermuteDevices, LazyCopy) {
+    core::Device device = GetParam();
+
+    std::vector<float> vals{0, 1, 2, 3, 4, 5};
+    core::Tensor src_t(vals, {2, 3}, core::Dtype::Float32, device);
+    core::Tensor src_view = src_t[1];
+
+    // The copy shares the memory of the source until written.
+    int64_t before = core::MemoryUsage::GetDeviceUsage(device).current_bytes_;
+    core::Tensor dst_t = src_t.LazyCopy();
+    const core::Tensor& src_const = src_t;
+    const core::Tensor& dst_const = dst_t;
+    EXPECT_FALSE(dst_t.IsSame(src_t));
+    EXPECT_EQ(dst_const.GetDataPtr(), src_const.GetDataPtr());
+    EXPECT_EQ(core::MemoryUsage::GetDeviceUsage(device).current_bytes_,
+              before);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), vals);
+
+    // Reading does not detach.
+    EXPECT_EQ((dst_t + 1).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(dst_const.GetDataPtr(), src_const.GetDataPtr());
+
+    // Writing the copy detaches it, the source keeps its values.
+    dst_t[0][0] = 10.f;
+    EXPECT_NE(dst_const.GetDataPtr(), src_const.GetDataPtr());
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({10, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(src_t.ToFlatVector<float>(), vals);
+
+    // Writing the source detaches it as well, views follow the detach.
+    core::Tensor dst2_t = src_t.LazyCopy();
+    src_t += 1;
+    EXPECT_EQ(src_view.ToFlatVector<float>(), std::vector<float>({4, 5, 6}));
+    EXPECT_EQ(src_t.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(dst2_t.ToFlatVector<float>(), vals);
+
+    // Non-contiguous Tensors and views are copied eagerly.
+    core::Tensor slice_copy = src_view.LazyCopy();
+    EXPECT_NE(static_cast<const core::Tensor&>(slice_copy).GetDataPtr(),
+              static_cast<const core::Tensor&>(src_view).GetDataPtr());
+    core::Tensor t_copy = src_t.T().LazyCopy();
+    EXPECT_TRUE(t_copy.IsContiguous());
+    EXPECT_EQ(t_copy.ToFlatVector<float>(),
+              std::vector<float>({1, 4, 2, 5, 3, 6}));
+}
+
+TEST_P(TensorPermuteDevices, LazyCopyParallelKernel) {
+    core::Device device = GetParam();
+
+    // Large enough for the element-wise kernels to run in parallel.
+    const int64_t n = 1 << 20;
+    core::Tensor src_t = core::Tensor::Ones({n}, core::Dtype::Float32, device);
+    core::Tensor dst_t = src_t.LazyCopy();
+    const core::Tensor& src_const = src_t;
+    const core::Tensor& dst_const = dst_t;
+
+    // Parallel kernels and iterators reading the copy do not detach it.
+    EXPECT_EQ((dst_t * 2).Sum({0}).Item<float>(), 2.f * n);
+    core::TensorIterator input_iter(dst_t);
+    EXPECT_EQ(input_iter.GetPtr(0), src_const.GetDataPtr());
+    EXPECT_EQ(dst_const.GetDataPtr(), src_const.GetDataPtr());
+
+    // A parallel kernel writing the copy in place detaches it once, before
+    // the parallel region.
+    dst_t += dst_t;
+    EXPECT_NE(dst_const.GetDataPtr(), src_const.GetDataPtr());
+    EXPECT_EQ(dst_t.Sum({0}).Item<float>(), 2.f * n);
+    EXPECT_EQ(src_t.Sum({0}).Item<float>(), 1.f * n);
+
+    // So does an iterator used as output.
+    core::Tensor dst2_t = src_t.LazyCopy();
+    core::TensorIterator output_iter(dst2_t, /*is_output=*/true);
+    EXPECT_NE(output_iter.GetPtr(0), src_const.GetDataPtr());
+    EXPECT_FALSE(src_t.GetBlob()->IsShared());
+}
+
 TEST_P(TensorPermuteDevices, To) {
     core::Device device = GetParam();
 
@@ -227,6 +309,164 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, ToFloat16) {
+    core::Device device = GetParam();
+
+    // 1 + 2^-11 is halfway between two Float16 values and rounds to even,
+    // 1e5 overflows and 6.1e-5 becomes subnormal.
+    std::vector<float> src_vals{0.f,     1.f,  -2.5f,   1.f + 1.f / 2048,
+                                65504.f, 1e5f, 6.1e-5f, 0.1f};
+    std::vector<float> dst_vals{0.f,      1.f,
+                                -2.5f,    1.f,
+                                65504.f,  INFINITY,
+                                6.09755516e-05f, 0.0999755859f};
+    core::Tensor src_t(src_vals, {2, 4}, core::Dtype::Float32, device);
+
+    core::Tensor half_t = src_t.To(core::Dtype::Float16);
+    EXPECT_EQ(half_t.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(half_t.GetShape(), src_t.GetShape());
+    EXPECT_EQ(half_t.To(core::Dtype::Float32).ToFlatVector<float>(),
+              dst_vals);
+
+    // Non-contiguous conversions go through the element-wise kernel.
+    EXPECT_EQ(src_t.T()
+                      .To(core::Dtype::Float16)
+                      .To(core::Dtype::Float64)
+                      .ToFlatVector<double>(),
+              half_t.T().To(core::Dtype::Float64).ToFlatVector<double>());
+    EXPECT_EQ(half_t[0].To(core::Dtype::Int32).ToFlatVector<int>(),
+              std::vector<int>({0, 1, -2, 1}));
+}
+
+TEST_P(TensorPermuteDevices, Float16BulkConversion) {
+    core::Device device = GetParam();
+
+    // Large enough to be split into several parallel chunks, with a tail that
+    // is not a multiple of the vector width.
+    const int64_t n = (1 << 17) + 5;
+    std::vector<float> src_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        src_vals[i] = static_cast<float>(i % 2048) - 1024.f;
+    }
+    core::Tensor src_t(src_vals, {n}, core::Dtype::Float32, device);
+    EXPECT_EQ(src_t.To(core::Dtype::Float16)
+                      .To(core::Dtype::Float32)
+                      .ToFlatVector<float>(),
+              src_vals);
+
+    // Matches the scalar conversion.
+    std::vector<core::Half> half_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        half_vals[i] = core::Half(src_vals[i] / 7.f);
+    }
+    core::Tensor half_t = (src_t / 7.f)
+                                  .To(core::Dtype::Float16)
+                                  .Copy(core::Device("CPU:0"));
+    const core::Half* half_ptr =
+            static_cast<const core::Half*>(half_t.GetDataPtr());
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(half_ptr[i].GetBits(), half_vals[i].GetBits());
+    }
+}
+
+TEST_P(TensorPermuteDevices, Float16Ops) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        GTEST_SKIP() << "Float16 arithmetic is only implemented on CPU.";
+    }
+
+    core::Tensor a = core::Tensor(std::vector<float>{1, 2, 3, 4}, {2, 2},
+                                  core::Dtype::Float32, device)
+                             .To(core::Dtype::Float16);
+    core::Tensor b = core::Tensor(std::vector<float>{0.5, 0.25, -1, 8}, {2, 2},
+                                  core::Dtype::Float32, device)
+                             .To(core::Dtype::Float16);
+    EXPECT_EQ((a + b).GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ((a + b).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({1.5, 2.25, 2, 12}));
+    EXPECT_EQ((a * b).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.5, 0.5, -3, 32}));
+    EXPECT_EQ(a.Sqrt().To(core::Dtype::Float32).ToFlatVector<float>()[3], 2);
+    EXPECT_EQ((a > b).ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, false}));
+
+    // Sums accumulate in float, 4096 ones would saturate at 2048 in Float16.
+    core::Tensor ones =
+            core::Tensor::Ones({4096}, core::Dtype::Float16, device);
+    EXPECT_EQ(ones.Sum({0}).To(core::Dtype::Float32).Item<float>(), 4096);
+    EXPECT_EQ(a.Max({0}).To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({3, 4}));
+    EXPECT_EQ(a.ArgMin({0}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0}));
+    EXPECT_EQ(a.Mean({0, 1}).To(core::Dtype::Float32).Item<float>(), 2.5);
+    EXPECT_EQ(a[1][1].Item<core::Half>().GetBits(), core::Half(4.f).GetBits());
+    EXPECT_EQ(a.ToString(false),
+              a.To(core::Dtype::Float32).ToString(false));
+}
+
+TEST_P(TensorPermuteDevices, Int8Int16) {
+    core::Device device = GetParam();
+
+    core::Tensor src_t(std::vector<int>{-200, -128, -1, 0, 127, 300}, {6},
+                       core::Dtype::Int32, device);
+    core::Tensor int8_tensor = src_t.Slice(0, 1, 5).To(core::Dtype::Int8);
+    EXPECT_EQ(int8_tensor.GetDtype().ByteSize(), 1);
+    EXPECT_EQ(int8_tensor.ToFlatVector<int8_t>(),
+              std::vector<int8_t>({-128, -1, 0, 127}));
+    EXPECT_EQ(int8_tensor.Max({0}).Item<int8_t>(), 127);
+
+    core::Tensor int16_tensor = src_t.To(core::Dtype::Int16);
+    EXPECT_EQ(int16_tensor.GetDtype().ByteSize(), 2);
+    EXPECT_EQ(int16_tensor.To(core::Dtype::Int32).ToFlatVector<int>(),
+              src_t.ToFlatVector<int>());
+    EXPECT_EQ((int16_tensor + int16_tensor)
+                      .To(core::Dtype::Int32)
+                      .ToFlatVector<int>(),
+              std::vector<int>({-400, -256, -2, 0, 254, 600}));
+    EXPECT_EQ(int16_tensor.Min({0}).Item<int16_t>(), -200);
+}
+
+TEST_P(TensorPermuteDevices, Quantize) {
+    core::Device device = GetParam();
+
+    core::Tensor src_t(std::vector<float>{-1.f, -0.5f, 0.f, 0.25f, 0.3f, 2.f},
+                       {2, 3}, core::Dtype::Float32, device);
+
+    // Scale 1/100: 0.25 -> 25, 2 saturates at 127.
+    core::Tensor q = src_t.Quantize(core::Dtype::Int8, 0.01);
+    EXPECT_EQ(q.GetDtype(), core::Dtype::Int8);
+    EXPECT_EQ(q.GetShape(), src_t.GetShape());
+    EXPECT_EQ(q.To(core::Dtype::Int32).ToFlatVector<int>(),
+              std::vector<int>({-100, -50, 0, 25, 30, 127}));
+    EXPECT_TRUE(q.Dequantize(core::Dtype::Float32, 0.01)
+                        .AllClose(core::Tensor(
+                                std::vector<float>{-1, -0.5, 0, 0.25, 0.3,
+                                                   1.27},
+                                {2, 3}, core::Dtype::Float32, device)));
+
+    // Unsigned with a zero point, ties round to even.
+    core::Tensor u = src_t.Quantize(core::Dtype::UInt8, 0.5, 128);
+    EXPECT_EQ(u.To(core::Dtype::Int32).ToFlatVector<int>(),
+              std::vector<int>({126, 127, 128, 128, 129, 132}));
+    EXPECT_EQ(u.Dequantize(core::Dtype::Float64, 0.5, 128)
+                      .ToFlatVector<double>(),
+              std::vector<double>({-1, -0.5, 0, 0, 0.5, 2}));
+
+    // Non-contiguous input and Float16 output.
+    core::Tensor q16 = src_t.T().Quantize(core::Dtype::Int16, 1e-3);
+    EXPECT_EQ(q16.To(core::Dtype::Int32).ToFlatVector<int>(),
+              std::vector<int>({-1000, 250, -500, 300, 0, 2000}));
+    EXPECT_EQ(q16.Dequantize(core::Dtype::Float16, 1e-3)
+                      .To(core::Dtype::Float32)
+                      .ToFlatVector<float>()[5],
+              2.f);
+
+    EXPECT_ANY_THROW(q.Quantize(core::Dtype::Int8, 0.01));
+    EXPECT_ANY_THROW(src_t.Quantize(core::Dtype::Float32, 0.01));
+    EXPECT_ANY_THROW(src_t.Quantize(core::Dtype::Int8, 0));
+    EXPECT_ANY_THROW(src_t.Dequantize(core::Dtype::Float32, 0.01));
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     core::Device dst_device;
     core::Device src_device;
@@ -1740,6 +1980,79 @@ TEST_P(TensorPermuteDevices, ReduceMaxFloatLimit) {
     EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({1}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceSumNonContiguous) {
+    core::Device device = GetParam();
+    std::vector<int64_t> vals(24);
+    std::iota(vals.begin(), vals.end(), 0);
+    core::Tensor src = core::Tensor(vals, {2, 3, 4}, core::Dtype::Int64, device)
+                               .Permute({2, 0, 1});
+    EXPECT_FALSE(src.IsContiguous());
+
+    core::Tensor dst = src.Sum({0, 2});
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2}));
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({66, 210}));
+    EXPECT_TRUE(dst.AllClose(src.Contiguous().Sum({0, 2})));
+
+    dst = src.Sum({1, 0}, true);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({1, 1, 3}));
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({60, 92, 124}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceSumMode) {
+    core::Device device = GetParam();
+    // 1 + 2^-24 is not representable in Float32, so a native Float32 sum
+    // of many small values after a large one loses them all.
+    int64_t n = 1 << 16;
+    core::Tensor src = core::Tensor::Full({n}, std::pow(2.f, -24.f),
+                                          core::Dtype::Float32, device);
+    src[0] = 1.f;
+    float expected = 1.f + (n - 1) * std::pow(2.f, -24.f);
+
+    core::Tensor dst = src.Sum({0}, false, core::SumMode::Float64);
+    EXPECT_EQ(dst.GetDtype(), core::Dtype::Float32);
+    EXPECT_FLOAT_EQ(dst.Item<float>(), expected);
+
+    dst = src.Sum({0}, false, core::SumMode::Kahan);
+    EXPECT_FLOAT_EQ(dst.Item<float>(), expected);
+
+    dst = src.Mean({0}, false, core::SumMode::Float64);
+    EXPECT_FLOAT_EQ(dst.Item<float>(), expected / n);
+
+    // Integer sums ignore the mode.
+    core::Tensor src_int =
+            core::Tensor::Ones({100}, core::Dtype::Int32, device);
+    EXPECT_EQ(src_int.Sum({0}, false, core::SumMode::Kahan).Item<int32_t>(),
+              100);
+}
+
+TEST_P(TensorPermuteDevices, ReduceMinMaxSum) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({3.f, -1.f, 2.f, 0.f, 5.f, -4.f}),
+                     {3, 2}, core::Dtype::Float32, device);
+
+    core::Tensor min, max, sum;
+    std::tie(min, max, sum) = src.MinMaxSum({0});
+    EXPECT_EQ(min.ToFlatVector<float>(), std::vector<float>({2.f, -4.f}));
+    EXPECT_EQ(max.ToFlatVector<float>(), std::vector<float>({5.f, 0.f}));
+    EXPECT_EQ(sum.ToFlatVector<float>(), std::vector<float>({10.f, -5.f}));
+
+    std::tie(min, max, sum) = src.T().MinMaxSum({1}, true);
+    EXPECT_EQ(min.GetShape(), core::SizeVector({2, 1}));
+    EXPECT_EQ(min.ToFlatVector<float>(), std::vector<float>({2.f, -4.f}));
+    EXPECT_EQ(max.ToFlatVector<float>(), std::vector<float>({5.f, 0.f}));
+    EXPECT_EQ(sum.ToFlatVector<float>(), std::vector<float>({10.f, -5.f}));
+
+    std::tie(min, max, sum) =
+            src.MinMaxSum({0, 1}, false, core::SumMode::Kahan);
+    EXPECT_EQ(min.Item<float>(), -4.f);
+    EXPECT_EQ(max.Item<float>(), 5.f);
+    EXPECT_EQ(sum.Item<float>(), 5.f);
+
+    core::Tensor empty({0, 2}, core::Dtype::Float32, device);
+    EXPECT_THROW(empty.MinMaxSum({0}), std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevices, ReduceArgMin) {
     core::Device device = GetParam();
     core::Tensor src(
@@ -2223,6 +2536,167 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, Cat) {
+    core::Device device = GetParam();
+
+    core::Tensor a(std::vector<float>({0, 1, 2, 3}), {2, 2},
+                   core::Dtype::Float32, device);
+    core::Tensor b(std::vector<float>({4, 5}), {1, 2}, core::Dtype::Float32,
+                   device);
+    core::Tensor c = core::Tensor::Cat({a, b}, 0);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    c = core::Tensor::Cat({a, a.T()}, -1);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 0, 2, 2, 3, 1, 3}));
+
+    // Empty inputs are skipped.
+    core::Tensor empty({0, 2}, core::Dtype::Float32, device);
+    c = core::Tensor::Cat({empty, b}, 0);
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({4, 5}));
+
+    EXPECT_ANY_THROW(core::Tensor::Cat({a, b}, 1));
+    EXPECT_ANY_THROW(core::Tensor::Cat({a, b.To(core::Dtype::Float64)}, 0));
+    EXPECT_ANY_THROW(core::Tensor::Cat({}, 0));
+}
+
+TEST_P(TensorPermuteDevices, Stack) {
+    core::Device device = GetParam();
+
+    core::Tensor a(std::vector<int32_t>({0, 1, 2}), {3}, core::Dtype::Int32,
+                   device);
+    core::Tensor b(std::vector<int32_t>({3, 4, 5}), {3}, core::Dtype::Int32,
+                   device);
+    core::Tensor c = core::Tensor::Stack({a, b}, 0);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(c.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 3, 4, 5}));
+
+    c = core::Tensor::Stack({a, b}, 1);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(c.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 3, 1, 4, 2, 5}));
+
+    EXPECT_ANY_THROW(core::Tensor::Stack({a, b.Slice(0, 0, 2)}, 0));
+}
+
+TEST_P(TensorPermuteDevices, ArgSort) {
+    core::Device device = GetParam();
+
+    core::Tensor a(std::vector<float>({3, -1, 2, -1, 0, -0.0f, 5}), {7},
+                   core::Dtype::Float32, device);
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 4, 5, 2, 0, 6}));
+    EXPECT_EQ(a.ArgSort(/*descending=*/true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({6, 0, 2, 4, 5, 1, 3}));
+    EXPECT_EQ(a.Sort().ToFlatVector<float>(),
+              std::vector<float>({-1, -1, 0, 0, 2, 3, 5}));
+
+    // NaNs are sorted last.
+    core::Tensor b(std::vector<double>({1, NAN, -2}), {3},
+                   core::Dtype::Float64, device);
+    EXPECT_EQ(b.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 1}));
+
+    // Large enough to take the radix sort path.
+    const int64_t n = 100000;
+    std::vector<int64_t> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = (i * 7919) % 1000 - 500;
+    }
+    core::Tensor c(vals, {n}, core::Dtype::Int64, device);
+    std::vector<int64_t> indices = c.ArgSort().ToFlatVector<int64_t>();
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](int64_t l, int64_t r) { return vals[l] < vals[r]; });
+    EXPECT_EQ(indices, expected);
+
+    EXPECT_ANY_THROW(a.Reshape({7, 1}).ArgSort());
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor a(std::vector<int32_t>({4, 1, 4, 2, 1, 4}), {6},
+                   core::Dtype::Int32, device);
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = a.Unique();
+    EXPECT_EQ(values.ToFlatVector<int32_t>(), std::vector<int32_t>({1, 2, 4}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+
+    core::Tensor empty({0}, core::Dtype::Int32, device);
+    std::tie(values, inverse, counts) = empty.Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    core::Device device = GetParam();
+
+    core::Tensor src(std::vector<float>({1, 2, 3, 4, 5, 6, 7, 8}), {4, 2},
+                     core::Dtype::Float32, device);
+    core::Tensor ids(std::vector<int64_t>({0, 0, 2, 2}), {4},
+                     core::Dtype::Int64, device);
+
+    core::Tensor dst = src.SegmentSum(ids);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({4, 6, 0, 0, 12, 14}));
+    EXPECT_EQ(src.SegmentMean(ids).ToFlatVector<float>(),
+              std::vector<float>({2, 3, 0, 0, 6, 7}));
+    EXPECT_EQ(src.SegmentMin(ids).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 0, 0, 5, 6}));
+    EXPECT_EQ(src.SegmentMax(ids, 4).ToFlatVector<float>(),
+              std::vector<float>({3, 4, 0, 0, 7, 8, 0, 0}));
+
+    core::Tensor unsorted(std::vector<int64_t>({1, 0, 0, 0}), {4},
+                          core::Dtype::Int64, device);
+    EXPECT_ANY_THROW(src.SegmentSum(unsorted));
+    EXPECT_ANY_THROW(src.SegmentSum(ids, 2));
+    EXPECT_ANY_THROW(src.SegmentSum(ids.To(core::Dtype::Int32)));
+    EXPECT_ANY_THROW(src.To(core::Dtype::Int32).SegmentMean(ids));
+}
+
+TEST_P(TensorPermuteDevices, NonZeroLarge) {
+    core::Device device = GetParam();
+
+    // Non-contiguous input.
+    core::Tensor a(std::vector<int32_t>({0, 1, 2, 0, 0, 3}), {2, 3},
+                   core::Dtype::Int32, device);
+    core::Tensor result = a.T().NonZero();
+    EXPECT_EQ(result.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(result.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 2, 0, 0, 1}));
+
+    // Boolean mask large enough to be split across threads.
+    const int64_t n = 1000003;
+    std::vector<bool> mask_vec(n);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < n; ++i) {
+        mask_vec[i] = i % 7 == 3;
+        if (mask_vec[i]) {
+            expected.push_back(i);
+        }
+    }
+    core::Tensor mask(mask_vec, {n}, core::Dtype::Bool, device);
+    result = mask.NonZero();
+    EXPECT_EQ(result.GetShape(),
+              core::SizeVector({1, static_cast<int64_t>(expected.size())}));
+    EXPECT_EQ(result.ToFlatVector<int64_t>(), expected);
+
+    std::vector<int64_t> range(n);
+    std::iota(range.begin(), range.end(), 0);
+    core::Tensor values = core::Tensor(range, {n}, core::Dtype::Int64, device)
+                                  .IndexGet({mask});
+    EXPECT_EQ(values.ToFlatVector<int64_t>(), expected);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -26,8 +26,15 @@
 
 #include "open3d/core/TensorList.h"
 
+#include <string>
 #include <vector>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -466,5 +473,164 @@ TEST_P(TensorListPermuteDevices, Clear) {
     EXPECT_ANY_THROW(tl_inplace.Clear());
 }
 
+TEST_P(TensorListPermuteDevices, Chunked) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl =
+            core::TensorList::Chunked({2, 3}, dtype, device, /*chunk_size=*/2);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetChunkSize(), 2);
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetReservedSize(), 2);
+
+    tl.PushBack(core::Tensor::Ones({2, 3}, dtype, device) * 0);
+    tl.PushBack(core::Tensor::Ones({2, 3}, dtype, device) * 1);
+    core::Tensor first = tl[0];
+    tl.PushBack(core::Tensor::Ones({2, 3}, dtype, device) * 2);
+    EXPECT_EQ(tl.GetSize(), 3);
+    EXPECT_EQ(tl.GetReservedSize(), 4);
+    EXPECT_EQ(tl.GetNumChunks(), 2);
+    EXPECT_EQ(tl.GetChunk(1).GetShape(), core::SizeVector({1, 2, 3}));
+
+    // Growing does not move the existing elements.
+    EXPECT_TRUE(first.IsSame(tl[0]));
+    EXPECT_TRUE(tl[2].AllClose(core::Tensor::Ones({2, 3}, dtype, device) * 2));
+    EXPECT_ANY_THROW(tl.AsTensor());
+
+    // Extending with itself copies the original elements only.
+    tl.Extend(tl);
+    EXPECT_EQ(tl.GetSize(), 6);
+    EXPECT_EQ(tl.GetNumChunks(), 3);
+    for (int64_t i = 0; i < 6; ++i) {
+        EXPECT_TRUE(tl[i].AllClose(
+                core::Tensor::Ones({2, 3}, dtype, device) * (i % 3)));
+    }
+
+    tl.Resize(7);
+    EXPECT_TRUE(tl[6].AllClose(core::Tensor::Zeros({2, 3}, dtype, device)));
+
+    core::TensorList tl_copy = tl.Copy();
+    EXPECT_TRUE(tl_copy.IsChunked());
+    EXPECT_FALSE(tl_copy[4].IsSame(tl[4]));
+    EXPECT_TRUE(tl_copy[4].AllClose(tl[4]));
+
+    tl.Compact();
+    EXPECT_EQ(tl.GetNumChunks(), 1);
+    EXPECT_EQ(tl.GetReservedSize(), 8);
+    EXPECT_FALSE(first.IsSame(tl[0]));
+    EXPECT_EQ(tl.AsTensor().GetShape(), core::SizeVector({7, 2, 3}));
+    for (int64_t i = 0; i < 7; ++i) {
+        EXPECT_TRUE(tl[i].AllClose(tl_copy[i]));
+    }
+
+    tl.Clear();
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetChunkSize(), 2);
+    EXPECT_ANY_THROW(core::TensorList::Chunked({3}, dtype, device, 0));
+}
+
+#ifndef _WIN32
+TEST(TensorList, SharedMemory) {
+    core::Dtype dtype = core::Dtype::Int32;
+    const std::string name =
+            "/open3d_test_tensorlist_" + std::to_string(getpid());
+    core::TensorList::UnlinkShared(name);
+
+    core::TensorList writer =
+            core::TensorList::CreateShared(name, 4, {3}, dtype);
+    EXPECT_TRUE(writer.IsShared());
+    EXPECT_EQ(writer.GetReservedSize(), 4);
+    EXPECT_ANY_THROW(core::TensorList::CreateShared(name, 4, {3}, dtype));
+
+    core::TensorList reader = core::TensorList::OpenShared(name);
+    EXPECT_EQ(reader.GetElementShape(), core::SizeVector({3}));
+    EXPECT_EQ(reader.GetDtype(), dtype);
+    EXPECT_EQ(reader.GetSize(), 0);
+
+    writer.PushBack(core::Tensor(std::vector<int32_t>({1, 2, 3}), {3}, dtype));
+    writer.PushBack(core::Tensor(std::vector<int32_t>({4, 5, 6}), {3}, dtype));
+    EXPECT_EQ(reader.GetSize(), 0);
+    reader.SyncSharedSize();
+    EXPECT_EQ(reader.GetSize(), 2);
+    EXPECT_EQ(reader.AsTensor().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4, 5, 6}));
+
+    // Both tensorlists map the same memory.
+    reader[0] = core::Tensor(std::vector<int32_t>({7, 8, 9}), {3}, dtype);
+    EXPECT_EQ(writer[0].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({7, 8, 9}));
+
+    // The capacity is fixed.
+    writer.Resize(4);
+    EXPECT_ANY_THROW(writer.PushBack(
+            core::Tensor(std::vector<int32_t>({0, 0, 0}), {3}, dtype)));
+
+    // A copy is private to the process.
+    core::TensorList copy = reader.Copy();
+    EXPECT_FALSE(copy.IsShared());
+    EXPECT_FALSE(copy[0].IsSame(reader[0]));
+
+    EXPECT_TRUE(core::TensorList::UnlinkShared(name));
+    EXPECT_FALSE(core::TensorList::UnlinkShared(name));
+    EXPECT_ANY_THROW(core::TensorList::OpenShared(name));
+    // The mapping stays valid after the name is removed.
+    EXPECT_EQ(reader[1].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 5, 6}));
+}
+
+TEST(TensorList, SharedMemoryInvalidHeader) {
+    core::Dtype dtype = core::Dtype::Int32;
+    const std::string name =
+            "/open3d_test_tensorlist_header_" + std::to_string(getpid());
+    core::TensorList::UnlinkShared(name);
+
+    // The size of the segment does not fit into int64_t.
+    EXPECT_ANY_THROW(core::TensorList::CreateShared(name, int64_t(1) << 62,
+                                                    {3}, dtype));
+    EXPECT_ANY_THROW(core::TensorList::CreateShared(name, 4, {-1}, dtype));
+    EXPECT_FALSE(core::TensorList::UnlinkShared(name));
+
+    core::TensorList writer =
+            core::TensorList::CreateShared(name, 4, {3}, dtype);
+    // Header fields as int64_t: capacity at 1, dtype code at 2, dtype byte
+    // size at 3, number of element dimensions at 6, element shape from 7 and
+    // size at 23.
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    void* data = mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(data, MAP_FAILED);
+    int64_t* header = static_cast<int64_t*>(data);
+    ASSERT_EQ(header[1], 4);
+    ASSERT_EQ(header[2], int64_t(dtype.GetDtypeCode()));
+    ASSERT_EQ(header[23], 0);
+    EXPECT_NO_THROW(core::TensorList::OpenShared(name));
+
+    auto expect_invalid = [&](int index, int64_t value) {
+        const int64_t original = header[index];
+        header[index] = value;
+        EXPECT_ANY_THROW(core::TensorList::OpenShared(name));
+        header[index] = original;
+    };
+    expect_invalid(1, int64_t(1) << 61);
+    expect_invalid(1, -1);
+    expect_invalid(1, 5);
+    expect_invalid(2, 100);
+    expect_invalid(3, 3);
+    expect_invalid(7, int64_t(1) << 62);
+    expect_invalid(7, -3);
+    expect_invalid(23, 5);
+    expect_invalid(23, -1);
+
+    core::TensorList reader = core::TensorList::OpenShared(name);
+    header[23] = 5;
+    EXPECT_ANY_THROW(reader.SyncSharedSize());
+    header[23] = 0;
+    munmap(data, 4096);
+    EXPECT_TRUE(core::TensorList::UnlinkShared(name));
+}
+#endif
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static core::Tensor Iota(const core::SizeVector& shape) {
+    std::vector<float> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<float>(i);
+    }
+    return core::Tensor(vals, shape, core::Dtype::Float32);
+}
+
+// Runs dst = lhs * 10 + rhs through LaunchBinaryEWKernel and checks the
+// result against a serial loop using the Indexer's generic addressing.
+static void CheckBinaryEW(const core::Tensor& lhs,
+                          const core::Tensor& rhs,
+                          const core::Tensor& dst) {
+    core::Indexer indexer({lhs, rhs}, dst, core::DtypePolicy::ALL_SAME);
+    core::kernel::CPULauncher::LaunchBinaryEWKernel(
+            indexer, [](const void* l, const void* r, void* d) {
+                *static_cast<float*>(d) = *static_cast<const float*>(l) * 10 +
+                                          *static_cast<const float*>(r);
+            });
+
+    for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+        float l = *reinterpret_cast<float*>(indexer.GetInputPtr(0, i));
+        float r = *reinterpret_cast<float*>(indexer.GetInputPtr(1, i));
+        float d = *reinterpret_cast<float*>(indexer.GetOutputPtr(i));
+        ASSERT_EQ(d, l * 10 + r) << "workload " << i;
+    }
+}
+
+static core::Tensor Empty(const core::SizeVector& shape) {
+    return core::Tensor::Empty(shape, core::Dtype::Float32);
+}
+
+TEST(CPULauncher, BinaryEWContiguous) {
+    for (int64_t n : {0, 1, 7, 100003}) {
+        CheckBinaryEW(Iota({n}), Iota({n}), Empty({n}));
+    }
+    CheckBinaryEW(Iota({4, 5, 6}), Iota({4, 5, 6}), Empty({4, 5, 6}));
+}
+
+TEST(CPULauncher, BinaryEWBroadcastScalar) {
+    core::Tensor scalar =
+            core::Tensor::Full<float>({}, 3, core::Dtype::Float32);
+    CheckBinaryEW(Iota({1000, 7, 3}), scalar, Empty({1000, 7, 3}));
+    CheckBinaryEW(scalar, Iota({1000, 7, 3}), Empty({1000, 7, 3}));
+
+    core::Tensor dst = Empty({});
+    CheckBinaryEW(scalar, scalar, dst);
+    EXPECT_EQ(dst.Item<float>(), 33);
+}
+
+TEST(CPULauncher, BinaryEW2DStrided) {
+    // Transposed and sliced operand, rows shorter than a thread's range.
+    CheckBinaryEW(Iota({65, 64}).T().Slice(1, 1, 60), Iota({64, 59}),
+                  Empty({64, 59}));
+
+    // Row broadcast and a transposed output, rows longer than a thread's
+    // range.
+    CheckBinaryEW(Iota({3, 100003}), Iota({1, 100003}),
+                  Empty({100003, 3}).T());
+
+    // Contiguous rows of a 3-D slice.
+    CheckBinaryEW(Iota({8, 9, 10}).Slice(1, 2, 7), Iota({8, 5, 10}),
+                  Empty({8, 5, 10}));
+}
+
+TEST(CPULauncher, BinaryEWGeneric) {
+    // Does not reduce to fewer than three dimensions.
+    CheckBinaryEW(Iota({5, 6, 7}).Permute({2, 1, 0}), Iota({7, 6, 5}),
+                  Empty({7, 6, 5}));
+}
+
+TEST(CPULauncher, UnaryEW2DStrided) {
+    core::Tensor src = Iota({300, 200}).Slice(1, 0, 200, 2);
+    core::Tensor dst = Empty({100, 300}).T();
+    core::Indexer indexer({src}, dst, core::DtypePolicy::ALL_SAME);
+    core::kernel::CPULauncher::LaunchUnaryEWKernel(
+            indexer, [](const void* s, void* d) {
+                *static_cast<float*>(d) = -*static_cast<const float*>(s);
+            });
+    EXPECT_TRUE(dst.AllClose(src.Neg()));
+}
+
+TEST(CPULauncher, IndexFill2DStrided) {
+    core::Tensor dst = core::Tensor::Zeros({40, 30}, core::Dtype::Float32);
+    core::Tensor view = dst.T().Slice(0, 0, 30, 3);
+    core::Indexer indexer({view}, view, core::DtypePolicy::ALL_SAME);
+    core::kernel::CPULauncher::LaunchIndexFillKernel(
+            indexer, [](void* ptr, int64_t workload_idx) {
+                *static_cast<float*>(ptr) = static_cast<float>(workload_idx);
+            });
+    EXPECT_TRUE(view.Contiguous().AllClose(Iota({10, 40})));
+    EXPECT_EQ(dst.Sum({0, 1}).Item<float>(),
+              Iota({10, 40}).Sum({0, 1}).Item<float>());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ScanCPU.h"
+
+#include <numeric>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ScanCPU, ExclusiveScan) {
+    for (int64_t n : {0, 1, 7, 100003}) {
+        std::vector<int64_t> src(n);
+        for (int64_t i = 0; i < n; ++i) {
+            src[i] = i % 5;
+        }
+        std::vector<int64_t> expected(n);
+        int64_t sum = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            expected[i] = sum;
+            sum += src[i];
+        }
+
+        std::vector<int64_t> dst(n);
+        EXPECT_EQ(core::kernel::ExclusiveScanCPU(src.data(), dst.data(), n),
+                  sum);
+        EXPECT_EQ(dst, expected);
+
+        // In-place.
+        EXPECT_EQ(core::kernel::ExclusiveScanCPU(src.data(), src.data(), n),
+                  sum);
+        EXPECT_EQ(src, expected);
+    }
+}
+
+TEST(ScanCPU, CompactIndices) {
+    for (int64_t n : {0, 1, 7, 100003}) {
+        std::vector<int64_t> expected;
+        for (int64_t i = 0; i < n; ++i) {
+            if (i % 3 == 1) {
+                expected.push_back(i);
+            }
+        }
+        core::Tensor indices = core::kernel::CompactIndicesCPU(
+                n, [](int64_t i) { return i % 3 == 1; });
+        EXPECT_EQ(indices.GetDtype(), core::Dtype::Int64);
+        EXPECT_EQ(indices.GetShape(),
+                  core::SizeVector{static_cast<int64_t>(expected.size())});
+        EXPECT_EQ(indices.ToFlatVector<int64_t>(), expected);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
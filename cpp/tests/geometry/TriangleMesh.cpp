@@ -26,8 +26,17 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -1639,6 +1648,97 @@ TEST(TriangleMesh, CropTriangleMesh) {
     ExpectEQ(ref_triangle_normals, output_tm->triangle_normals_);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Slightly perturbed planar grid, large enough to be split into several
+    // tiles that are triangulated in parallel.
+    auto CreateGrid = [](int size) {
+        geometry::PointCloud pcd;
+        for (int i = 0; i < size; ++i) {
+            for (int j = 0; j < size; ++j) {
+                pcd.points_.emplace_back(i, j + 0.1 * (i % 2), 0);
+                pcd.normals_.emplace_back(0, 0, 1);
+            }
+        }
+        return pcd;
+    };
+
+    for (int size : {4, 60}) {
+        geometry::PointCloud pcd = CreateGrid(size);
+        auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                pcd, {1.0});
+        EXPECT_EQ(mesh->triangles_.size(), size_t(2 * (size - 1) * (size - 1)));
+        EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+        for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+            Eigen::Vector3d normal =
+                    (pcd.points_[triangle(1)] - pcd.points_[triangle(0)])
+                            .cross(pcd.points_[triangle(2)] -
+                                   pcd.points_[triangle(0)]);
+            EXPECT_GT(normal(2), 0);
+        }
+    }
+
+    geometry::PointCloud pcd = CreateGrid(4);
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                         pcd, {-1.0}),
+                 std::runtime_error);
+    pcd.normals_.clear();
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                         pcd, {1.0}),
+                 std::runtime_error);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingTiled) {
+    // Sphere large enough compared to the ball to be split into 2x2x2 tiles.
+    geometry::TriangleMesh sphere =
+            *geometry::TriangleMesh::CreateSphere(10.0, 40);
+    sphere.ComputeVertexNormals();
+    auto pcd = sphere.SamplePointsUniformly(20000, true);
+
+    auto SortedTriangles = [](const geometry::TriangleMesh &mesh) {
+        std::vector<std::array<int, 3>> triangles;
+        for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+            std::array<int, 3> t = {triangle(0), triangle(1), triangle(2)};
+            std::sort(t.begin(), t.end());
+            triangles.push_back(t);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    };
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            *pcd, {0.3, 0.5});
+    EXPECT_GT(mesh->triangles_.size(), pcd->points_.size());
+
+    // Stitching the tiles creates no duplicated triangles and no edges
+    // shared by more than two triangles.
+    std::vector<std::array<int, 3>> triangles = SortedTriangles(*mesh);
+    EXPECT_EQ(std::adjacent_find(triangles.begin(), triangles.end()),
+              triangles.end());
+    std::unordered_map<Eigen::Vector2i, int,
+                       utility::hash_eigen<Eigen::Vector2i>>
+            edge_counts;
+    for (const std::array<int, 3> &t : triangles) {
+        edge_counts[Eigen::Vector2i(t[0], t[1])]++;
+        edge_counts[Eigen::Vector2i(t[0], t[2])]++;
+        edge_counts[Eigen::Vector2i(t[1], t[2])]++;
+    }
+    for (const auto &edge_count : edge_counts) {
+        EXPECT_LE(edge_count.second, 2);
+    }
+
+#ifdef _OPENMP
+    // The triangulation depends on the tile layout, but not on the number of
+    // threads the tiles are processed with.
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    auto mesh_single_thread =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                    *pcd, {0.3, 0.5});
+    omp_set_num_threads(max_threads);
+    EXPECT_EQ(SortedTriangles(*mesh_single_thread), triangles);
+#endif
+}
+
 TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1890,6 +1990,121 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonStreaming) {
+    geometry::TriangleMesh sphere =
+            *geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere.ComputeVertexNormals();
+    auto pcd = sphere.SamplePointsUniformly(4000, true);
+
+    const size_t chunk_size = 1000;
+    auto source = [&](size_t chunk_index, geometry::PointCloud &chunk) {
+        size_t begin = chunk_index * chunk_size;
+        if (begin >= pcd->points_.size()) {
+            return false;
+        }
+        size_t end = std::min(begin + chunk_size, pcd->points_.size());
+        chunk.points_.assign(pcd->points_.begin() + begin,
+                             pcd->points_.begin() + end);
+        chunk.normals_.assign(pcd->normals_.begin() + begin,
+                              pcd->normals_.begin() + end);
+        return true;
+    };
+
+    size_t num_meshes = 0;
+    size_t num_triangles = 0;
+    geometry::TriangleMesh::CreateFromPointCloudPoissonStreaming(
+            source,
+            [&](const geometry::TriangleMesh &mesh,
+                const std::vector<double> &densities) {
+                EXPECT_EQ(mesh.vertices_.size(), densities.size());
+                for (const Eigen::Vector3d &v : mesh.vertices_) {
+                    EXPECT_LT(v.norm(), 1.5);
+                }
+                num_meshes++;
+                num_triangles += mesh.triangles_.size();
+            },
+            /*depth=*/6, /*tile_depth=*/1, /*overlap=*/0.1,
+            /*max_points_in_memory=*/3000, /*linear_fit=*/false,
+            /*n_threads=*/1);
+    EXPECT_GT(num_meshes, 1u);
+    EXPECT_GT(num_triangles, 0u);
+
+    auto callback = [](const geometry::TriangleMesh &,
+                       const std::vector<double> &) {};
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonStreaming(
+                         source, callback, /*depth=*/2, /*tile_depth=*/1),
+                 std::runtime_error);
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonStreaming(
+                         source, callback, /*depth=*/6, /*tile_depth=*/1,
+                         /*overlap=*/1.0),
+                 std::runtime_error);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudPoissonStreamingSeams) {
+    geometry::TriangleMesh sphere =
+            *geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere.ComputeVertexNormals();
+    auto pcd = sphere.SamplePointsUniformly(8000, true);
+
+    auto source = [&](size_t chunk_index, geometry::PointCloud &chunk) {
+        if (chunk_index > 0) {
+            return false;
+        }
+        chunk = *pcd;
+        return true;
+    };
+
+    // With tile_depth 1 the bounding box [-1, 1]^3 is split into 2x2x2 tiles
+    // of edge 1, i.e. the seams are the planes x = 0, y = 0 and z = 0.
+    geometry::TriangleMesh merged;
+    geometry::TriangleMesh::CreateFromPointCloudPoissonStreaming(
+            source,
+            [&](const geometry::TriangleMesh &mesh,
+                const std::vector<double> &densities) { merged += mesh; },
+            /*depth=*/6, /*tile_depth=*/1, /*overlap=*/0.1,
+            /*max_points_in_memory=*/4000, /*linear_fit=*/false,
+            /*n_threads=*/1);
+    std::shared_ptr<geometry::TriangleMesh> reference;
+    std::vector<double> densities;
+    std::tie(reference, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(*pcd, 6);
+
+    // Surface area in the band of half width 0.1 around every seam plane.
+    // Duplicated surface from neighbouring tiles increases it, surface
+    // dropped at the seams decreases it.
+    auto SeamAreas = [](const geometry::TriangleMesh &mesh) {
+        Eigen::Vector3d areas = Eigen::Vector3d::Zero();
+        for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+            const Eigen::Vector3d &v0 = mesh.vertices_[triangle(0)];
+            const Eigen::Vector3d &v1 = mesh.vertices_[triangle(1)];
+            const Eigen::Vector3d &v2 = mesh.vertices_[triangle(2)];
+            Eigen::Vector3d centroid = (v0 + v1 + v2) / 3.0;
+            double area = 0.5 * (v1 - v0).cross(v2 - v0).norm();
+            for (int d = 0; d < 3; ++d) {
+                if (std::abs(centroid(d)) < 0.1) {
+                    areas(d) += area;
+                }
+            }
+        }
+        return areas;
+    };
+    Eigen::Vector3d seam_areas = SeamAreas(merged);
+    Eigen::Vector3d reference_seam_areas = SeamAreas(*reference);
+    for (int d = 0; d < 3; ++d) {
+        EXPECT_NEAR(seam_areas(d), reference_seam_areas(d),
+                    0.1 * reference_seam_areas(d));
+    }
+    EXPECT_NEAR(merged.GetSurfaceArea(), reference->GetSurfaceArea(),
+                0.05 * reference->GetSurfaceArea());
+
+    // No spurious surface, e.g. walls closing a tile, near the seams.
+    for (const Eigen::Vector3d &v : merged.vertices_) {
+        if (v.cwiseAbs().minCoeff() < 0.1) {
+            EXPECT_NEAR(v.norm(), 1.0, 0.1);
+        }
+    }
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
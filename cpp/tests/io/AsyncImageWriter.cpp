@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/AsyncImageWriter.h"
+
+#include "open3d/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsyncImageWriter, Write) {
+    auto depth = std::make_shared<geometry::Image>();
+    depth->Prepare(64, 48, 1, 2);
+    uint16_t *depth_ptr = depth->PointerAs<uint16_t>();
+    for (int i = 0; i < 64 * 48; i++) {
+        depth_ptr[i] = uint16_t(i * 7);
+    }
+
+    std::vector<std::string> file_names;
+    {
+        io::AsyncImageWriter writer(2, 3);
+        for (int i = 0; i < 10; i++) {
+            file_names.push_back("test_async_" + std::to_string(i) + ".png");
+            EXPECT_TRUE(writer.Write(file_names.back(), depth, i % 10));
+        }
+        EXPECT_TRUE(writer.Flush());
+        EXPECT_EQ(writer.QueueSize(), 0u);
+        io::AsyncImageWriter::Statistics stats = writer.GetStatistics();
+        EXPECT_EQ(stats.num_written_, 10u);
+        EXPECT_EQ(stats.num_failed_, 0u);
+        EXPECT_EQ(stats.num_dropped_, 0u);
+        EXPECT_LE(stats.max_queue_size_, 3u);
+
+        // Invalid quality.
+        EXPECT_TRUE(writer.Write("test_async_fail.png", *depth, 20));
+        EXPECT_FALSE(writer.Flush());
+        EXPECT_EQ(writer.GetStatistics().num_failed_, 1u);
+        EXPECT_TRUE(writer.Flush());
+    }
+    for (const std::string &file_name : file_names) {
+        geometry::Image image;
+        EXPECT_TRUE(io::ReadImage(file_name, image));
+        EXPECT_EQ(image.data_, depth->data_);
+        utility::filesystem::RemoveFile(file_name);
+    }
+}
+
+TEST(AsyncImageWriter, DropWhenFull) {
+    geometry::Image color;
+    color.Prepare(640, 480, 3, 1);
+    std::vector<std::string> file_names;
+    size_t num_queued = 0;
+    {
+        io::AsyncImageWriter writer(1, 1, true);
+        for (int i = 0; i < 20; i++) {
+            file_names.push_back("test_async_" + std::to_string(i) + ".png");
+            num_queued += writer.Write(file_names.back(), color) ? 1 : 0;
+        }
+        // The destructor writes the queued images.
+    }
+    size_t num_files = 0;
+    for (const std::string &file_name : file_names) {
+        if (utility::filesystem::FileExists(file_name)) {
+            num_files++;
+            utility::filesystem::RemoveFile(file_name);
+        }
+    }
+    EXPECT_EQ(num_files, num_queued);
+    EXPECT_GE(num_queued, 1u);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/ImageIO.h"
+
+#include <algorithm>
+
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,6 +40,68 @@ TEST(ImageIO, DISABLED_ReadImage) { NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImage) { NotImplemented(); }
 
+TEST(ImageIO, ReadImageBuffer) {
+    geometry::Image depth;
+    depth.Prepare(64, 48, 1, 2);
+    uint16_t *depth_ptr = depth.PointerAs<uint16_t>();
+    for (int i = 0; i < 64 * 48; i++) {
+        depth_ptr[i] = uint16_t(i * 17);
+    }
+    const std::string file_name = "test_depth.png";
+    for (int quality : {0, 6, 9}) {
+        SCOPED_TRACE(quality);
+        EXPECT_TRUE(io::WriteImage(file_name, depth, quality));
+        std::vector<uint16_t> buffer;
+        EXPECT_TRUE(io::ReadImageBuffer(
+                file_name, [&buffer](int width, int height,
+                                     int num_of_channels,
+                                     int bytes_per_channel) {
+                    EXPECT_EQ(width, 64);
+                    EXPECT_EQ(height, 48);
+                    EXPECT_EQ(num_of_channels, 1);
+                    EXPECT_EQ(bytes_per_channel, 2);
+                    buffer.resize(width * height);
+                    return reinterpret_cast<uint8_t *>(buffer.data());
+                }));
+        EXPECT_EQ(buffer, std::vector<uint16_t>(depth_ptr,
+                                                depth_ptr + 64 * 48));
+    }
+    // Returning nullptr cancels reading.
+    EXPECT_FALSE(io::ReadImageBuffer(
+            file_name, [](int, int, int, int) -> uint8_t * { return nullptr; }));
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(ImageIO, ReadImages) {
+    std::vector<std::string> file_names;
+    for (int i = 0; i < 4; i++) {
+        geometry::Image color;
+        color.Prepare(32, 16, 3, 1);
+        std::fill(color.data_.begin(), color.data_.end(), uint8_t(i * 50));
+        file_names.push_back("test_color_" + std::to_string(i) + ".png");
+        EXPECT_TRUE(io::WriteImage(file_names.back(), color));
+    }
+    std::vector<geometry::Image> images;
+    EXPECT_TRUE(io::ReadImages(file_names, images));
+    ASSERT_EQ(images.size(), 4u);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(images[i].width_, 32);
+        EXPECT_EQ(images[i].num_of_channels_, 3);
+        EXPECT_EQ(images[i].data_[0], uint8_t(i * 50));
+    }
+
+    // The buffers of the images are reused.
+    const uint8_t *data_ptr = images[3].data_.data();
+    EXPECT_TRUE(io::ReadImages(file_names, images));
+    EXPECT_EQ(images[3].data_.data(), data_ptr);
+
+    file_names.push_back("missing.png");
+    EXPECT_FALSE(io::ReadImages(file_names, images));
+    for (int i = 0; i < 4; i++) {
+        utility::filesystem::RemoveFile(file_names[i]);
+    }
+}
+
 TEST(ImageIO, DISABLED_ReadImageFromPNG) { NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImageToPNG) { NotImplemented(); }
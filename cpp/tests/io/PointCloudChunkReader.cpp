@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudChunkReader.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(PointCloudChunkReader, ReadNext) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    pc.normals_.resize(1000);
+    pc.colors_.resize(1000);
+    Eigen::Vector3d one(1, 1, 1);
+    Rand(pc.points_, one * -1000, one * 1000, 0);
+    Rand(pc.normals_, one * -1, one, 0);
+    Rand(pc.colors_, one * 0, one, 0);
+
+    // File name, write as ASCII, compressed, has normals, has colors.
+    const std::vector<std::tuple<std::string, bool, bool, bool, bool>> files{
+            {"test_chunks.xyz", true, false, false, false},
+            {"test_chunks.xyzn", true, false, true, false},
+            {"test_chunks.ply", false, false, true, true},
+            {"test_chunks.pcd", false, false, true, true},
+            {"test_chunks_compressed.pcd", false, true, true, true},
+    };
+    for (const auto &file : files) {
+        const std::string &file_name = std::get<0>(file);
+        SCOPED_TRACE(file_name);
+        EXPECT_TRUE(io::WritePointCloud(
+                file_name, pc, {std::get<1>(file), std::get<2>(file), false}));
+        geometry::PointCloud expected;
+        EXPECT_TRUE(io::ReadPointCloud(file_name, expected));
+
+        io::PointCloudChunkReader reader;
+        EXPECT_TRUE(reader.Open(file_name, 300, 1));
+        geometry::PointCloud chunk;
+        geometry::PointCloud all;
+        std::vector<size_t> chunk_sizes;
+        while (reader.ReadNext(chunk)) {
+            chunk_sizes.push_back(chunk.points_.size());
+            EXPECT_EQ(chunk.HasNormals(), std::get<3>(file));
+            EXPECT_EQ(chunk.HasColors(), std::get<4>(file));
+            all += chunk;
+        }
+        EXPECT_EQ(chunk_sizes, std::vector<size_t>({300, 300, 300, 100}));
+        ExpectEQ(all.points_, expected.points_);
+        ExpectEQ(all.normals_, expected.normals_);
+        ExpectEQ(all.colors_, expected.colors_);
+
+        // Closing while chunks are read ahead.
+        EXPECT_TRUE(reader.Open(file_name, 100, 4));
+        EXPECT_TRUE(reader.ReadNext(chunk));
+        reader.Close();
+        EXPECT_FALSE(reader.ReadNext(chunk));
+        utility::filesystem::RemoveFile(file_name);
+    }
+
+    io::PointCloudChunkReader reader;
+    EXPECT_FALSE(reader.Open("does_not_exist.xyz"));
+    EXPECT_FALSE(reader.Open("test_chunks.pts"));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/file_format/BinaryPLY.h"
+
+#include <fstream>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static bool OpenPLY(const std::string &content) {
+    std::ofstream("test_binary_ply.ply", std::ios::binary) << content;
+    io::BinaryPLYReader reader;
+    bool success = reader.Open("test_binary_ply.ply");
+    utility::filesystem::RemoveFile("test_binary_ply.ply");
+    return success;
+}
+
+TEST(BinaryPLY, Open) {
+    const std::string header =
+            "ply\nformat binary_little_endian 1.0\n"
+            "element vertex 2\n"
+            "property float x\nproperty float y\nproperty float z\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    const std::string vertices(24, '\0');
+    const std::string face("\x03\0\0\0\0\x01\0\0\0\x01\0\0\0", 13);
+    EXPECT_TRUE(OpenPLY(header + vertices + face));
+
+    // Truncated vertex and face data.
+    EXPECT_FALSE(OpenPLY(header + vertices.substr(0, 20)));
+    EXPECT_FALSE(OpenPLY(header + vertices + face.substr(0, 12)));
+
+    // ASCII files are left to rply.
+    EXPECT_FALSE(OpenPLY(
+            "ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\n"
+            "end_header\n0\n"));
+}
+
+TEST(BinaryPLY, OpenRejectsOverflowingSizes) {
+    // The vertex count times the record size of 12 bytes wraps to 0.
+    EXPECT_FALSE(
+            OpenPLY("ply\nformat binary_little_endian 1.0\n"
+                    "element vertex 4611686018427387904\n"
+                    "property float x\nproperty float y\nproperty float z\n"
+                    "end_header\n" +
+                    std::string(12, '\0')));
+
+    // A list length whose byte size exceeds the file.
+    EXPECT_FALSE(
+            OpenPLY("ply\nformat binary_little_endian 1.0\n"
+                    "element face 1\n"
+                    "property list uint double vertex_indices\n"
+                    "end_header\n" +
+                    std::string("\xff\xff\xff\xff", 4) + std::string(8, '\0')));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,11 +24,149 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+/// Appends \p value to the body of a PLY file in \p format.
+template <typename T>
+static void AppendPLYValue(std::string &body,
+                           const std::string &format,
+                           T value) {
+    if (format == "ascii") {
+        body += std::to_string(value) + " ";
+        return;
+    }
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    const uint16_t one = 1;
+    const bool host_little_endian = *reinterpret_cast<const uint8_t *>(&one);
+    if ((format == "binary_big_endian") == host_little_endian) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    body.append(bytes, sizeof(T));
+}
+
+/// Writes a 10x10 grid of vertices with normals and colors, and its cells as
+/// two triangles or one quad each. All values are exact in float and ASCII,
+/// so every format holds the same data. With \p vertex_list, the vertex
+/// element also has a list property, which the binary fast path leaves to
+/// rply.
+static void WriteGridPLY(const std::string &filename,
+                         const std::string &format,
+                         bool quads,
+                         bool vertex_list) {
+    const int size = 10;
+    const int num_cells = (size - 1) * (size - 1);
+    std::string header = "ply\nformat " + format + " 1.0\n";
+    header += "comment grid\nelement vertex " + std::to_string(size * size) +
+              "\n";
+    for (const char *name : {"x", "y", "z", "nx", "ny", "nz"}) {
+        header += std::string("property float ") + name + "\n";
+    }
+    for (const char *name : {"red", "green", "blue"}) {
+        header += std::string("property uchar ") + name + "\n";
+    }
+    if (vertex_list) {
+        header += "property list uchar float extra\n";
+    }
+    header += "element face " +
+              std::to_string(quads ? num_cells : 2 * num_cells) + "\n";
+    header += "property list uchar int vertex_indices\nend_header\n";
+
+    std::string body;
+    for (int i = 0; i < size * size; i++) {
+        AppendPLYValue(body, format, 0.25f * (i % size));
+        AppendPLYValue(body, format, 0.25f * (i / size));
+        AppendPLYValue(body, format, 1.0f);
+        AppendPLYValue(body, format, 0.0f);
+        AppendPLYValue(body, format, 0.0f);
+        AppendPLYValue(body, format, -1.0f);
+        AppendPLYValue(body, format, uint8_t(i));
+        AppendPLYValue(body, format, uint8_t(255 - i));
+        AppendPLYValue(body, format, uint8_t(2 * i));
+        if (vertex_list) {
+            AppendPLYValue(body, format, uint8_t(i % 3));
+            for (int k = 0; k < i % 3; k++) {
+                AppendPLYValue(body, format, 0.5f * k);
+            }
+        }
+        if (format == "ascii") {
+            body += "\n";
+        }
+    }
+    for (int v = 0; v < size - 1; v++) {
+        for (int u = 0; u < size - 1; u++) {
+            const int i = v * size + u;
+            std::vector<std::vector<int>> faces;
+            if (quads) {
+                faces = {{i, i + 1, i + size + 1, i + size}};
+            } else {
+                faces = {{i, i + 1, i + size + 1}, {i, i + size + 1, i + size}};
+            }
+            for (const std::vector<int> &face : faces) {
+                AppendPLYValue(body, format, uint8_t(face.size()));
+                for (int index : face) {
+                    AppendPLYValue(body, format, index);
+                }
+                if (format == "ascii") {
+                    body += "\n";
+                }
+            }
+        }
+    }
+    std::ofstream file(filename, std::ios::binary);
+    file << header << body;
+}
+
+TEST(FilePLY, ReadBinaryMatchesRply) {
+    // ASCII files are always read with rply, they are the reference.
+    for (bool quads : {false, true}) {
+        for (bool vertex_list : {false, true}) {
+            SCOPED_TRACE("quads " + std::to_string(quads) + ", vertex list " +
+                         std::to_string(vertex_list));
+            WriteGridPLY("test_grid_ascii.ply", "ascii", quads, vertex_list);
+            geometry::TriangleMesh mesh_ref;
+            geometry::PointCloud pcd_ref;
+            EXPECT_TRUE(io::ReadTriangleMesh("test_grid_ascii.ply", mesh_ref));
+            EXPECT_TRUE(io::ReadPointCloud("test_grid_ascii.ply", pcd_ref));
+            EXPECT_EQ(mesh_ref.vertices_.size(), 100u);
+            EXPECT_EQ(mesh_ref.triangles_.size(), 162u);
+            EXPECT_TRUE(mesh_ref.HasVertexNormals());
+            EXPECT_TRUE(mesh_ref.HasVertexColors());
+
+            for (const std::string format :
+                 {"binary_little_endian", "binary_big_endian"}) {
+                SCOPED_TRACE(format);
+                WriteGridPLY("test_grid.ply", format, quads, vertex_list);
+                geometry::TriangleMesh mesh;
+                geometry::PointCloud pcd;
+                EXPECT_TRUE(io::ReadTriangleMesh("test_grid.ply", mesh));
+                EXPECT_TRUE(io::ReadPointCloud("test_grid.ply", pcd));
+                ExpectEQ(mesh.vertices_, mesh_ref.vertices_);
+                ExpectEQ(mesh.vertex_normals_, mesh_ref.vertex_normals_);
+                ExpectEQ(mesh.vertex_colors_, mesh_ref.vertex_colors_);
+                ExpectEQ(mesh.triangles_, mesh_ref.triangles_);
+                ExpectEQ(pcd.points_, pcd_ref.points_);
+                ExpectEQ(pcd.normals_, pcd_ref.normals_);
+                ExpectEQ(pcd.colors_, pcd_ref.colors_);
+            }
+        }
+    }
+    utility::filesystem::RemoveFile("test_grid_ascii.ply");
+    utility::filesystem::RemoveFile("test_grid.ply");
+}
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { NotImplemented(); }
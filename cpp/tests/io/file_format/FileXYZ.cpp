@@ -24,12 +24,48 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+#include <fstream>
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ChunkedASCIIParser.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { NotImplemented(); }
+TEST(FileXYZ, ParseASCIIDouble) {
+    const std::string numbers = "  1.5 -0.25 3e2 1.0000000001 nan abc";
+    const char *end = numbers.data() + numbers.size();
+    double value;
+    const char *ptr = io::ParseASCIIDouble(numbers.data(), end, value);
+    EXPECT_EQ(value, 1.5);
+    ptr = io::ParseASCIIDouble(ptr, end, value);
+    EXPECT_EQ(value, -0.25);
+    ptr = io::ParseASCIIDouble(ptr, end, value);
+    EXPECT_EQ(value, 300.0);
+    ptr = io::ParseASCIIDouble(ptr, end, value);
+    EXPECT_EQ(value, 1.0000000001);
+    ptr = io::ParseASCIIDouble(ptr, end, value);
+    EXPECT_TRUE(std::isnan(value));
+    EXPECT_EQ(io::ParseASCIIDouble(ptr, end, value), nullptr);
+}
+
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    const std::string file_name = "test_read.xyz";
+    {
+        std::ofstream out(file_name);
+        out << "0 0 0\n1 2 3\r\ninvalid line\n\n4.5 5 6 7\n-1e-3 2 3";
+    }
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZ(file_name, pcd, {}));
+    ASSERT_EQ(pcd.points_.size(), 4u);
+    ExpectEQ(pcd.points_[1], Eigen::Vector3d(1, 2, 3));
+    ExpectEQ(pcd.points_[2], Eigen::Vector3d(4.5, 5, 6));
+    ExpectEQ(pcd.points_[3], Eigen::Vector3d(-1e-3, 2, 3));
+    utility::filesystem::RemoveFile(file_name);
+}
 
 TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { NotImplemented(); }
 
@@ -26,14 +26,17 @@
 
 #include "open3d/io/rpc/RemoteFunctions.h"
 
+#include <algorithm>
 #include <random>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
 #include "tests/UnitTest.h"
 
 using namespace open3d::io::rpc;
@@ -47,6 +50,51 @@ const std::string connection_address = "tcp://127.0.0.1:51454";
 const std::string connection_address = "ipc:///tmp/open3d_ipc";
 #endif
 
+/// Receiver which keeps the arrays of the last SetMeshData message as tensors.
+class MeshDataReceiver : public DummyReceiver {
+public:
+    MeshDataReceiver(const std::string& address, int timeout)
+        : DummyReceiver(address, timeout) {}
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const MsgpackObject& obj) override {
+        vertices_ = ArrayToTensor(msg.data.vertices);
+        colors_ = ArrayToTensor(msg.data.vertex_attributes.at("colors"));
+        faces_ = ArrayToTensor(msg.data.faces);
+        // Arrays of multipart messages reference the received frames.
+        zero_copy_ = msg.data.vertices.owner && msg.data.faces.owner;
+        return CreateStatusOKMsg();
+    }
+
+    core::Tensor vertices_;
+    core::Tensor colors_;
+    core::Tensor faces_;
+    bool zero_copy_ = false;
+};
+
+/// Receiver which applies UpdateMeshData messages to point clouds like the
+/// visualizer's receiver.
+class PointCloudReceiver : public DummyReceiver {
+public:
+    PointCloudReceiver(const std::string& address, int timeout)
+        : DummyReceiver(address, timeout) {}
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::UpdateMeshData& msg,
+            const MsgpackObject& obj) override {
+        std::string errstr;
+        if (!UpdatePointCloud(msg, point_clouds_[msg.path], errstr)) {
+            return nullptr;
+        }
+        return CreateStatusOKMsg();
+    }
+
+    std::map<std::string, geometry::PointCloud> point_clouds_;
+};
+
 TEST(RemoteFunctions, SendReceiveUnpackMessages) {
     {
         // start receiver
@@ -237,5 +285,168 @@ TEST(RemoteFunctions, SendGarbage) {
     receiver.Stop();
 }
 
+TEST(RemoteFunctions, SendMultipartMeshData) {
+    MeshDataReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    std::vector<float> vertex_values(100 * 3);
+    std::vector<double> color_values(100 * 6);
+    std::vector<int32_t> face_values(10 * 3);
+    for (size_t i = 0; i < vertex_values.size(); ++i) {
+        vertex_values[i] = 0.5f * i;
+    }
+    for (size_t i = 0; i < color_values.size(); ++i) {
+        color_values[i] = i / double(color_values.size());
+    }
+    for (size_t i = 0; i < face_values.size(); ++i) {
+        face_values[i] = int32_t(i % 100);
+    }
+    core::Tensor vertices(vertex_values, {100, 3}, core::Dtype::Float32);
+    std::map<std::string, core::Tensor> vertex_attributes;
+    // A non-contiguous attribute is sent from a contiguous copy.
+    vertex_attributes["colors"] =
+            core::Tensor(color_values, {100, 6}, core::Dtype::Float64)
+                    .Slice(1, 0, 6, 2);
+    core::Tensor faces(face_values, {10, 3}, core::Dtype::Int32);
+    core::Tensor lines({0}, core::Dtype::Int32);
+
+    auto connection = std::make_shared<Connection>(connection_address, 500,
+                                                   500, true);
+    EXPECT_TRUE(connection->IsMultipart());
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_TRUE(SetMeshData(vertices, "mesh", i, "", vertex_attributes,
+                                faces, {}, lines, {}, {}, connection));
+    }
+    receiver.Stop();
+
+    EXPECT_TRUE(receiver.zero_copy_);
+    EXPECT_TRUE(receiver.vertices_.AllClose(vertices));
+    EXPECT_TRUE(receiver.colors_.AllClose(
+            vertex_attributes["colors"].Contiguous()));
+    EXPECT_TRUE(receiver.faces_.AllClose(faces));
+}
+
+TEST(RemoteFunctions, UpdateMeshData) {
+    PointCloudReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+    auto random_points = [&](int64_t n, float low, float high) {
+        std::vector<float> values(n * 3);
+        for (float& value : values) {
+            value = low + (high - low) * uniform(rng);
+        }
+        return core::Tensor(values, {n, 3}, core::Dtype::Float32);
+    };
+    auto expect_rows_near = [](const std::vector<Eigen::Vector3d>& vectors,
+                               size_t begin, const core::Tensor& expected,
+                               const Eigen::Vector3d& tolerance) {
+        const std::vector<float> values = expected.ToFlatVector<float>();
+        const size_t n = size_t(expected.GetShape()[0]);
+        ASSERT_GE(vectors.size(), begin + n);
+        for (size_t i = 0; i < n; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                EXPECT_NEAR(vectors[begin + i](c), values[i * 3 + c],
+                            tolerance(c));
+            }
+        }
+    };
+
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    auto multipart_connection = std::make_shared<Connection>(
+            connection_address, 500, 500, true);
+    const Eigen::Vector3d exact = Eigen::Vector3d::Zero();
+
+    // Appending to a new point cloud, then replacing and extending ranges.
+    core::Tensor a = random_points(100, -1.f, 1.f);
+    core::Tensor a_colors = random_points(100, 0.f, 1.f);
+    core::Tensor b = random_points(50, -1.f, 1.f);
+    core::Tensor b_colors = random_points(50, 0.f, 1.f);
+    core::Tensor c = random_points(50, -1.f, 1.f);
+    core::Tensor c_colors = random_points(50, 0.f, 1.f);
+    ASSERT_TRUE(UpdateMeshData(a, "points", 0, "", {{"colors", a_colors}}, -1,
+                               false, connection));
+    ASSERT_TRUE(UpdateMeshData(b, "points", 0, "", {{"colors", b_colors}}, 30,
+                               false, connection));
+    ASSERT_TRUE(UpdateMeshData(c, "points", 0, "", {{"colors", c_colors}}, 80,
+                               false, multipart_connection));
+    ASSERT_TRUE(UpdateMeshData(a, "points", 0, "", {}, -1, false,
+                               multipart_connection));
+
+    // The quantized positions are relative to the bounding box of the update
+    // and the colors are in [0, 1].
+    core::Tensor q = random_points(200, -3.f, 5.f);
+    core::Tensor q_colors = random_points(200, 0.f, 1.f);
+    ASSERT_TRUE(UpdateMeshData(q, "quantized", 0, "", {{"colors", q_colors}},
+                               -1, true, connection));
+    ASSERT_TRUE(UpdateMeshData(q, "quantized", 0, "", {{"colors", q_colors}},
+                               0, true, multipart_connection));
+
+    // Vertices must have shape [N,3].
+    EXPECT_FALSE(UpdateMeshData(
+            core::Tensor::Ones({100, 2}, core::Dtype::Float32), "points", 0,
+            "", {}, -1, true, connection));
+    receiver.Stop();
+
+    const geometry::PointCloud& pcd = receiver.point_clouds_["points"];
+    ASSERT_EQ(pcd.points_.size(), 230u);
+    ASSERT_EQ(pcd.colors_.size(), 230u);
+    expect_rows_near(pcd.points_, 0, a.Slice(0, 0, 30), exact);
+    expect_rows_near(pcd.colors_, 0, a_colors.Slice(0, 0, 30), exact);
+    expect_rows_near(pcd.points_, 30, b, exact);
+    expect_rows_near(pcd.colors_, 30, b_colors, exact);
+    expect_rows_near(pcd.points_, 80, c, exact);
+    expect_rows_near(pcd.colors_, 80, c_colors, exact);
+    expect_rows_near(pcd.points_, 130, a, exact);
+    for (size_t i = 130; i < 230; ++i) {
+        ExpectEQ(pcd.colors_[i], Eigen::Vector3d(0, 0, 0));
+    }
+
+    const std::vector<float> q_values = q.ToFlatVector<float>();
+    Eigen::Vector3d q_step;
+    for (int d = 0; d < 3; ++d) {
+        float min_value = q_values[d], max_value = q_values[d];
+        for (size_t i = d; i < q_values.size(); i += 3) {
+            min_value = std::min(min_value, q_values[i]);
+            max_value = std::max(max_value, q_values[i]);
+        }
+        q_step(d) = (max_value - min_value) / 65535.0;
+    }
+    const geometry::PointCloud& q_pcd = receiver.point_clouds_["quantized"];
+    ASSERT_EQ(q_pcd.points_.size(), 200u);
+    expect_rows_near(q_pcd.points_, 0, q, q_step);
+    expect_rows_near(q_pcd.colors_, 0, q_colors,
+                     Eigen::Vector3d::Constant(1.0 / 255.0));
+}
+
+TEST(RemoteFunctions, UpdatePointCloudChecksDataSize) {
+    std::vector<float> values(4 * 3, 1.f);
+    messages::UpdateMeshData msg;
+    msg.data.vertices = messages::Array::FromPtr(values.data(), {4, 3});
+    geometry::PointCloud pcd;
+    std::string errstr;
+    ASSERT_TRUE(UpdatePointCloud(msg, pcd, errstr));
+    EXPECT_EQ(pcd.points_.size(), 4u);
+
+    // The shape claims more rows than the data holds.
+    msg.data.vertices.shape = {int64_t(1) << 62, 3};
+    EXPECT_FALSE(UpdatePointCloud(msg, pcd, errstr));
+    msg.data.vertices.shape = {4, 3};
+    msg.data.vertices.data.size = 3 * sizeof(float);
+    EXPECT_FALSE(UpdatePointCloud(msg, pcd, errstr));
+    EXPECT_EQ(pcd.points_.size(), 4u);
+
+    // Attributes with too little data are ignored.
+    msg.data.vertices = messages::Array::FromPtr(values.data(), {4, 3});
+    msg.data.vertex_attributes["colors"] =
+            messages::Array::FromPtr(values.data(), {2, 3});
+    msg.data.vertex_attributes["colors"].shape = {4, 3};
+    ASSERT_TRUE(UpdatePointCloud(msg, pcd, errstr));
+    EXPECT_EQ(pcd.points_.size(), 8u);
+    EXPECT_FALSE(pcd.HasColors());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -28,6 +28,8 @@
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/color_map/ColorMapOptimization.h"
+#include "open3d/pipelines/color_map/TriangleMeshAndImageUtilities.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -1131,5 +1133,101 @@ TEST(ColorMapOptimization, DISABLED_ColorMapOptimization) {
         ExpectEQ(ref_triangle_normals[i], mesh->triangle_normals_[i]);
 }
 
+TEST(ColorMapOptimization, VertexVisibility) {
+    pipelines::color_map::VertexVisibility visibility(130);
+    EXPECT_EQ(visibility.NumVertices(), 130u);
+    EXPECT_EQ(visibility.Count(), 0u);
+
+    std::vector<int> ref = {0, 5, 63, 64, 127, 129};
+    for (int vertex_id : ref) {
+        visibility.Set(vertex_id);
+    }
+    EXPECT_TRUE(visibility.Test(63));
+    EXPECT_TRUE(visibility.Test(64));
+    EXPECT_FALSE(visibility.Test(65));
+    EXPECT_EQ(visibility.Count(), ref.size());
+    EXPECT_EQ(visibility.GetVisibleVertices(), ref);
+}
+
+TEST(ColorMapOptimization, MaximumResidentImages) {
+    // A textured plane at depth 1 seen by cameras shifted along x.
+    const int width = 64;
+    const int height = 48;
+    const int n_camera = 5;
+    const int n_grid = 21;
+
+    geometry::TriangleMesh mesh_ref;
+    for (int y = 0; y < n_grid; y++) {
+        for (int x = 0; x < n_grid; x++) {
+            mesh_ref.vertices_.push_back(Eigen::Vector3d(
+                    -0.4 + 0.8 * x / (n_grid - 1),
+                    -0.3 + 0.6 * y / (n_grid - 1), 1.0));
+        }
+    }
+    for (int y = 0; y + 1 < n_grid; y++) {
+        for (int x = 0; x + 1 < n_grid; x++) {
+            int i = y * n_grid + x;
+            mesh_ref.triangles_.push_back(
+                    Eigen::Vector3i(i, i + 1, i + n_grid));
+            mesh_ref.triangles_.push_back(
+                    Eigen::Vector3i(i + 1, i + n_grid + 1, i + n_grid));
+        }
+    }
+
+    camera::PinholeCameraTrajectory camera_ref;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd;
+    for (int c = 0; c < n_camera; c++) {
+        camera::PinholeCameraParameters params;
+        params.intrinsic_.SetIntrinsics(width, height, 60.0, 60.0, 31.5,
+                                        23.5);
+        params.extrinsic_ = Eigen::Matrix4d::Identity();
+        params.extrinsic_(0, 3) = 0.02 * (c - n_camera / 2);
+        camera_ref.parameters_.push_back(params);
+
+        auto rgbd = std::make_shared<geometry::RGBDImage>();
+        rgbd->color_.Prepare(width, height, 3, 1);
+        rgbd->depth_.Prepare(width, height, 1, 4);
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                unsigned char* rgb = rgbd->color_.PointerAt<unsigned char>(
+                        u, v, 0);
+                rgb[0] = (unsigned char)(128 + 100 * std::sin(0.3 * u + c));
+                rgb[1] = (unsigned char)(128 + 100 * std::cos(0.2 * v));
+                rgb[2] = (unsigned char)((u * v + 7 * c) % 256);
+                *rgbd->depth_.PointerAt<float>(u, v) = 1.0f;
+            }
+        }
+        images_rgbd.push_back(rgbd);
+    }
+
+    for (bool non_rigid : {false, true}) {
+        pipelines::color_map::ColorMapOptimizationOption option;
+        option.non_rigid_camera_coordinate_ = non_rigid;
+        option.number_of_vertical_anchors_ = 4;
+        option.maximum_iteration_ = 5;
+        option.image_boundary_margin_ = 2;
+
+        geometry::TriangleMesh mesh_all = mesh_ref;
+        camera::PinholeCameraTrajectory camera_all = camera_ref;
+        option.maximum_resident_images_ = 0;
+        pipelines::color_map::ColorMapOptimization(mesh_all, images_rgbd,
+                                                   camera_all, option);
+        ASSERT_EQ(mesh_all.vertex_colors_.size(), mesh_ref.vertices_.size());
+
+        for (int maximum_resident_images : {1, 2}) {
+            geometry::TriangleMesh mesh = mesh_ref;
+            camera::PinholeCameraTrajectory camera = camera_ref;
+            option.maximum_resident_images_ = maximum_resident_images;
+            pipelines::color_map::ColorMapOptimization(mesh, images_rgbd,
+                                                       camera, option);
+            ExpectEQ(mesh.vertex_colors_, mesh_all.vertex_colors_);
+            for (int c = 0; c < n_camera; c++) {
+                ExpectEQ(camera.parameters_[c].extrinsic_,
+                         camera_all.parameters_[c].extrinsic_);
+            }
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,13 +24,96 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+// Fronto-parallel plane with a smooth intensity pattern, shifted by `shift`
+// meters along x.
+static geometry::RGBDImage CreatePlaneRGBDImage(double shift) {
+    const int width = 160;
+    const int height = 120;
+    const double depth = 1.5;
+    const double focal = 100.0;
+    geometry::Image color, depth_image;
+    color.Prepare(width, height, 1, 4);
+    depth_image.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            double x = (u - width / 2) * depth / focal + shift;
+            double y = (v - height / 2) * depth / focal;
+            *color.PointerAt<float>(u, v) =
+                    float(0.5 + 0.25 * std::sin(x * 9) * std::cos(y * 7));
+            *depth_image.PointerAt<float>(u, v) = float(depth);
+        }
+    }
+    return geometry::RGBDImage(color, depth_image);
+}
+
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
 
+TEST(Odometry, ComputeRGBDOdometryFromFrames) {
+    camera::PinholeCameraIntrinsic intrinsic(160, 120, 100.0, 100.0, 80.0,
+                                             60.0);
+    pipelines::odometry::OdometryOption option;
+    geometry::RGBDImage source = CreatePlaneRGBDImage(0.0);
+    geometry::RGBDImage target = CreatePlaneRGBDImage(0.02);
+
+    pipelines::odometry::RGBDOdometryTiming timing;
+    bool success_image;
+    Eigen::Matrix4d trans_image;
+    Eigen::Matrix6d info_image;
+    std::tie(success_image, trans_image, info_image) =
+            pipelines::odometry::ComputeRGBDOdometry(
+                    source, target, intrinsic, Eigen::Matrix4d::Identity(),
+                    pipelines::odometry::RGBDOdometryJacobianFromHybridTerm(),
+                    option, &timing);
+    EXPECT_TRUE(success_image);
+    EXPECT_NEAR(trans_image(0, 3), -0.02, 0.005);
+    EXPECT_EQ(timing.level_ms_.size(),
+              option.iteration_number_per_pyramid_level_.size());
+
+    pipelines::odometry::RGBDOdometryFrame source_frame(source, intrinsic,
+                                                        option);
+    pipelines::odometry::RGBDOdometryFrame target_frame(target, intrinsic,
+                                                        option);
+    EXPECT_EQ(source_frame.NumLevels(), 3);
+    EXPECT_EQ(source_frame.xyz_pyramid_[2]->width_, 40);
+
+    // Frames can be reused, the result does not depend on previous calls.
+    for (int i = 0; i < 2; i++) {
+        bool success_frame;
+        Eigen::Matrix4d trans_frame;
+        Eigen::Matrix6d info_frame;
+        std::tie(success_frame, trans_frame, info_frame) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        source_frame, target_frame, Eigen::Matrix4d::Identity(),
+                        pipelines::odometry::
+                                RGBDOdometryJacobianFromHybridTerm(),
+                        option, &timing);
+        EXPECT_TRUE(success_frame);
+        // The timing reused from the image overload is reset.
+        EXPECT_EQ(timing.preprocessing_ms_, 0.0);
+        ExpectEQ(trans_frame, trans_image);
+        ExpectEQ(info_frame, info_image);
+    }
+
+    // Frames with a different number of levels than the option.
+    pipelines::odometry::OdometryOption option_two_levels;
+    option_two_levels.iteration_number_per_pyramid_level_ = {10, 5};
+    EXPECT_FALSE(std::get<0>(pipelines::odometry::ComputeRGBDOdometry(
+            source_frame, target_frame, Eigen::Matrix4d::Identity(),
+            pipelines::odometry::RGBDOdometryJacobianFromHybridTerm(),
+            option_two_levels)));
+}
+
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
 TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
@@ -27,6 +27,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include "core/CoreTest.h"
+#include "open3d/core/MemoryUsage.h"
 #include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
 
@@ -172,6 +173,31 @@ TEST_P(PointCloudPermuteDevices, Copy) {
     EXPECT_ANY_THROW(pcd_copy.GetPointNormals());
 }
 
+TEST_P(PointCloudPermuteDevices, CopyOnWrite) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPoints(core::Tensor::Ones({2, 3}, dtype, device));
+    pcd.SetPointColors(core::Tensor::Ones({2, 3}, dtype, device) * 2);
+
+    // Copying does not allocate until attributes are written.
+    int64_t before = core::MemoryUsage::GetDeviceUsage(device).current_bytes_;
+    t::geometry::PointCloud pcd_copy = pcd.Copy();
+    EXPECT_EQ(core::MemoryUsage::GetDeviceUsage(device).current_bytes_,
+              before);
+
+    // Writing one attribute of the copy only detaches that attribute.
+    pcd_copy.Translate(core::Tensor::Ones({3}, dtype, device));
+    EXPECT_EQ(core::MemoryUsage::GetDeviceUsage(device).current_bytes_,
+              before + 2 * 3 * 4);
+    EXPECT_TRUE(pcd_copy.GetPoints().AllClose(
+            core::Tensor::Ones({2, 3}, dtype, device) * 2));
+    EXPECT_TRUE(pcd.GetPoints().AllClose(
+            core::Tensor::Ones({2, 3}, dtype, device)));
+    EXPECT_TRUE(pcd_copy.GetPointColors().AllClose(pcd.GetPointColors()));
+}
+
 TEST_P(PointCloudPermuteDevices, Transform) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
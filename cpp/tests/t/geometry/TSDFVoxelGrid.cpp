@@ -43,15 +43,9 @@ INSTANTIATE_TEST_SUITE_P(TSDFVoxelGrid,
                          TSDFVoxelGridPermuteDevices,
                          testing::ValuesIn(PermuteDevices::TestCases()));
 
-TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
-    core::Device device = GetParam();
-
-    float voxel_size = 0.008;
-    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
-                                           {"weight", core::Dtype::UInt16},
-                                           {"color", core::Dtype::UInt16}},
-                                          voxel_size, 0.04f, 16, 1000, device);
-
+/// Integrates the RGBD frames of the test data into \p voxel_grid.
+static void IntegrateTestFrames(t::geometry::TSDFVoxelGrid &voxel_grid,
+                                const core::Device &device) {
     // Intrinsics
     camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
             camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
@@ -94,6 +88,17 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
 
         voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
     }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    IntegrateTestFrames(voxel_grid, device);
 
     auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
     auto pcd_gt = *io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
@@ -107,5 +112,68 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateFloat16) {
+    core::Device device = GetParam();
+    float voxel_size = 0.008;
+
+    // The two Float16 layouts are compared with their Float32 counterparts.
+    std::vector<std::pair<std::unordered_map<std::string, core::Dtype>,
+                          std::unordered_map<std::string, core::Dtype>>>
+            layouts = {{{{"tsdf", core::Dtype::Float16},
+                         {"weight", core::Dtype::UInt16}},
+                        {{"tsdf", core::Dtype::Float32},
+                         {"weight", core::Dtype::Float32}}},
+                       {{{"tsdf", core::Dtype::Float16},
+                         {"weight", core::Dtype::UInt16},
+                         {"color", core::Dtype::UInt16}},
+                        {{"tsdf", core::Dtype::Float32},
+                         {"weight", core::Dtype::UInt16},
+                         {"color", core::Dtype::UInt16}}}};
+    for (const auto &layout : layouts) {
+        const bool has_color = layout.first.count("color") != 0;
+        t::geometry::TSDFVoxelGrid voxel_grid(layout.first, voxel_size, 0.04f,
+                                              16, 1000, device);
+        t::geometry::TSDFVoxelGrid voxel_grid_ref(
+                layout.second, voxel_size, 0.04f, 16, 1000, device);
+        IntegrateTestFrames(voxel_grid, device);
+        IntegrateTestFrames(voxel_grid_ref, device);
+
+        auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+        auto pcd_ref =
+                voxel_grid_ref.ExtractSurfacePoints().ToLegacyPointCloud();
+        ASSERT_GT(pcd_ref.points_.size(), 0u);
+        EXPECT_NEAR(double(pcd.points_.size()) / pcd_ref.points_.size(), 1.0,
+                    0.01);
+        EXPECT_EQ(pcd.HasColors(), has_color);
+        auto result = pipelines::registration::EvaluateRegistration(
+                pcd, pcd_ref, voxel_size * 0.1);
+        EXPECT_GT(result.fitness_, 0.99);
+
+        t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        t::geometry::TriangleMesh mesh_ref =
+                voxel_grid_ref.ExtractSurfaceMesh();
+        ASSERT_GT(mesh_ref.GetTriangles().GetLength(), 0);
+        EXPECT_NEAR(double(mesh.GetTriangles().GetLength()) /
+                            mesh_ref.GetTriangles().GetLength(),
+                    1.0, 0.01);
+        EXPECT_EQ(mesh.HasVertexAttr("colors"), has_color);
+    }
+
+    // Other dtypes would match the size of an unrelated voxel structure.
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float16}, {"weight", core::Dtype::Float32}},
+            voxel_size, 0.04f, 16, 1000, device));
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float16},
+             {"weight", core::Dtype::Float32},
+             {"color", core::Dtype::UInt16}},
+            voxel_size, 0.04f, 16, 1000, device));
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float16},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::Float32}},
+            voxel_size, 0.04f, 16, 1000, device));
+}
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TImageIO, ReadWriteImage) {
+    const std::string file_name = "test_timage.png";
+    std::vector<uint16_t> depth_values(30 * 40);
+    for (size_t i = 0; i < depth_values.size(); i++) {
+        depth_values[i] = uint16_t(i * 32);
+    }
+    core::Tensor depth(depth_values, {30, 40, 1}, core::Dtype::UInt16);
+    EXPECT_TRUE(t::io::WriteImage(file_name, t::geometry::Image(depth)));
+
+    t::geometry::Image image;
+    EXPECT_TRUE(t::io::ReadImage(file_name, image));
+    EXPECT_EQ(image.GetDtype(), core::Dtype::UInt16);
+    EXPECT_TRUE(image.AsTensor().AllClose(depth));
+
+    // An image of the same size is decoded into the same memory.
+    const void *data_ptr = image.GetDataPtr();
+    image.AsTensor().Fill(0);
+    EXPECT_TRUE(t::io::ReadImage(file_name, image));
+    EXPECT_EQ(image.GetDataPtr(), data_ptr);
+    EXPECT_TRUE(image.AsTensor().AllClose(depth));
+
+    // An image of another dtype is replaced.
+    t::geometry::Image float_image(30, 40, 1, core::Dtype::Float32);
+    EXPECT_TRUE(t::io::ReadImage(file_name, float_image));
+    EXPECT_EQ(float_image.GetDtype(), core::Dtype::UInt16);
+
+    std::vector<t::geometry::Image> images(2);
+    EXPECT_TRUE(t::io::ReadImages({file_name, file_name}, images));
+    EXPECT_TRUE(images[1].AsTensor().AllClose(depth));
+    utility::filesystem::RemoveFile(file_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
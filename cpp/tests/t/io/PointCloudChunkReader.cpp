@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudChunkReader.h"
+
+#include <limits>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TPointCloudChunkReader, ReadNext) {
+    t::geometry::PointCloud pcd;
+    core::Tensor points({1000, 3}, core::Dtype::Float32);
+    core::Tensor labels({1000, 1}, core::Dtype::Int32);
+    float *points_ptr = static_cast<float *>(points.GetDataPtr());
+    int32_t *labels_ptr = static_cast<int32_t *>(labels.GetDataPtr());
+    for (int i = 0; i < 1000; i++) {
+        points_ptr[3 * i] = float(i);
+        points_ptr[3 * i + 1] = float(-i);
+        points_ptr[3 * i + 2] = 0.5f;
+        labels_ptr[i] = i;
+    }
+    // Non-finite points are removed from their chunk.
+    points_ptr[3 * 10] = std::numeric_limits<float>::quiet_NaN();
+    pcd.SetPoints(points);
+    pcd.SetPointAttr("labels", labels);
+
+    const std::string file_name = "test_chunks.tpc";
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                           {false, compressed, false}));
+        t::io::PointCloudChunkReader reader;
+        EXPECT_TRUE(reader.Open(file_name, 400, 2));
+        t::geometry::PointCloud chunk;
+        std::vector<t::geometry::PointCloud> chunks;
+        std::vector<int64_t> chunk_sizes;
+        while (reader.ReadNext(chunk)) {
+            chunks.push_back(chunk);
+            chunk_sizes.push_back(chunk.GetPoints().GetLength());
+        }
+        ASSERT_EQ(chunk_sizes, std::vector<int64_t>({399, 400, 200}));
+        EXPECT_TRUE(chunks[0].GetPointAttr("labels").Slice(0, 9, 11).AllClose(
+                core::Tensor(std::vector<int32_t>{9, 11}, {2, 1},
+                             core::Dtype::Int32)));
+        EXPECT_TRUE(chunks[2].GetPointAttr("labels").AllClose(
+                labels.Slice(0, 800, 1000)));
+    }
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(TPointCloudChunkReader, ReadNextLegacyFormat) {
+    const std::string file_name = "test_chunks.xyz";
+    t::geometry::PointCloud pcd(
+            core::Tensor::Ones({500, 3}, core::Dtype::Float64));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+
+    t::io::PointCloudChunkReader reader;
+    EXPECT_TRUE(reader.Open(file_name, 200));
+    t::geometry::PointCloud chunk;
+    std::vector<int64_t> chunk_sizes;
+    while (reader.ReadNext(chunk)) {
+        chunk_sizes.push_back(chunk.GetPoints().GetLength());
+        EXPECT_EQ(chunk.GetPoints().GetDtype(), core::Dtype::Float64);
+        EXPECT_TRUE(chunk.GetPoints().AllClose(core::Tensor::Ones(
+                {chunk_sizes.back(), 3}, core::Dtype::Float64)));
+    }
+    EXPECT_EQ(chunk_sizes, std::vector<int64_t>({200, 200, 100}));
+    utility::filesystem::RemoveFile(file_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -28,12 +28,18 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <limits>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -76,6 +82,18 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
+        {"test.tpc",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 3
+        {"test.tpc",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 4
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -167,13 +185,16 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY2) {
     EXPECT_EQ(pcd.GetPoints().GetLength(), 7);
 }
 
-// Skip unsupported datatype.
+// Char properties are read as Int8.
 TEST(TPointCloudIO, ReadPointCloudFromPLY3) {
     t::geometry::PointCloud pcd;
     t::io::ReadPointCloud(
             std::string(TEST_DATA_DIR) + "/test_sample_wrong_format.ply", pcd,
             {"auto", false, false, true});
-    EXPECT_FALSE(pcd.HasPointAttr("intensity"));
+    ASSERT_TRUE(pcd.HasPointAttr("intensity"));
+    EXPECT_EQ(pcd.GetPointAttr("intensity").GetDtype(), core::Dtype::Int8);
+    EXPECT_EQ(pcd.GetPointAttr("intensity").ToFlatVector<int8_t>(),
+              std::vector<int8_t>({100, 127}));
 }
 
 // Custom attributes check.
@@ -186,5 +207,137 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// ASCII formats are parsed directly into tensors.
+TEST(TPointCloudIO, ReadPointCloudFromXYZN) {
+    const std::string file_name = "test_read.xyzn";
+    {
+        std::ofstream out(file_name);
+        out << "0 0 0 0 0 1\n1 2 3 0 1 0\nnan 0 0 0 0 1\n1 inf 1 1 0 0\n";
+    }
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", true, true, false}));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 2);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 2);
+    EXPECT_TRUE(pcd.GetPoints().AllClose(core::Tensor(
+            std::vector<double>{0, 0, 0, 1, 2, 3}, {2, 3},
+            core::Dtype::Float64)));
+
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 4);
+    utility::filesystem::RemoveFile(file_name);
+}
+
+// Binary PCD fields are decoded directly into tensors.
+TEST(TPointCloudIO, ReadPointCloudFromPCD) {
+    geometry::PointCloud legacy;
+    legacy.points_ = {{0, 0, 0}, {1, 2, 3}, {-1, 0.5, 2}};
+    legacy.normals_ = {{0, 0, 1}, {0, 1, 0}, {1, 0, 0}};
+    legacy.colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        const std::string file_name = "test_read.pcd";
+        EXPECT_TRUE(io::WritePointCloud(file_name, legacy,
+                                        {false, compressed, false}));
+        t::geometry::PointCloud pcd;
+        EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                          {"auto", true, true, false}));
+        t::geometry::PointCloud expected =
+                t::geometry::PointCloud::FromLegacyPointCloud(
+                        legacy, core::Dtype::Float64);
+        EXPECT_TRUE(pcd.GetPoints().AllClose(expected.GetPoints()));
+        EXPECT_TRUE(
+                pcd.GetPointNormals().AllClose(expected.GetPointNormals()));
+        EXPECT_TRUE(pcd.GetPointColors().AllClose(expected.GetPointColors()));
+        utility::filesystem::RemoveFile(file_name);
+    }
+}
+
+// Tensors of uncompressed .tpc files are backed by the file mapping.
+TEST(TPointCloudIO, ReadPointCloudSubsetFromTPC) {
+    const std::string file_name = "test_subset.tpc";
+    t::geometry::PointCloud pcd;
+    core::Tensor points = core::Tensor::Ones({1000, 3}, core::Dtype::Float32);
+    core::Tensor labels({1000, 1}, core::Dtype::Int32);
+    int32_t *labels_ptr = static_cast<int32_t *>(labels.GetDataPtr());
+    for (int i = 0; i < 1000; i++) {
+        labels_ptr[i] = i;
+    }
+    pcd.SetPoints(points);
+    pcd.SetPointAttr("labels", labels);
+
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                           {false, compressed, false}));
+        t::geometry::PointCloud subset;
+        EXPECT_TRUE(t::io::ReadPointCloudSubsetFromTPC(file_name, subset,
+                                                       {"labels"}, 100, 200));
+        EXPECT_FALSE(subset.HasPoints());
+        EXPECT_TRUE(subset.GetPointAttr("labels").AllClose(
+                labels.Slice(0, 100, 200)));
+
+        // Modifying a mapped tensor does not change the file.
+        subset.GetPointAttr("labels").Fill(-1);
+        t::geometry::PointCloud all;
+        EXPECT_TRUE(t::io::ReadPointCloud(file_name, all,
+                                          {"auto", false, false, false}));
+        EXPECT_TRUE(all.GetPoints().AllClose(points));
+        EXPECT_TRUE(all.GetPointAttr("labels").AllClose(labels));
+    }
+    utility::filesystem::RemoveFile(file_name);
+}
+
+
+// Sizes in .tpc headers are checked without overflowing int64_t.
+TEST(TPointCloudIO, ReadTPCRejectsOverflowingSizes) {
+    const std::string file_name = "test_overflow.tpc";
+    auto write_header = [&](int64_t num_points, int64_t chunk_offset,
+                            int64_t chunk_size) {
+        std::string header("O3DTPC\0\0", 8);
+        auto append = [&header](const auto &value) {
+            header.append(reinterpret_cast<const char *>(&value),
+                          sizeof(value));
+        };
+        const std::string name = "points";
+        append(uint32_t(1));
+        append(uint32_t(0x01020304));
+        append(num_points);
+        append(uint32_t(1));
+        append(uint32_t(name.size()));
+        header += name;
+        append(uint8_t(core::Dtype::Float32.GetDtypeCode()));
+        append(uint8_t(4));
+        append(uint8_t(0));
+        append(uint8_t(0));
+        append(uint32_t(1));
+        append(int64_t(3));
+        append(num_points);
+        append(uint32_t(1));
+        append(chunk_offset);
+        append(chunk_size);
+        header.resize(128, '\0');
+        std::ofstream(file_name, std::ios::binary) << header;
+    };
+    t::geometry::PointCloud pcd;
+
+    write_header(4, 64, 48);
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 4);
+
+    // 2^62 points of 12 bytes wrap around to a size of 0.
+    write_header(int64_t(1) << 62, 128, 0);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd));
+
+    // The chunk end overflows int64_t.
+    write_header(4, std::numeric_limits<int64_t>::max(), 48);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd));
+
+    write_header(-1, 64, 0);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd));
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
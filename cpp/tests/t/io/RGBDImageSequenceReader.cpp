@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
+
+#include "open3d/geometry/Image.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/PrefetchingRGBDVideoReader.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Writes frames whose color and depth values are the frame index.
+static void WriteImageSequence(const std::string &directory, int num_frames) {
+    utility::filesystem::MakeDirectoryHierarchy(directory + "/color");
+    utility::filesystem::MakeDirectoryHierarchy(directory + "/depth");
+    for (int i = 0; i < num_frames; i++) {
+        geometry::Image color, depth;
+        color.Prepare(8, 6, 3, 1);
+        depth.Prepare(8, 6, 1, 2);
+        std::fill(color.data_.begin(), color.data_.end(), uint8_t(i));
+        for (int k = 0; k < 8 * 6; k++) {
+            *depth.PointerAt<uint16_t>(k % 8, k / 8) = uint16_t(i);
+        }
+        io::WriteImage(fmt::format("{}/color/{:05d}.png", directory, i),
+                       color);
+        io::WriteImage(fmt::format("{}/depth/{:05d}.png", directory, i),
+                       depth);
+    }
+}
+
+static void RemoveImageSequence(const std::string &directory) {
+    for (const char *subdir : {"/color", "/depth"}) {
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectory(directory + subdir,
+                                                  filenames);
+        for (const std::string &filename : filenames) {
+            utility::filesystem::RemoveFile(filename);
+        }
+        utility::filesystem::DeleteDirectory(directory + subdir);
+    }
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+TEST(RGBDImageSequenceReader, ReadSequence) {
+    const std::string directory = "test_rgbd_sequence";
+    WriteImageSequence(directory, 5);
+
+    std::shared_ptr<t::io::RGBDVideoReader> reader =
+            t::io::RGBDVideoReader::Create(directory);
+    EXPECT_TRUE(reader->IsOpened());
+    EXPECT_EQ(reader->GetMetadata().width_, 8);
+    EXPECT_EQ(reader->GetMetadata().height_, 6);
+    EXPECT_EQ(reader->GetMetadata().depth_dt_, core::Dtype::UInt16);
+    int num_frames = 0;
+    while (!reader->IsEOF()) {
+        t::geometry::RGBDImage frame = reader->NextFrame();
+        EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(),
+                  num_frames);
+        num_frames++;
+    }
+    EXPECT_EQ(num_frames, 5);
+    EXPECT_TRUE(reader->NextFrame().IsEmpty());
+
+    // 30 fps without metadata.
+    EXPECT_TRUE(reader->SeekTimestamp(100000));
+    EXPECT_EQ(reader->NextFrame().color_.AsTensor()[0][0][0].Item<uint8_t>(),
+              3);
+    EXPECT_EQ(reader->GetTimestamp(), 100000);
+    RemoveImageSequence(directory);
+}
+
+TEST(RGBDImageSequenceReader, Prefetching) {
+    const std::string directory = "test_rgbd_prefetch";
+    WriteImageSequence(directory, 10);
+
+    t::io::PrefetchingRGBDVideoReader reader(
+            std::make_shared<t::io::RGBDImageSequenceReader>(), 3);
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_TRUE(reader.Open(directory));
+    std::vector<int> values;
+    while (!reader.IsEOF()) {
+        t::geometry::RGBDImage frame = reader.NextFrame();
+        values.push_back(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>());
+    }
+    EXPECT_EQ(values, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+
+    // Frames read ahead are discarded when seeking.
+    EXPECT_TRUE(reader.SeekTimestamp(200000));
+    t::geometry::RGBDImage frame = reader.NextFrame();
+    EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(), 6);
+    EXPECT_EQ(reader.GetTimestamp(), 200000);
+    EXPECT_FALSE(reader.IsEOF());
+    reader.Close();
+    EXPECT_TRUE(reader.IsEOF());
+    RemoveImageSequence(directory);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class OdometryPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Odometry,
+                         OdometryPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Fronto-parallel plane with a smooth intensity pattern, shifted by `shift`
+// meters along x. Depth is Float32 in meters.
+static t::geometry::RGBDImage CreatePlaneRGBDImage(float shift,
+                                                   const core::Device &device) {
+    const int64_t width = 160;
+    const int64_t height = 120;
+    const float depth = 1.5f;
+    const float focal = 100.0f;
+    std::vector<float> color(width * height);
+    std::vector<float> depth_values(width * height, depth);
+    for (int64_t v = 0; v < height; v++) {
+        for (int64_t u = 0; u < width; u++) {
+            float x = (u - width / 2) * depth / focal + shift;
+            float y = (v - height / 2) * depth / focal;
+            color[v * width + u] =
+                    0.5f + 0.25f * std::sin(x * 9) * std::cos(y * 7);
+        }
+    }
+    return t::geometry::RGBDImage(
+            core::Tensor(color, {height, width, 1}, core::Dtype::Float32,
+                         device),
+            core::Tensor(depth_values, {height, width, 1},
+                         core::Dtype::Float32, device));
+}
+
+static core::Tensor CreateIntrinsics() {
+    return core::Tensor(
+            std::vector<float>{100.0f, 0, 80.0f, 0, 100.0f, 60.0f, 0, 0, 1.0f},
+            {3, 3}, core::Dtype::Float32);
+}
+
+TEST_P(OdometryPermuteDevices, CreateVertexAndNormalMap) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage image = CreatePlaneRGBDImage(0.0f, device);
+
+    core::Tensor vertex_map = t::pipelines::odometry::CreateVertexMap(
+            image.depth_.AsTensor(), CreateIntrinsics(), 3.0f);
+    EXPECT_EQ(vertex_map.GetShape(), core::SizeVector({120, 160, 3}));
+    EXPECT_EQ(vertex_map.GetDevice(), device);
+    EXPECT_NEAR(vertex_map[60][80][2].Item<float>(), 1.5f, 1e-6);
+    EXPECT_NEAR(vertex_map[0][0][0].Item<float>(), -1.2f, 1e-5);
+    EXPECT_NEAR(vertex_map[0][0][1].Item<float>(), -0.9f, 1e-5);
+
+    // Depth beyond depth_max is invalid.
+    core::Tensor vertex_map_near = t::pipelines::odometry::CreateVertexMap(
+            image.depth_.AsTensor(), CreateIntrinsics(), 1.0f);
+    EXPECT_EQ(vertex_map_near.Abs().Sum({0, 1, 2}).Item<float>(), 0.0f);
+
+    // The plane faces the camera, the last row and column have no normal.
+    core::Tensor normal_map =
+            t::pipelines::odometry::CreateNormalMap(vertex_map);
+    EXPECT_NEAR(normal_map[60][80][2].Item<float>(), -1.0f, 1e-5);
+    EXPECT_NEAR(normal_map[60][80][0].Item<float>(), 0.0f, 1e-5);
+    EXPECT_EQ(normal_map[119][80][2].Item<float>(), 0.0f);
+}
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage source = CreatePlaneRGBDImage(0.0f, device);
+    t::geometry::RGBDImage target = CreatePlaneRGBDImage(0.02f, device);
+
+    core::Tensor transformation =
+            t::pipelines::odometry::RGBDOdometryMultiScale(
+                    source, target, CreateIntrinsics(),
+                    core::Tensor::Eye(4, core::Dtype::Float32, device),
+                    /*depth_scale=*/1.0f);
+    EXPECT_EQ(transformation.GetShape(), core::SizeVector({4, 4}));
+    EXPECT_EQ(transformation.GetDevice(), device);
+    EXPECT_NEAR(transformation[0][3].Item<float>(), -0.02f, 0.005f);
+    EXPECT_NEAR(transformation[2][3].Item<float>(), 0.0f, 0.005f);
+
+    // Depth is not modified in place by the depth scale.
+    EXPECT_EQ(source.depth_.AsTensor()[0][0][0].Item<float>(), 1.5f);
+}
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage source = CreatePlaneRGBDImage(0.0f, device);
+
+    // A plane is degenerate for point to plane odometry, use a curved
+    // surface, moved along the optical axis in the target.
+    const int64_t width = 160;
+    const int64_t height = 120;
+    std::vector<float> depth_values(width * height);
+    for (int64_t v = 0; v < height; v++) {
+        for (int64_t u = 0; u < width; u++) {
+            float x = (u - width / 2) / 100.0f;
+            float y = (v - height / 2) / 100.0f;
+            depth_values[v * width + u] =
+                    1.5f + 0.3f * x * x + 0.6f * y * y + 0.1f * x * y;
+        }
+    }
+    core::Tensor depth(depth_values, {height, width, 1}, core::Dtype::Float32,
+                       device);
+    source.depth_ = t::geometry::Image(depth);
+    t::geometry::RGBDImage target(source.color_,
+                                  t::geometry::Image(depth + 0.03f));
+
+    core::Tensor transformation =
+            t::pipelines::odometry::RGBDOdometryMultiScale(
+                    source, target, CreateIntrinsics(),
+                    core::Tensor::Eye(4, core::Dtype::Float32, device),
+                    /*depth_scale=*/1.0f, /*depth_max=*/3.0f,
+                    /*depth_diff=*/0.07f, {10, 5, 3},
+                    t::pipelines::odometry::Method::PointToPlane);
+    EXPECT_NEAR(transformation[2][3].Item<float>(), 0.03f, 0.005f);
+}
+
+TEST_P(OdometryPermuteDevices, DegenerateSystem) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage source = CreatePlaneRGBDImage(0.0f, device);
+    core::Tensor source_vertex_map = t::pipelines::odometry::CreateVertexMap(
+            source.depth_.AsTensor(), CreateIntrinsics(), 3.0f);
+    core::Tensor target_vertex_map = core::Tensor::Zeros(
+            source_vertex_map.GetShape(), core::Dtype::Float32, device);
+    core::Tensor target_normal_map =
+            t::pipelines::odometry::CreateNormalMap(target_vertex_map);
+
+    // Without correspondences, the step fails with the identity update.
+    bool is_success;
+    core::Tensor update;
+    std::tie(is_success, update) =
+            t::pipelines::odometry::ComputePosePointToPlane(
+                    source_vertex_map, target_vertex_map, target_normal_map,
+                    CreateIntrinsics(),
+                    core::Tensor::Eye(4, core::Dtype::Float32, device), 0.07f);
+    EXPECT_FALSE(is_success);
+    EXPECT_TRUE(update.AllClose(
+            core::Tensor::Eye(4, core::Dtype::Float32, device)));
+
+    // A target without valid depth keeps the initial estimate.
+    t::geometry::RGBDImage target(
+            source.color_,
+            t::geometry::Image(core::Tensor::Zeros(
+                    {120, 160, 1}, core::Dtype::Float32, device)));
+    core::Tensor init = core::Tensor::Eye(4, core::Dtype::Float32, device);
+    init[0][3] = 0.01f;
+    core::Tensor transformation =
+            t::pipelines::odometry::RGBDOdometryMultiScale(
+                    source, target, CreateIntrinsics(), init,
+                    /*depth_scale=*/1.0f);
+    EXPECT_TRUE(transformation.AllClose(init));
+}
+
+}  // namespace tests
+}  // namespace open3d
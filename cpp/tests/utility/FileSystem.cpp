@@ -30,6 +30,8 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cstring>
+#include <fstream>
 
 #include "open3d/utility/Console.h"
 #include "tests/UnitTest.h"
@@ -547,5 +549,27 @@ TEST(FileSystem, GetPathComponents) {
     EXPECT_EQ(result, expected);
 }
 
+TEST(FileSystem, MappedFile) {
+    std::string file_name = "mapped_file.bin";
+    const std::string content("binary\0content", 14);
+    {
+        std::ofstream out(file_name, std::ios::binary);
+        out.write(content.data(), content.size());
+    }
+
+    utility::filesystem::MappedFile file;
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_TRUE(file.Open(file_name));
+    EXPECT_TRUE(file.IsOpen());
+    EXPECT_EQ(file.GetSize(), int64_t(content.size()));
+    EXPECT_EQ(std::memcmp(file.GetData(), content.data(), content.size()), 0);
+    file.Close();
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_EQ(file.GetData(), nullptr);
+
+    EXPECT_TRUE(utility::filesystem::RemoveFile(file_name));
+    EXPECT_FALSE(file.Open(file_name));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -165,6 +165,9 @@ int main(int argc, char **argv) {
         WriteJsonToFile(fmt::format("{}/config.json", output_path),
                         GenerateDatasetConfig(output_path));
     }
+    // Encodes copies of the frames off the playback thread, the reader reuses
+    // its frame buffer.
+    io::AsyncImageWriter writer;
     while (!mkv_reader.IsEOF() && !flag_exit) {
         if (flag_play) {
             auto im_rgbd = mkv_reader.NextFrame();
@@ -179,12 +182,12 @@ int main(int argc, char **argv) {
                 auto color_file =
                         fmt::format("{0}/color/{1:05d}.jpg", output_path, idx);
                 utility::LogInfo("Writing to {}", color_file);
-                io::WriteImage(color_file, im_rgbd->color_);
+                writer.Write(color_file, im_rgbd->color_);
 
                 auto depth_file =
                         fmt::format("{0}/depth/{1:05d}.png", output_path, idx);
                 utility::LogInfo("Writing to {}", depth_file);
-                io::WriteImage(depth_file, im_rgbd->depth_);
+                writer.Write(depth_file, im_rgbd->depth_);
 
                 ++idx;
             }
@@ -196,4 +199,8 @@ int main(int argc, char **argv) {
     }
 
     mkv_reader.Close();
+    writer.Flush();
+    const auto stats = writer.GetStatistics();
+    utility::LogInfo("Written {} images, waited {:.3f}s for the writer.",
+                     stats.num_written_, stats.blocked_seconds_);
 }
@@ -211,6 +211,8 @@ int main(int argc, char **argv) {
     auto last_frame_time = std::chrono::steady_clock::now() - frame_interval;
     using legacyRGBDImage = open3d::geometry::RGBDImage;
     legacyRGBDImage im_rgbd;
+    // Encodes the images off the playback thread.
+    io::AsyncImageWriter writer;
     while (!bag_reader.IsEOF() && !flag_exit) {
         if (flag_play) {
             std::this_thread::sleep_until(last_frame_time + frame_interval);
@@ -229,23 +231,16 @@ int main(int argc, char **argv) {
             }
 
             ++idx;
-            if (write_image)
-#pragma omp parallel sections
-            {
-#pragma omp section
-                {
-                    auto color_file = fmt::format("{0}/color/{1:05d}.jpg",
-                                                  output_path, idx);
-                    utility::LogInfo("Writing to {}", color_file);
-                    io::WriteImage(color_file, im_rgbd.color_);
-                }
-#pragma omp section
-                {
-                    auto depth_file = fmt::format("{0}/depth/{1:05d}.png",
-                                                  output_path, idx);
-                    utility::LogInfo("Writing to {}", depth_file);
-                    io::WriteImage(depth_file, im_rgbd.depth_);
-                }
+            if (write_image) {
+                auto color_file = fmt::format("{0}/color/{1:05d}.jpg",
+                                              output_path, idx);
+                utility::LogInfo("Writing to {}", color_file);
+                writer.Write(color_file, im_rgbd.color_);
+
+                auto depth_file = fmt::format("{0}/depth/{1:05d}.png",
+                                              output_path, idx);
+                utility::LogInfo("Writing to {}", depth_file);
+                writer.Write(depth_file, im_rgbd.depth_);
             }
             vis.UpdateGeometry();
             vis.UpdateRender();
@@ -253,4 +248,8 @@ int main(int argc, char **argv) {
         vis.PollEvents();
     }
     bag_reader.Close();
+    writer.Flush();
+    const auto stats = writer.GetStatistics();
+    utility::LogInfo("Written {} images, waited {:.3f}s for the writer.",
+                     stats.num_written_, stats.blocked_seconds_);
 }
@@ -0,0 +1,60 @@
+# Open3D: www.open3d.org
+# The MIT License (MIT)
+# See license file or visit www.open3d.org for details
+
+# examples/python/benchmark/benchmark_threads.py
+
+# Runs the same workload from several Python threads. Functions that release
+# the GIL scale with the number of threads, the others run one at a time.
+
+import open3d as o3d
+import numpy as np
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+
+def make_point_cloud(num_points, seed):
+    rng = np.random.default_rng(seed)
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(rng.random((num_points, 3)))
+    return pcd
+
+
+def legacy_workload(pcd):
+    target = pcd.voxel_down_sample(0.01)
+    target.estimate_normals(o3d.geometry.KDTreeSearchParamKNN(20))
+    source = o3d.geometry.PointCloud(target)
+    source.translate((0.005, 0, 0))
+    o3d.pipelines.registration.registration_icp(
+        source, target, 0.02, np.identity(4),
+        o3d.pipelines.registration.TransformationEstimationPointToPlane(),
+        o3d.pipelines.registration.ICPConvergenceCriteria(max_iteration=10))
+
+
+def tensor_workload(tensor):
+    offset = o3d.core.Tensor.ones(tensor.shape, tensor.dtype)
+    for _ in range(10):
+        tensor = tensor + offset
+    return tensor.T().contiguous().sum()
+
+
+def run(name, workload, inputs, num_threads):
+    start = time.time()
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        list(executor.map(workload, inputs))
+    elapsed = time.time() - start
+    print("{:>8}, {:2d} threads: {:7.3f}s, {:6.2f} calls/s".format(
+        name, num_threads, elapsed, len(inputs) / elapsed))
+
+
+if __name__ == "__main__":
+    num_calls = 16
+    clouds = [make_point_cloud(200000, i) for i in range(num_calls)]
+    tensors = [
+        o3d.core.Tensor(np.random.rand(1000, 1000).astype(np.float32))
+        for _ in range(num_calls)
+    ]
+    for num_threads in (1, 2, 4, 8):
+        run("legacy", legacy_workload, clouds, num_threads)
+    for num_threads in (1, 2, 4, 8):
+        run("tensor", tensor_workload, tensors, num_threads)
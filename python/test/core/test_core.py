@@ -78,6 +78,46 @@ def test_dtype():
     assert "{}".format(dtype) == "Int32"
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_float16_quantize(device):
+    np_t = np.array([0.5, -1.25, 2.0, 40.0], dtype=np.float16)
+    o3_t = o3d.core.Tensor(np_t, device=device)
+    assert o3_t.dtype == o3d.core.Dtype.Float16
+    assert o3_t.dtype.byte_size() == 2
+    np.testing.assert_equal(o3_t.cpu().numpy(), np_t)
+
+    q = o3_t.quantize(o3d.core.Dtype.Int8, 0.25)
+    assert q.dtype == o3d.core.Dtype.Int8
+    np.testing.assert_equal(q.cpu().numpy(),
+                            np.array([2, -5, 8, 127], dtype=np.int8))
+    np.testing.assert_equal(
+        q.dequantize(o3d.core.Dtype.Float32, 0.25).cpu().numpy(),
+        np.array([0.5, -1.25, 2.0, 31.75], dtype=np.float32))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_lazy_copy_memory_usage(device):
+    o3d.core.reset_peak_memory_usage()
+    with o3d.core.MemoryTag("test_lazy_copy"):
+        src = o3d.core.Tensor.ones((4, 4), o3d.core.Dtype.Float32, device)
+    usage = o3d.core.get_tag_memory_usage("test_lazy_copy")
+    assert usage.current_bytes == 64
+    assert usage.num_allocations == 1
+
+    dst = src.lazy_copy()
+    assert o3d.core.get_tag_memory_usage("test_lazy_copy").current_bytes == 64
+
+    # Writing detaches the copy, the source is unchanged.
+    dst[0, 0] = 2
+    assert dst[0, 0].item() == 2
+    assert src[0, 0].item() == 1
+
+    del src
+    usage = o3d.core.get_tag_memory_usage("test_lazy_copy")
+    assert usage.current_bytes == 0
+    assert usage.peak_bytes == 64
+    assert str(device) in o3d.core.get_all_device_memory_usage()
+
 def test_device():
     device = o3d.core.Device()
     assert device.get_type() == o3d.core.Device.DeviceType.CPU
@@ -229,6 +269,24 @@ def test_tensor_to_numpy_scope():
     np.testing.assert_equal(dst_t, src_t)
 
 
+def test_tensor_from_numpy_scope():
+
+    def get_o3d_t():
+        src_t = np.array([[10., 11., 12.], [13., 14., 15.]])
+        return o3d.core.Tensor.from_numpy(src_t)  # Shared memory
+
+    # The Tensor keeps the Numpy array alive.
+    o3d_t = get_o3d_t()
+    np.testing.assert_equal(o3d_t.numpy(),
+                            np.array([[10., 11., 12.], [13., 14., 15.]]))
+
+    # Strides that are not a multiple of the item size are copied.
+    src_t = np.zeros(4, dtype=[("x", np.float32), ("y", np.int8)])
+    src_t["x"] = np.arange(4)
+    o3d_t = o3d.core.Tensor.from_numpy(src_t["x"])
+    np.testing.assert_equal(o3d_t.numpy(), np.arange(4, dtype=np.float32))
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_binary_ew_ops(device):
     a = o3d.core.Tensor(np.array([4, 6, 8, 10, 12, 14]), device=device)
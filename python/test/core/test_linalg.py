@@ -62,7 +62,7 @@ def test_matmul(device, dtype):
 
     # Incompatible shape test
     with pytest.raises(RuntimeError) as excinfo:
-        a = o3d.core.Tensor.zeros((3, 4, 5), dtype=dtype)
+        a = o3d.core.Tensor.zeros((2, 3, 4, 5), dtype=dtype)
         b = o3d.core.Tensor.zeros((4, 5), dtype=dtype)
         c = a @ b
     assert 'Tensor A must be 2D' in str(excinfo.value)
@@ -113,8 +113,8 @@ def test_inverse(device, dtype):
                                rtol=1e-5,
                                atol=1e-5)
 
-    # Non-2D
-    for shape in [(), [1], (3, 4, 5)]:
+    # Non-2D, 3D tensors are batches of matrices
+    for shape in [(), [1], (2, 3, 4, 5)]:
         with pytest.raises(RuntimeError) as excinfo:
             a = o3d.core.Tensor.zeros(shape, dtype=dtype, device=device)
             a.inv()
@@ -197,7 +197,7 @@ def test_svd(device, dtype):
             a = o3d.core.Tensor.zeros(shapes, dtype=dtype, device=device)
             a.svd()
         assert 'dimensions with zero' in str(excinfo.value)
-    for shapes in [(), [1], (1, 2, 4)]:
+    for shapes in [(), [1], (1, 1, 2, 4)]:
         with pytest.raises(RuntimeError) as excinfo:
             a = o3d.core.Tensor.zeros(shapes, dtype=dtype, device=device)
             a.svd()
@@ -275,3 +275,42 @@ def test_lstsq(device, dtype):
             a.lstsq(b)
         assert 'must satisfy rows({}) > cols({})'.format(
             a_shape[0], a_shape[1]) in str(excinfo.value)
+
+
+@pytest.mark.parametrize("device", list_devices())
+@pytest.mark.parametrize("dtype",
+                         [o3d.core.Dtype.Float32, o3d.core.Dtype.Float64])
+def test_batched(device, dtype):
+    np.random.seed(0)
+    np_dtype = np.float32 if dtype == o3d.core.Dtype.Float32 else np.float64
+    m = np.random.rand(16, 6, 6).astype(np_dtype)
+    a_numpy = m @ m.transpose(0, 2, 1) + 6 * np.eye(6, dtype=np_dtype)
+    b_numpy = np.random.rand(16, 6, 2).astype(np_dtype)
+    a = o3d.core.Tensor(a_numpy, device=device)
+    b = o3d.core.Tensor(b_numpy, device=device)
+
+    np.testing.assert_allclose(a.matmul(b).cpu().numpy(),
+                               a_numpy @ b_numpy,
+                               rtol=1e-5)
+    np.testing.assert_allclose(a.inv().cpu().numpy(),
+                               np.linalg.inv(a_numpy),
+                               rtol=1e-4,
+                               atol=1e-5)
+    x_numpy = np.linalg.solve(a_numpy, b_numpy)
+    np.testing.assert_allclose(a.solve(b).cpu().numpy(),
+                               x_numpy,
+                               rtol=1e-4,
+                               atol=1e-5)
+    np.testing.assert_allclose(o3d.core.cholesky_solve(a, b).cpu().numpy(),
+                               x_numpy,
+                               rtol=1e-4,
+                               atol=1e-5)
+
+    w, v = o3d.core.symmetric_eigen_3x3(a[:, :3, :3])
+    w_numpy = np.linalg.eigvalsh(a_numpy[:, :3, :3])
+    np.testing.assert_allclose(w.cpu().numpy(), w_numpy, rtol=1e-4)
+    v = v.cpu().numpy()
+    np.testing.assert_allclose(a_numpy[:, :3, :3] @ v,
+                               v * w.cpu().numpy()[:, None, :],
+                               rtol=1e-4,
+                               atol=1e-4)
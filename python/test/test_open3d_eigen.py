@@ -37,6 +37,8 @@ import pytest
         (np.ones((0, 3), dtype=np.float64), False),
         # Wrong shape
         (np.ones((2, 4), dtype=np.float64), True),
+        # Large array, copied without holding the GIL
+        (np.random.rand(100000, 3), False),
         # Non-numpy array
         ([[1, 2, 3], [4, 5, 6]], False),
         ([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], False),